@@ -0,0 +1,94 @@
+// ProcessBatch throughput benchmark.
+//
+// Pushes the same synthetic tick stream through InputProcessor once per
+// element with ProcessDelta and then in batches with ProcessBatch at every
+// SIMD level this CPU supports, and reports samples per second for each.
+// The default config is used plus a deadzone and inverted Y so that every
+// mapping stage does work.
+//
+// Usage: Mouse2VR_BatchBench [samples] [batch_size]
+
+#include "core/InputProcessor.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+ProcessingConfig BenchConfig() {
+    ProcessingConfig config;
+    config.deadzone = 0.05f;
+    config.invertY = true;
+    config.maxSpeed = 0.8f;
+    return config;
+}
+
+double RunScalar(const std::vector<MouseDelta>& deltas, const std::vector<float>& dts, size_t samples) {
+    InputProcessor processor;
+    processor.SetConfig(BenchConfig());
+    float sink = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < samples; ++i) {
+        size_t k = i % deltas.size();
+        float x, y;
+        processor.ProcessDelta(deltas[k], dts[k], x, y);
+        sink += y + processor.GetSpeedMetersPerSecond();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 12345.0f) {
+        std::printf(" ");  // Keep the loop from being optimized away
+    }
+    return samples / seconds;
+}
+
+double RunBatch(const std::vector<MouseDelta>& deltas, const std::vector<float>& dts, size_t samples,
+                size_t batchSize, SimdLevel level) {
+    InputProcessor processor;
+    processor.SetConfig(BenchConfig());
+    processor.SetSimdLevel(level);
+    std::vector<float> x(batchSize), y(batchSize), speed(batchSize);
+    float sink = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t done = 0; done < samples; done += batchSize) {
+        size_t offset = done % deltas.size();
+        size_t n = std::min(batchSize, deltas.size() - offset);
+        processor.ProcessBatch(std::span(deltas).subspan(offset, n), std::span(dts).subspan(offset, n),
+                               x, y, speed);
+        sink += y[0] + speed[n - 1];
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 12345.0f) {
+        std::printf(" ");
+    }
+    return samples / seconds;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t samples = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000000;
+    const size_t batchSize = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1024;
+
+    // 64K ticks of uneven walking input, reused cyclically
+    std::vector<MouseDelta> deltas(65536);
+    std::vector<float> dts(65536);
+    for (size_t i = 0; i < deltas.size(); ++i) {
+        deltas[i] = {static_cast<long>(i % 5) - 2, static_cast<long>((i * 37) % 200)};
+        dts[i] = 0.005f + 0.0001f * static_cast<float>(i % 11);
+    }
+
+    std::printf("%-14s %16s %10s\n", "path", "samples/s", "speedup");
+    const double scalar = RunScalar(deltas, dts, samples);
+    std::printf("%-14s %16.0f %10.2f\n", "ProcessDelta", scalar, 1.0);
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::Sse2, SimdLevel::Avx2}) {
+        if (level > DetectSimdLevel()) {
+            break;
+        }
+        double rate = RunBatch(deltas, dts, samples, batchSize, level);
+        std::printf("batch %-8s %16.0f %10.2f\n", SimdLevelToString(level), rate, rate / scalar);
+    }
+    return 0;
+}
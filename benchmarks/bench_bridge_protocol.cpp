@@ -0,0 +1,187 @@
+// Bridge protocol benchmark: one typed batch vs per-setting string messages.
+//
+// The UI changes four settings (sensitivity, DPI, invert Y, lock X):
+//   - legacy_decode:  four "setX:value" strings through a find() chain with
+//                     std::stod/std::stoi, as the bridge used to decode them
+//   - json_decode:    one {"cmd":"set","args":{...}} request parsed into a
+//                     SettingsChange
+//   - legacy_apply:   the four single setters on a core (one processor
+//                     config publish and one config save request each)
+//   - batched_apply:  the batched request through BridgeDispatcher
+//   - invalid:        a request with an out-of-range field (error reply)
+//
+// Saves are debounced in the background, so each apply case reports its
+// save requests and the file writes they turned into (with a final flush).
+// The apply runs write config.json next to this binary; any existing file
+// is restored afterwards.
+//
+// Results go to stdout as a JSON array; progress goes to stderr.
+//
+// Usage: Mouse2VR_BridgeBench [decode_iterations] [apply_iterations]
+
+#include "common/LatencyHistogram.h"
+#include "core/BridgeProtocol.h"
+#include "core/IControllerSink.h"
+#include "core/IInputSource.h"
+#include "core/InputSampleQueue.h"
+#include "core/Mouse2VRCore.h"
+#include "core/PathUtils.h"
+#include <nlohmann/json.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace Mouse2VR;
+
+namespace {
+
+class IdleInputSource : public IInputSource {
+public:
+    bool Start() override { return true; }
+    void Stop() override {}
+    MouseDelta GetAndResetDeltas() override { return {}; }
+    size_t DrainSamples(InputSample*, size_t) override { return 0; }
+    void SetWakeEvent(WakeEvent*) override {}
+    uint64_t GetSampleCount() const override { return 0; }
+    uint64_t GetMergedSampleCount() const override { return 0; }
+    const char* GetName() const override { return "idle"; }
+};
+
+class NullControllerSink : public IControllerSink {
+public:
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    void SetLeftStick(float, float) override {}
+    void Update() override {}
+    bool IsConnected() const override { return true; }
+    const char* GetName() const override { return "null"; }
+};
+
+// The previous bridge's decoding of one message
+void LegacyDecode(const std::wstring& msg, SettingsChange& change) {
+    if (msg.find(L"setSensitivity:") == 0) {
+        change.sensitivity = static_cast<float>(std::stod(msg.substr(15)));
+    } else if (msg.find(L"setUpdateRate:") == 0) {
+        change.updateRateHz = std::stoi(msg.substr(14));
+    } else if (msg.find(L"setInvertY:") == 0) {
+        change.invertY = msg.substr(11) == L"true";
+    } else if (msg.find(L"setLockX:") == 0) {
+        change.lockX = msg.substr(9) == L"true";
+    } else if (msg.find(L"setDPI:") == 0) {
+        change.countsPerMeter = std::stoi(msg.substr(7)) * 39.3701f;
+    }
+}
+
+nlohmann::json Measure(const char* name, int iterations, const std::function<void(int)>& run) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < iterations; ++i) {
+        int64_t start = InputSampleQueue::NowNs();
+        run(i);
+        histogram.Record(InputSampleQueue::NowNs() - start);
+    }
+    LatencyStats stats = histogram.GetStats();
+    std::fprintf(stderr, "  %-14s p50=%lld ns p99=%lld ns\n", name,
+                 static_cast<long long>(stats.p50Ns), static_cast<long long>(stats.p99Ns));
+    return nlohmann::json{
+        {"case", name},
+        {"iterations", iterations},
+        {"mean_ns", stats.meanNs},
+        {"p50_ns", stats.p50Ns},
+        {"p99_ns", stats.p99Ns},
+        {"max_ns", stats.maxNs}
+    };
+}
+
+std::string BatchedRequest(int i) {
+    return "{\"id\":" + std::to_string(i) + ",\"cmd\":\"set\",\"args\":{\"sensitivity\":" +
+           std::to_string(1.0 + (i % 20) * 0.1) + ",\"dpi\":" + std::to_string(800 + (i % 8) * 100) +
+           ",\"invertY\":" + (i % 2 ? "true" : "false") + ",\"lockX\":true}}";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int decodeIterations = argc > 1 ? std::atoi(argv[1]) : 200000;
+    const int applyIterations = argc > 2 ? std::atoi(argv[2]) : 2000;
+    nlohmann::json results = nlohmann::json::array();
+
+    std::fprintf(stderr, "decoding %d four-setting changes...\n", decodeIterations);
+    results.push_back(Measure("legacy_decode", decodeIterations, [](int i) {
+        const std::wstring messages[] = {
+            L"setSensitivity:" + std::to_wstring(1.0 + (i % 20) * 0.1),
+            L"setDPI:" + std::to_wstring(800 + (i % 8) * 100),
+            std::wstring(L"setInvertY:") + (i % 2 ? L"true" : L"false"),
+            L"setLockX:true"
+        };
+        SettingsChange change;
+        for (const std::wstring& message : messages) {
+            LegacyDecode(message, change);
+        }
+    }));
+    results.push_back(Measure("json_decode", decodeIterations, [](int i) {
+        nlohmann::json request = nlohmann::json::parse(BatchedRequest(i), nullptr, false);
+        SettingsChange change;
+        BridgeError error;
+        ParseSettingsChange(request["args"], change, error);
+    }));
+
+    // The core saves next to the executable; keep whatever was there
+    const std::string configPath = PathUtils::GetExecutablePath("config.json");
+    bool hadConfig = std::filesystem::exists(configPath);
+    std::string savedConfig;
+    if (hadConfig) {
+        std::ifstream file(configPath);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        savedConfig = contents.str();
+    }
+
+    Mouse2VRCore core;
+    if (!core.Initialize(std::make_unique<IdleInputSource>(), std::make_unique<NullControllerSink>())) {
+        std::cerr << "core initialization failed\n";
+        return 1;
+    }
+    BridgeDispatcher bridge(core);
+
+    std::fprintf(stderr, "applying %d four-setting changes...\n", applyIterations);
+    auto applyCase = [&](const char* name, const std::function<void(int)>& run) {
+        ConfigSaveStats saves = core.GetConfigSaveStats();
+        uint64_t publishes = core.GetProcessorConfigVersion();
+        nlohmann::json result = Measure(name, applyIterations, run);
+        core.FlushConfig();
+        ConfigSaveStats after = core.GetConfigSaveStats();
+        result["save_requests_per_change"] = static_cast<double>(after.requests - saves.requests) / applyIterations;
+        result["file_writes"] = after.writes - saves.writes;
+        result["publishes_per_change"] =
+            static_cast<double>(core.GetProcessorConfigVersion() - publishes) / applyIterations;
+        results.push_back(result);
+    };
+    applyCase("legacy_apply", [&](int i) {
+        core.SetSensitivity(1.0 + (i % 20) * 0.1);
+        core.SetCountsPerMeter((800 + (i % 8) * 100) * 39.3701f);
+        core.SetInvertY(i % 2 != 0);
+        core.SetLockX(true);
+    });
+    applyCase("batched_apply", [&](int i) {
+        bridge.Handle(BatchedRequest(i));
+    });
+    applyCase("invalid", [&](int i) {
+        bridge.Handle("{\"id\":" + std::to_string(i) + ",\"cmd\":\"set\",\"args\":{\"sensitivity\":1.5,\"dpi\":99999}}");
+    });
+    core.Shutdown();
+
+    if (hadConfig) {
+        std::ofstream(configPath) << savedConfig;
+    } else {
+        std::filesystem::remove(configPath);
+    }
+
+    std::cout << results.dump(2) << std::endl;
+    return 0;
+}
@@ -0,0 +1,115 @@
+// Controller sink benchmark: cost of one controller report per sink.
+//
+// Sends a walking pattern (the forward axis changes on every report) and
+// times each SetLeftStick() + Update():
+//   - recording: RecordingControllerSink, the in-memory test sink
+//   - batched:   UinputControllerSink writing to /dev/null, one write() per
+//                report (changed axes + SYN_REPORT)
+//   - per_event: the same events with one write() each, as a sink without
+//                batching would issue them
+//   - uinput:    UinputControllerSink on a real /dev/uinput device, when
+//                the process may create one
+//
+// Results go to stdout as a JSON array; progress goes to stderr.
+//
+// Usage: Mouse2VR_SinkBench [reports]
+
+#include "common/LatencyHistogram.h"
+#include "core/InputSampleQueue.h"
+#include "core/RecordingControllerSink.h"
+#include "core/UinputControllerSink.h"
+#include <nlohmann/json.hpp>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fcntl.h>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <unistd.h>
+
+using namespace Mouse2VR;
+
+namespace {
+
+float WalkingStick(int i) {
+    return 0.5f + 0.4f * std::sin(i * 0.01f);
+}
+
+nlohmann::json Measure(const char* name, int reports, const std::function<void(int)>& send) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < reports; ++i) {
+        int64_t start = InputSampleQueue::NowNs();
+        send(i);
+        histogram.Record(InputSampleQueue::NowNs() - start);
+    }
+    LatencyStats stats = histogram.GetStats();
+    std::fprintf(stderr, "  %-10s p50=%lld ns p99=%lld ns\n", name,
+                 static_cast<long long>(stats.p50Ns), static_cast<long long>(stats.p99Ns));
+    return nlohmann::json{
+        {"sink", name},
+        {"reports", reports},
+        {"mean_ns", stats.meanNs},
+        {"p50_ns", stats.p50Ns},
+        {"p99_ns", stats.p99Ns},
+        {"max_ns", stats.maxNs}
+    };
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int reports = argc > 1 ? std::atoi(argv[1]) : 200000;
+    nlohmann::json results = nlohmann::json::array();
+    std::fprintf(stderr, "sending %d reports per sink...\n", reports);
+
+    RecordingControllerSink recording(static_cast<size_t>(reports));
+    results.push_back(Measure("recording", reports, [&](int i) {
+        recording.SetLeftStick(0.0f, WalkingStick(i));
+        recording.Update();
+    }));
+
+    UinputControllerSink batched(open("/dev/null", O_WRONLY | O_CLOEXEC), "/dev/null");
+    batched.Initialize();
+    results.push_back(Measure("batched", reports, [&](int i) {
+        batched.SetLeftStick(0.0f, WalkingStick(i));
+        batched.Update();
+    }));
+    results.back()["writes"] = batched.GetWriteCount();
+    results.back()["events"] = batched.GetEventCount();
+
+    int nullFd = open("/dev/null", O_WRONLY | O_CLOEXEC);
+    uint64_t perEventWrites = 0;
+    results.push_back(Measure("per_event", reports, [&](int i) {
+        input_event events[2] = {};
+        events[0].type = EV_ABS;
+        events[0].code = ABS_Y;
+        events[0].value = UinputControllerSink::FloatToAxis(-WalkingStick(i));
+        events[1].type = EV_SYN;
+        events[1].code = SYN_REPORT;
+        for (const input_event& ev : events) {
+            if (write(nullFd, &ev, sizeof(ev)) == static_cast<ssize_t>(sizeof(ev))) {
+                perEventWrites++;
+            }
+        }
+    }));
+    results.back()["writes"] = perEventWrites;
+    close(nullFd);
+
+    UinputControllerSink device;
+    if (access("/dev/uinput", W_OK) == 0 && device.Initialize()) {
+        results.push_back(Measure("uinput", reports, [&](int i) {
+            device.SetLeftStick(0.0f, WalkingStick(i));
+            device.Update();
+        }));
+        results.back()["writes"] = device.GetWriteCount();
+        results.back()["failed_writes"] = device.GetFailedWriteCount();
+        device.Shutdown();
+    } else {
+        std::fprintf(stderr, "  uinput     skipped (/dev/uinput not writable)\n");
+        results.push_back(nlohmann::json{{"sink", "uinput"}, {"error", "/dev/uinput not writable"}});
+    }
+
+    std::cout << results.dump(2) << std::endl;
+    return 0;
+}
@@ -0,0 +1,79 @@
+// Deadline timer benchmark.
+//
+// Runs a fixed-rate tick loop for each timer strategy and spin tail and
+// reports how late each tick was released (jitter) against the CPU time
+// the waiting thread burned. A tick does no work of its own, so the CPU
+// figure is the cost of waiting alone.
+//
+// Usage: Mouse2VR_TimerBench [rate_hz] [seconds_per_run]
+
+#include "common/DeadlineTimer.h"
+#include "common/LatencyHistogram.h"
+#include "core/ActivityTracker.h"
+#include "core/InputSampleQueue.h"
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+struct RunResult {
+    LatencyStats lateness;
+    double cpuPercent = 0.0;
+};
+
+RunResult Run(TimerStrategy strategy, int64_t spinTailNs, int rateHz, double seconds) {
+    DeadlineTimer timer(strategy);
+    timer.SetSpinTailNs(spinTailNs);
+    LatencyHistogram lateness;
+
+    const int64_t intervalNs = 1000000000LL / rateHz;
+    const int ticks = static_cast<int>(seconds * rateHz);
+    const int64_t wallStart = InputSampleQueue::NowNs();
+    const int64_t cpuStart = ThreadCpuTimeNs();
+    int64_t deadline = wallStart;
+    for (int i = 0; i < ticks; ++i) {
+        deadline += intervalNs;
+        lateness.Record(timer.WaitUntil(deadline));
+    }
+    const int64_t wallNs = InputSampleQueue::NowNs() - wallStart;
+
+    RunResult result;
+    result.lateness = lateness.GetStats();
+    result.cpuPercent = 100.0 * static_cast<double>(ThreadCpuTimeNs() - cpuStart) / static_cast<double>(wallNs);
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int rateHz = argc > 1 ? std::atoi(argv[1]) : 200;
+    const double seconds = argc > 2 ? std::atof(argv[2]) : 2.0;
+
+    struct Config {
+        TimerStrategy strategy;
+        int64_t spinTailNs;
+    };
+    const std::vector<Config> configs = {
+        {TimerStrategy::SleepSpin, DeadlineTimer::DefaultSpinTailNs(TimerStrategy::SleepSpin)},
+        {TimerStrategy::Precise, 0},
+        {TimerStrategy::Precise, 20000},
+        {TimerStrategy::Precise, DeadlineTimer::DefaultSpinTailNs(TimerStrategy::Precise)},
+        {TimerStrategy::Precise, 500000},
+        {TimerStrategy::TimerFd, 0},
+        {TimerStrategy::TimerFd, DeadlineTimer::DefaultSpinTailNs(TimerStrategy::TimerFd)},
+    };
+
+    std::printf("%d Hz ticks, %.1f s per run\n", rateHz, seconds);
+    std::printf("%-12s %10s %10s %10s %10s %10s %8s\n", "strategy", "tail us", "p50 us", "p99 us",
+                "p99.9 us", "max us", "cpu %");
+    for (const Config& config : configs) {
+        RunResult r = Run(config.strategy, config.spinTailNs, rateHz, seconds);
+        std::printf("%-12s %10.0f %10.1f %10.1f %10.1f %10.1f %8.2f\n", TimerStrategyToString(config.strategy),
+                    config.spinTailNs / 1e3, r.lateness.p50Ns / 1e3, r.lateness.p99Ns / 1e3,
+                    r.lateness.p999Ns / 1e3, r.lateness.maxNs / 1e3, r.cpuPercent);
+    }
+    return 0;
+}
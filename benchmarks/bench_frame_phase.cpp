@@ -0,0 +1,181 @@
+// Frame phase benchmark: free-running vs phase-locked output.
+//
+// Runs Mouse2VRCore's fixed-rate scheduler against a synthetic compositor
+// (SyntheticFrameClock) at several update intervals, once free-running and
+// once phase-locked, and timestamps every controller Update(). For each
+// update, the lead is how long before the next vsync it landed; a
+// free-running scheduler beats against the frame rate, so the lead sweeps
+// across the whole frame (judder), while a locked one holds it at the
+// configured lead. Below one update per frame a locked run also alternates
+// fresh and one-frame-old updates by design, which shows up in the age.
+//
+// Reports per run:
+//   - lead before the next vsync per update (min/mean/max/stddev, spread)
+//   - age of the newest update at each vsync (same statistics)
+//   - the core's PhaseStats for the locked run
+//
+// Results go to stdout as a JSON array; progress goes to stderr.
+//
+// Usage: Mouse2VR_FramePhaseBench [seconds_per_run] [frame_hz] [lead_us]
+
+#include "core/ConfigManager.h"
+#include "core/FrameClock.h"
+#include "core/IControllerSink.h"
+#include "core/IInputSource.h"
+#include "core/Mouse2VRCore.h"
+#include "core/RecordingControllerSink.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+// Input source that never produces input
+class IdleInputSource : public IInputSource {
+public:
+    bool Start() override { return true; }
+    void Stop() override {}
+    MouseDelta GetAndResetDeltas() override { return {}; }
+    size_t DrainSamples(InputSample*, size_t) override { return 0; }
+    void SetWakeEvent(WakeEvent*) override {}
+    uint64_t GetSampleCount() const override { return 0; }
+    uint64_t GetMergedSampleCount() const override { return 0; }
+    const char* GetName() const override { return "idle"; }
+};
+
+nlohmann::json Summarize(const std::vector<double>& valuesMs) {
+    if (valuesMs.empty()) {
+        return {{"error", "no samples"}};
+    }
+    double sum = 0.0;
+    for (double value : valuesMs) {
+        sum += value;
+    }
+    double mean = sum / valuesMs.size();
+    double variance = 0.0;
+    for (double value : valuesMs) {
+        variance += (value - mean) * (value - mean);
+    }
+    auto [minIt, maxIt] = std::minmax_element(valuesMs.begin(), valuesMs.end());
+    return nlohmann::json{
+        {"count", valuesMs.size()},
+        {"min_ms", *minIt},
+        {"mean_ms", mean},
+        {"max_ms", *maxIt},
+        {"spread_ms", *maxIt - *minIt},
+        {"stddev_ms", std::sqrt(variance / valuesMs.size())}
+    };
+}
+
+// Time from each update to the vsync that first samples it
+std::vector<double> LeadBeforeVsync(const std::vector<int64_t>& updates, const SyntheticFrameClock& clock,
+                                    int64_t periodNs) {
+    std::vector<double> leads;
+    for (int64_t update : updates) {
+        leads.push_back((clock.LastVsyncAt(update) + periodNs - update) / 1e6);
+    }
+    return leads;
+}
+
+// Age of the newest update at each vsync in the run
+std::vector<double> AgeAtVsync(const std::vector<int64_t>& updates, const SyntheticFrameClock& clock,
+                               int64_t periodNs) {
+    std::vector<double> ages;
+    if (updates.empty()) {
+        return ages;
+    }
+    size_t next = 0;
+    for (int64_t vsync = clock.LastVsyncAt(updates.front()) + periodNs; vsync <= updates.back(); vsync += periodNs) {
+        while (next + 1 < updates.size() && updates[next + 1] <= vsync) {
+            next++;
+        }
+        ages.push_back((vsync - updates[next]) / 1e6);
+    }
+    return ages;
+}
+
+nlohmann::json Run(int updateIntervalMs, bool locked, double seconds, int64_t periodNs, int leadUs) {
+    auto sink = std::make_unique<RecordingControllerSink>(static_cast<size_t>(seconds * 2000) + 1024);
+    RecordingControllerSink* sinkView = sink.get();
+
+    Mouse2VRCore core;
+    if (!core.Initialize(std::make_unique<IdleInputSource>(), std::move(sink))) {
+        return {{"update_interval_ms", updateIntervalMs}, {"error", "initialize failed"}};
+    }
+    AppConfig config;
+    config.updateIntervalMs = updateIntervalMs;
+    config.frameClock.leadUs = leadUs;
+    core.UpdateSettings(config);
+    if (locked) {
+        core.SetFrameClock(std::make_unique<SyntheticFrameClock>(periodNs));
+    }
+    core.Start();
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    core.Stop();
+
+    // Same cadence as the core's clock, used to place vsyncs in both modes
+    SyntheticFrameClock compositor(periodNs);
+    std::vector<int64_t> updates;
+    for (const RecordedReport& report : sinkView->GetReports()) {
+        updates.push_back(report.timestampNs);
+    }
+    nlohmann::json run{
+        {"update_interval_ms", updateIntervalMs},
+        {"mode", locked ? "locked" : "free"},
+        {"updates", updates.size()},
+        {"lead_before_vsync", Summarize(LeadBeforeVsync(updates, compositor, periodNs))},
+        {"age_at_vsync", Summarize(AgeAtVsync(updates, compositor, periodNs))}
+    };
+    if (locked) {
+        PhaseStats phase = core.GetPhaseStats();
+        run["phase"] = nlohmann::json{
+            {"step_ms", phase.stepNs / 1e6},
+            {"locked_ticks", phase.lockedTicks},
+            {"mean_error_us", phase.meanErrorNs / 1e3},
+            {"abs_error_p50_us", phase.absError.p50Ns / 1e3},
+            {"abs_error_p99_us", phase.absError.p99Ns / 1e3},
+            {"abs_error_max_us", phase.absError.maxNs / 1e3}
+        };
+    }
+    return run;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const double seconds = argc > 1 ? std::atof(argv[1]) : 3.0;
+    const int frameHz = argc > 2 ? std::atoi(argv[2]) : 90;
+    const int leadUs = argc > 3 ? std::atoi(argv[3]) : 2000;
+    const int64_t periodNs = 1000000000LL / frameHz;
+
+    // 45, 50, 60, 90 and 125 Hz
+    const int intervalsMs[] = {22, 20, 16, 11, 8};
+
+    nlohmann::json results = nlohmann::json::array();
+    for (int intervalMs : intervalsMs) {
+        for (bool locked : {false, true}) {
+            std::fprintf(stderr, "running %d ms %s against %d Hz for %.1f s...\n",
+                         intervalMs, locked ? "locked" : "free", frameHz, seconds);
+            nlohmann::json run = Run(intervalMs, locked, seconds, periodNs, leadUs);
+            if (run.contains("lead_before_vsync") && run["lead_before_vsync"].contains("spread_ms")) {
+                std::fprintf(stderr, "  lead before vsync mean=%.2f ms stddev=%.2f ms | age at vsync stddev=%.2f ms\n",
+                             run["lead_before_vsync"]["mean_ms"].get<double>(),
+                             run["lead_before_vsync"]["stddev_ms"].get<double>(),
+                             run["age_at_vsync"]["stddev_ms"].get<double>());
+            }
+            results.push_back(std::move(run));
+        }
+    }
+
+    std::cout << results.dump(2) << std::endl;
+    return 0;
+}
@@ -0,0 +1,255 @@
+// High-polling-rate input stress benchmark.
+//
+// Injects mouse reports from one producer thread at 1, 4 and 8 kHz while
+// Mouse2VRCore's ProcessingLoop runs at 200 Hz against a null controller.
+// Reports are fed through the platform's direct injection entry point:
+// RawInputHandler::ProcessRawInputDirect on Windows and
+// EvdevInputSource::ProcessEvents on Linux, so everything after the OS
+// delivery is the production path.
+//
+// Reports per run:
+//   - producer cost per injected event (p50/p99/max/mean)
+//   - consumer drain time per DrainSamples() call
+//   - drain lock wait time and contended acquisitions
+//   - merged samples (ring overflow) and counts lost end to end
+//   - motion-to-output latency from Mouse2VRCore
+//
+// Results go to stdout as a JSON array; progress goes to stderr.
+//
+// Usage: Mouse2VR_InputStressBench [seconds_per_rate] [rate_hz ...]
+
+#include "common/LatencyHistogram.h"
+#include "core/ConfigManager.h"
+#include "core/IControllerSink.h"
+#include "core/IInputSource.h"
+#include "core/Mouse2VRCore.h"
+#include <nlohmann/json.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#include "core/RawInputHandler.h"
+#else
+#include "core/EvdevInputSource.h"
+#include <unistd.h>
+#endif
+
+using namespace Mouse2VR;
+
+namespace {
+
+// Controller sink that discards reports
+class NullControllerSink : public IControllerSink {
+public:
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    void SetLeftStick(float, float) override {}
+    void Update() override { m_updates.fetch_add(1, std::memory_order_relaxed); }
+    bool IsConnected() const override { return true; }
+    const char* GetName() const override { return "null"; }
+
+    uint64_t GetUpdateCount() const { return m_updates.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<uint64_t> m_updates{0};
+};
+
+// Times every DrainSamples() call and totals the counts it returns
+class TimedInputSource : public IInputSource {
+public:
+    explicit TimedInputSource(std::unique_ptr<IInputSource> inner)
+        : m_inner(std::move(inner)) {}
+
+    bool Start() override { return m_inner->Start(); }
+    void Stop() override { m_inner->Stop(); }
+    MouseDelta GetAndResetDeltas() override { return m_inner->GetAndResetDeltas(); }
+
+    size_t DrainSamples(InputSample* out, size_t maxCount) override {
+        int64_t start = InputSampleQueue::NowNs();
+        size_t count = m_inner->DrainSamples(out, maxCount);
+        m_drainTime.Record(InputSampleQueue::NowNs() - start);
+        for (size_t i = 0; i < count; ++i) {
+            m_drainedY.fetch_add(out[i].dy, std::memory_order_relaxed);
+        }
+        return count;
+    }
+
+    void SetWakeEvent(WakeEvent* wake) override { m_inner->SetWakeEvent(wake); }
+    uint64_t GetSampleCount() const override { return m_inner->GetSampleCount(); }
+    uint64_t GetMergedSampleCount() const override { return m_inner->GetMergedSampleCount(); }
+    const char* GetName() const override { return m_inner->GetName(); }
+
+    const LatencyHistogram& GetDrainTime() const { return m_drainTime; }
+    int64_t GetDrainedY() const { return m_drainedY.load(std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<IInputSource> m_inner;
+    LatencyHistogram m_drainTime;
+    std::atomic<int64_t> m_drainedY{0};
+};
+
+// Platform injection entry point
+#ifdef _WIN32
+struct Injector {
+    RawInputHandler* handler = nullptr;
+
+    static std::unique_ptr<IInputSource> Create(Injector& injector) {
+        auto handler = std::make_unique<RawInputHandler>();
+        injector.handler = handler.get();
+        return handler;
+    }
+
+    void Inject(int32_t dy) {
+        RAWINPUT raw = {};
+        raw.header.dwType = RIM_TYPEMOUSE;
+        raw.data.mouse.lLastY = dy;
+        handler->ProcessRawInputDirect(&raw);
+    }
+
+    int64_t GetLockWaitNs() const { return handler->GetDrainLockWaitNs(); }
+    uint64_t GetLockContentions() const { return handler->GetDrainLockContentionCount(); }
+};
+#else
+struct Injector {
+    EvdevInputSource* source = nullptr;
+    int idleFds[2] = {-1, -1};  // Reader thread waits on a pipe that never carries data
+
+    static std::unique_ptr<IInputSource> Create(Injector& injector) {
+        if (pipe(injector.idleFds) != 0) {
+            return nullptr;
+        }
+        auto source = std::make_unique<EvdevInputSource>(injector.idleFds[0], "stress");
+        injector.source = source.get();
+        return source;
+    }
+
+    ~Injector() {
+        if (idleFds[1] >= 0) {
+            close(idleFds[1]);
+        }
+    }
+
+    void Inject(int32_t dy) {
+        input_event events[2] = {};
+        events[0].type = EV_REL;
+        events[0].code = REL_Y;
+        events[0].value = dy;
+        events[1].type = EV_SYN;
+        events[1].code = SYN_REPORT;
+        source->ProcessEvents(events, 2);
+    }
+
+    int64_t GetLockWaitNs() const { return source->GetDrainLockWaitNs(); }
+    uint64_t GetLockContentions() const { return source->GetDrainLockContentionCount(); }
+};
+#endif
+
+nlohmann::json StatsToJson(const LatencyStats& stats) {
+    return nlohmann::json{
+        {"count", stats.count},
+        {"mean_ns", stats.meanNs},
+        {"p50_ns", stats.p50Ns},
+        {"p99_ns", stats.p99Ns},
+        {"p999_ns", stats.p999Ns},
+        {"max_ns", stats.maxNs}
+    };
+}
+
+nlohmann::json RunAtRate(int rateHz, double seconds) {
+    Injector injector;
+    auto timedSource = std::make_unique<TimedInputSource>(Injector::Create(injector));
+    TimedInputSource* source = timedSource.get();
+    auto nullSink = std::make_unique<NullControllerSink>();
+    NullControllerSink* sink = nullSink.get();
+
+    Mouse2VRCore core;
+    if (!core.Initialize(std::move(timedSource), std::move(nullSink))) {
+        return {{"rate_hz", rateHz}, {"error", "initialize failed"}};
+    }
+    AppConfig config;
+    config.updateIntervalMs = 5;  // 200 Hz
+    core.UpdateSettings(config);
+    core.Start();
+
+    // === Producer: paced injection, timing each call ===
+    LatencyHistogram producerCost;
+    const int64_t intervalNs = 1000000000LL / rateHz;
+    const int64_t totalEvents = static_cast<int64_t>(seconds * rateHz);
+    int64_t injectedY = 0;
+    int64_t next = InputSampleQueue::NowNs();
+    const int64_t runStart = next;
+
+    for (int64_t i = 0; i < totalEvents; ++i) {
+        while (InputSampleQueue::NowNs() < next) {
+            std::this_thread::yield();
+        }
+        int32_t dy = 1 + static_cast<int32_t>(i % 3);
+        int64_t start = InputSampleQueue::NowNs();
+        injector.Inject(dy);
+        producerCost.Record(InputSampleQueue::NowNs() - start);
+        injectedY += dy;
+        next += intervalNs;
+    }
+    const double elapsed = (InputSampleQueue::NowNs() - runStart) / 1e9;
+
+    // Let the last tick pick up the tail
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    core.Stop();
+
+    const int64_t drainedY = source->GetDrainedY();
+    return nlohmann::json{
+        {"rate_hz", rateHz},
+        {"events", totalEvents},
+        {"seconds", elapsed},
+        {"achieved_rate_hz", totalEvents / elapsed},
+        {"output_updates", sink->GetUpdateCount()},
+        {"producer_cost", StatsToJson(producerCost.GetStats())},
+        {"drain_call", StatsToJson(source->GetDrainTime().GetStats())},
+        {"lock_wait_ns", injector.GetLockWaitNs()},
+        {"lock_contentions", injector.GetLockContentions()},
+        {"merged_samples", source->GetMergedSampleCount()},
+        {"counts_injected", injectedY},
+        {"counts_lost", injectedY - drainedY},
+        {"motion_to_output", StatsToJson(core.GetLatencyStats())}
+    };
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const double seconds = argc > 1 ? std::atof(argv[1]) : 3.0;
+    std::vector<int> rates;
+    for (int i = 2; i < argc; ++i) {
+        rates.push_back(std::atoi(argv[i]));
+    }
+    if (rates.empty()) {
+        rates = {1000, 4000, 8000};
+    }
+
+    nlohmann::json results = nlohmann::json::array();
+    for (int rate : rates) {
+        std::fprintf(stderr, "running %d Hz for %.1f s...\n", rate, seconds);
+        nlohmann::json run = RunAtRate(rate, seconds);
+        if (run.contains("producer_cost")) {
+            std::fprintf(stderr, "  producer p50=%lld ns p99=%lld ns | drain p99=%lld ns | "
+                         "lock wait=%lld ns | merged=%llu lost=%lld\n",
+                         run["producer_cost"]["p50_ns"].get<long long>(),
+                         run["producer_cost"]["p99_ns"].get<long long>(),
+                         run["drain_call"]["p99_ns"].get<long long>(),
+                         run["lock_wait_ns"].get<long long>(),
+                         run["merged_samples"].get<unsigned long long>(),
+                         run["counts_lost"].get<long long>());
+        }
+        results.push_back(std::move(run));
+    }
+
+    std::cout << results.dump(2) << std::endl;
+    return 0;
+}
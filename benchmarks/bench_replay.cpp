@@ -0,0 +1,120 @@
+// Replay throughput benchmark.
+//
+// Writes a synthetic one-hour session (1 kHz input, 200 Hz ticks) and
+// measures how long ReplayEngine takes to push it through InputProcessor.
+//
+// Usage: Mouse2VR_ReplayBench [minutes] [input_hz]
+
+#include "core/SessionFormat.h"
+#include "core/SessionReplay.h"
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+bool WriteSyntheticSession(const std::string& path, int minutes, int inputHz, int tickHz) {
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        return false;
+    }
+
+    SessionHeader header = SessionHeader::Create(ProcessingConfig{}, tickHz, 0);
+    const int64_t totalSamples = static_cast<int64_t>(minutes) * 60 * inputHz;
+    const int64_t sampleIntervalNs = 1000000000LL / inputHz;
+    const int64_t tickIntervalNs = 1000000000LL / tickHz;
+    const float tickSeconds = 1.0f / static_cast<float>(tickHz);
+
+    std::fwrite(&header, sizeof(header), 1, f);
+
+    std::vector<SessionRecord> chunk;
+    chunk.reserve(1 << 16);
+    uint64_t written = 0;
+    int64_t nextTickNs = tickIntervalNs;
+    MouseDelta pending;
+
+    auto flush = [&]() {
+        std::fwrite(chunk.data(), sizeof(SessionRecord), chunk.size(), f);
+        written += chunk.size();
+        chunk.clear();
+    };
+
+    for (int64_t i = 0; i < totalSamples; ++i) {
+        const int64_t t = i * sampleIntervalNs;
+        while (t >= nextTickNs) {
+            SessionRecord tick;
+            tick.timestampNs = nextTickNs;
+            tick.dx = static_cast<int32_t>(pending.x);
+            tick.dy = static_cast<int32_t>(pending.y);
+            tick.kind = SessionRecordKind::Tick;
+            tick.tickSeconds = tickSeconds;
+            chunk.push_back(tick);
+            pending.reset();
+            nextTickNs += tickIntervalNs;
+        }
+
+        // Walking pace wobble: 1-3 counts per report
+        SessionRecord sample;
+        sample.timestampNs = t;
+        sample.dy = 1 + static_cast<int32_t>((i / 97) % 3);
+        chunk.push_back(sample);
+        pending.y += sample.dy;
+
+        if (chunk.size() >= (1 << 16) - 8) {
+            flush();
+        }
+    }
+    flush();
+
+    header.recordCount = written;
+    std::fseek(f, 0, SEEK_SET);
+    std::fwrite(&header, sizeof(header), 1, f);
+    std::fclose(f);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int minutes = argc > 1 ? std::atoi(argv[1]) : 60;
+    const int inputHz = argc > 2 ? std::atoi(argv[2]) : 1000;
+    const int tickHz = 200;
+
+    const std::string path = (std::filesystem::temp_directory_path() / "m2vr_replay_bench.m2vr").string();
+    if (!WriteSyntheticSession(path, minutes, inputHz, tickHz)) {
+        std::fprintf(stderr, "Failed to write %s\n", path.c_str());
+        return 1;
+    }
+
+    MappedSession session;
+    if (!session.Open(path)) {
+        std::fprintf(stderr, "Failed to map %s\n", path.c_str());
+        return 1;
+    }
+
+    // Exact replay of the recorded ticks, then a resample to 90 Hz
+    ReplayStatsSink exactSink;
+    ReplayResult exact = ReplayEngine::Run(session, exactSink);
+
+    ReplayOptions resample;
+    resample.tickRateHz = 90;
+    ReplayStatsSink resampleSink;
+    ReplayResult resampled = ReplayEngine::Run(session, resampleSink, resample);
+
+    std::printf("session: %d min, %d Hz input, %zu records\n",
+                minutes, inputHz, session.GetRecordCount());
+    std::printf("exact:     %llu ticks in %.3f s (%.0fx realtime)\n",
+                static_cast<unsigned long long>(exact.ticks), exact.wallSeconds,
+                exact.sessionSeconds / exact.wallSeconds);
+    std::printf("resampled: %llu ticks in %.3f s (%.0fx realtime)\n",
+                static_cast<unsigned long long>(resampled.ticks), resampled.wallSeconds,
+                resampled.sessionSeconds / resampled.wallSeconds);
+
+    session.Close();
+    std::filesystem::remove(path);
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Response curve benchmark.
+//
+// For each curve type, measures the cost of the compiled table lookup
+// (what runs per tick), the cost of evaluating the curve directly, the
+// one-off Compile() time, and the largest table error over the input range.
+// A final row runs InputProcessor::ProcessDelta with a spline curve against
+// the linear mapping.
+//
+// Usage: Mouse2VR_CurveBench [evaluations]
+
+#include "core/InputProcessor.h"
+#include "core/ResponseCurve.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+ResponseCurveConfig MakeCurve(ResponseCurveType type) {
+    ResponseCurveConfig config;
+    config.type = type;
+    config.gamma = 0.6f;
+    // 32 points of a walk/run profile
+    for (int i = 1; i <= 32; ++i) {
+        float input = static_cast<float>(i) / 32.0f;
+        config.points.push_back({input, std::min(1.0f, 1.6f * std::sqrt(input) - 0.3f * input)});
+    }
+    return config;
+}
+
+template <typename Fn>
+double NsPerCall(Fn&& fn, int evaluations) {
+    float sink = 0.0f;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < evaluations; ++i) {
+        sink += fn(static_cast<float>(i & 4095) / 4096.0f);
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (sink == 12345.0f) {
+        std::printf(" ");  // Keep the loop from being optimized away
+    }
+    return ns / evaluations;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int evaluations = argc > 1 ? std::atoi(argv[1]) : 20000000;
+
+    std::printf("%-10s %12s %12s %12s %12s\n", "curve", "lut ns", "exact ns", "compile us", "max error");
+    for (ResponseCurveType type : {ResponseCurveType::Piecewise, ResponseCurveType::Spline,
+                                   ResponseCurveType::Gamma}) {
+        ResponseCurveConfig config = MakeCurve(type);
+        ResponseCurve curve;
+        auto compileStart = std::chrono::steady_clock::now();
+        curve.Compile(config);
+        double compileUs = std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - compileStart).count();
+
+        double lut = NsPerCall([&](float v) { return curve.Evaluate(v); }, evaluations);
+        double exact = NsPerCall([&](float v) { return curve.EvaluateExact(v); }, evaluations / 10);
+
+        float maxError = 0.0f;
+        for (int i = 0; i <= 100000; ++i) {
+            float v = static_cast<float>(i) / 100000.0f;
+            maxError = std::max(maxError, std::abs(curve.Evaluate(v) - curve.EvaluateExact(v)));
+        }
+        std::printf("%-10s %12.2f %12.2f %12.1f %12.2e\n", ResponseCurveTypeToString(type),
+                    lut, exact, compileUs, maxError);
+    }
+
+    // Whole ProcessDelta with and without a curve
+    for (ResponseCurveType type : {ResponseCurveType::Linear, ResponseCurveType::Spline}) {
+        ProcessingConfig config;
+        config.curve = MakeCurve(type);
+        InputProcessor processor;
+        processor.SetConfig(config);
+        double ns = NsPerCall([&](float v) {
+            float x, y;
+            processor.ProcessDelta(MouseDelta{0, static_cast<long>(v * 300.0f)}, 0.005f, x, y);
+            return y;
+        }, evaluations / 4);
+        std::printf("ProcessDelta %-8s %8.2f ns/tick\n", ResponseCurveTypeToString(type), ns);
+    }
+    return 0;
+}
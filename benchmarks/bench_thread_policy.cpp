@@ -0,0 +1,163 @@
+// Thread policy benchmark: missed frames under CPU contention.
+//
+// Runs Mouse2VRCore's fixed-rate scheduler while background threads keep
+// every CPU busy at normal priority, first with the default thread policy
+// and then with the requested one, and reports the missed-frame delta and
+// tick lateness of each run together with the policy the OS actually
+// applied. Real-time classes need CAP_SYS_NICE or RLIMIT_RTPRIO; without
+// them the second run reports the failure and behaves like the first.
+//
+// Results go to stdout as a JSON array; progress goes to stderr.
+//
+// Usage: Mouse2VR_ThreadPolicyBench [seconds_per_run] [scheduler] [rt_priority] [hog_threads] [lock_memory]
+//   scheduler: normal | fifo | rr (default fifo)
+
+#include "common/ThreadPolicy.h"
+#include "core/ConfigManager.h"
+#include "core/IControllerSink.h"
+#include "core/IInputSource.h"
+#include "core/Mouse2VRCore.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+class IdleInputSource : public IInputSource {
+public:
+    bool Start() override { return true; }
+    void Stop() override {}
+    MouseDelta GetAndResetDeltas() override { return {}; }
+    size_t DrainSamples(InputSample*, size_t) override { return 0; }
+    void SetWakeEvent(WakeEvent*) override {}
+    uint64_t GetSampleCount() const override { return 0; }
+    uint64_t GetMergedSampleCount() const override { return 0; }
+    const char* GetName() const override { return "idle"; }
+};
+
+class NullControllerSink : public IControllerSink {
+public:
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    void SetLeftStick(float, float) override {}
+    void Update() override {}
+    bool IsConnected() const override { return true; }
+    const char* GetName() const override { return "null"; }
+};
+
+// Busy threads competing with the scheduler for every CPU
+class CpuHogs {
+public:
+    explicit CpuHogs(int count) {
+        for (int i = 0; i < count; ++i) {
+            m_threads.emplace_back([this] {
+                volatile uint64_t sink = 0;
+                while (!m_stop.load(std::memory_order_relaxed)) {
+                    sink = sink + 1;
+                }
+            });
+        }
+    }
+
+    ~CpuHogs() {
+        m_stop = true;
+        for (std::thread& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+private:
+    std::atomic<bool> m_stop{false};
+    std::vector<std::thread> m_threads;
+};
+
+nlohmann::json PolicyToJson(const AppliedThreadPolicy& policy) {
+    return nlohmann::json{
+        {"applied", policy.applied},
+        {"scheduler", ThreadSchedulerToString(policy.scheduler)},
+        {"realtime_priority", policy.realtimePriority},
+        {"priority", ThreadPriorityToString(policy.priority)},
+        {"affinity_mask", policy.affinityMask},
+        {"failures", policy.failures}
+    };
+}
+
+nlohmann::json Run(const ThreadPolicyConfig& policy, bool lockMemory, double seconds, int hogThreads) {
+    Mouse2VRCore core;
+    if (!core.Initialize(std::make_unique<IdleInputSource>(), std::make_unique<NullControllerSink>())) {
+        return {{"error", "initialize failed"}};
+    }
+    AppConfig config;
+    config.updateIntervalMs = 5;  // 200 Hz
+    config.processingThread = policy;
+    config.lockMemory = lockMemory;
+    core.UpdateSettings(config);
+
+    CpuHogs hogs(hogThreads);
+    core.Start();
+    // Skip start-up, then measure a clean window
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    core.ResetSchedulerStats();
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    SchedulerStats stats = core.GetSchedulerStats();
+    ThreadPolicyReport report = core.GetThreadPolicyReport();
+    core.Stop();
+
+    return nlohmann::json{
+        {"requested_scheduler", ThreadSchedulerToString(policy.scheduler)},
+        {"applied", PolicyToJson(report.processing)},
+        {"memory_locked", report.memoryLocked},
+        {"ticks", stats.ticks},
+        {"missed_frames", stats.missedFrames},
+        {"lateness_p50_ns", stats.lateness.p50Ns},
+        {"lateness_p99_ns", stats.lateness.p99Ns},
+        {"lateness_max_ns", stats.lateness.maxNs}
+    };
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const double seconds = argc > 1 ? std::atof(argv[1]) : 3.0;
+    ThreadPolicyConfig requested;
+    requested.scheduler = ThreadSchedulerFromString(argc > 2 ? argv[2] : "fifo");
+    requested.realtimePriority = argc > 3 ? std::atoi(argv[3]) : 50;
+    const int hardware = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    const int hogThreads = argc > 4 ? std::atoi(argv[4]) : hardware * 2;
+    const bool lockMemory = argc > 5 && std::atoi(argv[5]) != 0;
+
+    nlohmann::json results = nlohmann::json::array();
+    nlohmann::json baseline;
+    for (bool withPolicy : {false, true}) {
+        std::fprintf(stderr, "running %s policy with %d hog threads for %.1f s...\n",
+                     withPolicy ? ThreadSchedulerToString(requested.scheduler) : "default", hogThreads, seconds);
+        nlohmann::json run = Run(withPolicy ? requested : ThreadPolicyConfig{}, withPolicy && lockMemory,
+                                 seconds, hogThreads);
+        if (run.contains("missed_frames")) {
+            std::fprintf(stderr, "  missed=%llu lateness p99=%lld ns | applied %s %s\n",
+                         run["missed_frames"].get<unsigned long long>(),
+                         run["lateness_p99_ns"].get<long long>(),
+                         run["applied"]["scheduler"].get<std::string>().c_str(),
+                         run["applied"]["failures"].get<std::string>().c_str());
+        }
+        if (!withPolicy) {
+            baseline = run;
+        } else if (baseline.contains("missed_frames") && run.contains("missed_frames")) {
+            run["missed_frames_delta"] = run["missed_frames"].get<long long>() - baseline["missed_frames"].get<long long>();
+        }
+        results.push_back(std::move(run));
+    }
+
+    std::cout << results.dump(2) << std::endl;
+    return 0;
+}
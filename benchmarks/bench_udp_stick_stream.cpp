@@ -0,0 +1,152 @@
+// UDP stick stream benchmark: UdpStickSink -> StickStateReceiver on loopback.
+//
+// Runs a receiver thread blocked in Wait() against a sink on the main
+// thread, in two modes:
+//   - throughput: reports sent back to back, as fast as send() returns
+//   - paced:      reports at a fixed tick rate, as the core sends them
+//
+// Reports per run:
+//   - packets sent / received per second, loss, reordering, failed sends
+//   - transit time (arrival minus sender timestamp; same clock on loopback)
+//   - heap allocations per packet during the run (sender and receiver
+//     threads together; expected 0)
+//
+// Results go to stdout as a JSON array; progress goes to stderr.
+//
+// Usage: Mouse2VR_UdpStreamBench [packets] [paced_hz]
+
+#include "common/DeadlineTimer.h"
+#include "core/InputSampleQueue.h"
+#include "core/UdpStickStream.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <thread>
+
+namespace {
+
+std::atomic<uint64_t> g_allocations{0};
+
+} // namespace
+
+// Counting allocator: every replaceable form that is not aligned goes
+// through malloc/free (the aligned forms keep their default pairing)
+void* operator new(std::size_t size) {
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+// GCC sees free() behind delete once these are inlined and reports it as
+// mismatched with new, although both sides are malloc-based here
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+using namespace Mouse2VR;
+
+namespace {
+
+nlohmann::json Run(const char* mode, int packets, int pacedHz) {
+    StickStateReceiver receiver(0, "127.0.0.1");
+    UdpStickSink sink("127.0.0.1", receiver.GetPort());
+    if (!receiver.IsOpen() || !sink.Initialize()) {
+        return nlohmann::json{{"mode", mode}, {"error", "loopback socket unavailable"}};
+    }
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> ready{false};
+    std::thread receiverThread([&] {
+        ready.store(true);
+        while (!stop.load(std::memory_order_relaxed)) {
+            receiver.Wait(10);
+        }
+        receiver.Poll();
+    });
+    while (!ready.load()) {
+        std::this_thread::yield();
+    }
+
+    DeadlineTimer timer;
+    const int64_t periodNs = pacedHz > 0 ? 1000000000LL / pacedHz : 0;
+    uint64_t allocationsBefore = g_allocations.load();
+    int64_t startNs = InputSampleQueue::NowNs();
+    for (int i = 0; i < packets; ++i) {
+        if (periodNs > 0) {
+            timer.WaitUntil(startNs + i * periodNs);
+        }
+        float walk = 0.5f + 0.4f * std::sin(i * 0.01f);
+        sink.SetSpeed(walk * 2.0f);
+        sink.SetLeftStick(0.0f, walk);
+        sink.Update();
+    }
+    int64_t sendNs = InputSampleQueue::NowNs() - startNs;
+
+    // Let the receiver drain whatever is still queued
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    uint64_t allocations = g_allocations.load() - allocationsBefore;
+    stop.store(true);
+    receiverThread.join();
+
+    const StickStreamStats& stats = receiver.GetStats();
+    LatencyStats transit = receiver.GetTransitStats();
+    double seconds = sendNs / 1e9;
+    std::fprintf(stderr, "  %-10s %.0f pkt/s sent, received %llu/%d, lost %llu, transit p50=%lld ns p99=%lld ns\n",
+                 mode, packets / seconds, static_cast<unsigned long long>(stats.received), packets,
+                 static_cast<unsigned long long>(stats.lost),
+                 static_cast<long long>(transit.p50Ns), static_cast<long long>(transit.p99Ns));
+    return nlohmann::json{
+        {"mode", mode},
+        {"packets", packets},
+        {"rate_hz", pacedHz},
+        {"send_packets_per_sec", packets / seconds},
+        {"sent", sink.GetSentCount()},
+        {"failed_sends", sink.GetFailedSendCount()},
+        {"received", stats.received},
+        {"lost", stats.lost},
+        {"reordered", stats.reordered},
+        {"duplicates", stats.duplicates},
+        {"transit_p50_ns", transit.p50Ns},
+        {"transit_p99_ns", transit.p99Ns},
+        {"transit_max_ns", transit.maxNs},
+        {"allocations_per_packet", static_cast<double>(allocations) / packets}
+    };
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const int packets = argc > 1 ? std::atoi(argv[1]) : 200000;
+    const int pacedHz = argc > 2 ? std::atoi(argv[2]) : 1000;
+    nlohmann::json results = nlohmann::json::array();
+
+    std::fprintf(stderr, "streaming %d packets over loopback...\n", packets);
+    results.push_back(Run("throughput", packets, 0));
+
+    const int pacedPackets = std::max(1, std::min(packets, pacedHz * 5));
+    std::fprintf(stderr, "streaming %d packets at %d Hz...\n", pacedPackets, pacedHz);
+    results.push_back(Run("paced", pacedPackets, pacedHz));
+
+    std::cout << results.dump(2) << std::endl;
+    return 0;
+}
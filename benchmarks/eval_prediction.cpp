@@ -0,0 +1,228 @@
+// Prediction error evaluation.
+//
+// Replays a session through InputProcessor with prediction off and on and
+// compares every published speed against the true belt speed one horizon
+// later, i.e. the speed the game should be showing by the time our output
+// reaches it. The true speed comes from the raw sample records: counts that
+// arrived in the tick-length window ending at (tick time + horizon).
+//
+// Without a session argument a synthetic walk is generated: start from
+// standstill, ramp up, gait-modulated cruising, slow down, and an abrupt
+// stop from speed, repeated.
+//
+// Reports per horizon:
+//   - RMSE and p99 absolute error (m/s) without and with prediction
+//   - stop overshoot: the largest speed published on a tick whose own
+//     window already saw the belt stopped (and stays stopped until display)
+//
+// Usage: Mouse2VR_PredictionEval [session.m2vr|-] [tick_rate_hz] [horizon_ms ...]
+
+#include "core/SessionFormat.h"
+#include "core/SessionReplay.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+constexpr float kCountsPerMeter = 39370.1f;
+
+// Belt speed (m/s) of the synthetic walk at time t
+double SyntheticSpeed(double t) {
+    const double kPi = 3.14159265358979;
+    const double cycle = 8.0;
+    double phase = std::fmod(t, cycle);
+    if (phase < 1.0) return 0.0;                                  // Standing
+    if (phase < 2.5) return 1.5 * (phase - 1.0) / 1.5;            // Ramp up
+    double gait = 1.0 + 0.2 * std::sin(2.0 * kPi * 1.8 * phase);  // Stride modulation
+    if (phase < 5.5) return 1.5 * gait;                           // Cruise
+    if (phase < 6.3) return (1.5 - 0.375 * (phase - 5.5)) * gait; // Slow down to 1.2
+    return 0.0;                                                   // Abrupt stop
+}
+
+// 1 kHz reports with count quantization, written straight to disk
+bool WriteSyntheticSession(const std::string& path, double seconds) {
+    ProcessingConfig config;
+    config.countsPerMeter = kCountsPerMeter;
+    config.velocity.filter = VelocityFilter::OneEuro;
+    SessionHeader header = SessionHeader::Create(config, 90, 0);
+
+    std::vector<SessionRecord> records;
+    double position = 0.0;
+    long reported = 0;
+    for (int64_t i = 0; i < static_cast<int64_t>(seconds * 1000.0); ++i) {
+        double t = i / 1000.0;
+        position += SyntheticSpeed(t) * kCountsPerMeter * 0.001;
+        long counts = static_cast<long>(position) - reported;
+        reported += counts;
+        if (counts == 0) {
+            continue;
+        }
+        SessionRecord record;
+        record.timestampNs = i * 1000000;
+        record.dy = static_cast<int32_t>(counts);
+        records.push_back(record);
+    }
+    header.recordCount = records.size();
+
+    FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f) {
+        return false;
+    }
+    std::fwrite(&header, sizeof(header), 1, f);
+    std::fwrite(records.data(), sizeof(SessionRecord), records.size(), f);
+    std::fclose(f);
+    return true;
+}
+
+class SpeedTraceSink : public IReplaySink {
+public:
+    void OnTick(int64_t timestampNs, float, float, float speed) override {
+        timestamps.push_back(timestampNs);
+        speeds.push_back(speed);
+    }
+    std::vector<int64_t> timestamps;
+    std::vector<float> speeds;
+};
+
+// True game speed from the raw samples, averaged over a window
+class GroundTruth {
+public:
+    GroundTruth(const MappedSession& session, float metersPerCount) : m_metersPerCount(metersPerCount) {
+        const SessionRecord* records = session.GetRecords();
+        int64_t total = 0;
+        for (size_t i = 0; i < session.GetRecordCount(); ++i) {
+            if (records[i].kind != SessionRecordKind::Sample) {
+                continue;
+            }
+            total += records[i].dy;
+            m_timestamps.push_back(records[i].timestampNs);
+            m_cumulative.push_back(total);
+        }
+    }
+
+    // Speed over [endNs - windowNs, endNs)
+    double SpeedAt(int64_t endNs, int64_t windowNs) const {
+        double counts = static_cast<double>(CountsBefore(endNs) - CountsBefore(endNs - windowNs));
+        return std::abs(counts) * m_metersPerCount / (windowNs / 1e9);
+    }
+
+    int64_t LastTimestamp() const { return m_timestamps.empty() ? 0 : m_timestamps.back(); }
+
+private:
+    int64_t CountsBefore(int64_t ns) const {
+        auto it = std::lower_bound(m_timestamps.begin(), m_timestamps.end(), ns);
+        return it == m_timestamps.begin() ? 0 : m_cumulative[static_cast<size_t>(it - m_timestamps.begin()) - 1];
+    }
+
+    float m_metersPerCount;
+    std::vector<int64_t> m_timestamps;
+    std::vector<int64_t> m_cumulative;
+};
+
+struct ErrorStats {
+    double rmse = 0.0;
+    double p99 = 0.0;
+    double stopOvershoot = 0.0;
+};
+
+ErrorStats Evaluate(const MappedSession& session, const ProcessingConfig& config, int tickRateHz,
+                    float horizonMs, const GroundTruth& truth) {
+    InputProcessor processor;
+    processor.SetConfig(config);
+    SpeedTraceSink sink;
+    ReplayOptions options;
+    options.tickRateHz = tickRateHz;
+    ReplayEngine::Run(session, processor, sink, options);
+
+    const int64_t windowNs = 1000000000LL / tickRateHz;
+    const int64_t horizonNs = static_cast<int64_t>(horizonMs * 1e6);
+    std::vector<double> errors;
+    ErrorStats stats;
+    double sumSq = 0.0;
+    for (size_t i = 0; i < sink.timestamps.size(); ++i) {
+        int64_t displayNs = sink.timestamps[i] + horizonNs;
+        if (displayNs > truth.LastTimestamp()) {
+            break;
+        }
+        double future = truth.SpeedAt(displayNs, windowNs) * config.sensitivity;
+        double error = sink.speeds[i] - future;
+        errors.push_back(std::abs(error));
+        sumSq += error * error;
+        if (future == 0.0 && truth.SpeedAt(sink.timestamps[i], windowNs) == 0.0) {
+            stats.stopOvershoot = std::max(stats.stopOvershoot, static_cast<double>(sink.speeds[i]));
+        }
+    }
+    if (errors.empty()) {
+        return stats;
+    }
+    stats.rmse = std::sqrt(sumSq / errors.size());
+    std::sort(errors.begin(), errors.end());
+    stats.p99 = errors[std::min(errors.size() - 1, static_cast<size_t>(errors.size() * 0.99))];
+    return stats;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string path = argc > 1 ? argv[1] : "-";
+    const int tickRateHz = argc > 2 ? std::atoi(argv[2]) : 90;
+    std::vector<float> horizons;
+    for (int i = 3; i < argc; ++i) {
+        horizons.push_back(static_cast<float>(std::atof(argv[i])));
+    }
+    if (horizons.empty()) {
+        horizons = {10.0f, 20.0f, 30.0f, 50.0f};
+    }
+
+    bool synthetic = path == "-";
+    if (synthetic) {
+        path = (std::filesystem::temp_directory_path() /
+                ("m2vr_prediction_" + std::to_string(
+                    std::chrono::steady_clock::now().time_since_epoch().count()) + ".m2vr")).string();
+        if (!WriteSyntheticSession(path, 120.0)) {
+            std::fprintf(stderr, "failed to write synthetic session\n");
+            return 1;
+        }
+    }
+
+    MappedSession session;
+    if (!session.Open(path)) {
+        std::fprintf(stderr, "failed to open %s\n", path.c_str());
+        return 1;
+    }
+    const ProcessingConfig recorded = session.GetHeader().ToProcessingConfig();
+    GroundTruth truth(session, 1.0f / recorded.countsPerMeter);
+
+    std::printf("session: %s, %zu records, filter %s, %d Hz ticks\n",
+                synthetic ? "synthetic walk" : path.c_str(), session.GetRecordCount(),
+                VelocityFilterToString(recorded.velocity.filter), tickRateHz);
+    std::printf("%-8s %12s %12s %12s %12s %12s %12s\n", "horizon", "rmse off", "rmse on",
+                "p99 off", "p99 on", "stop off", "stop on");
+
+    for (float horizonMs : horizons) {
+        ProcessingConfig off = recorded;
+        off.prediction.enabled = false;
+        ProcessingConfig on = recorded;
+        on.prediction.enabled = true;
+        on.prediction.horizonMs = horizonMs;
+
+        ErrorStats base = Evaluate(session, off, tickRateHz, horizonMs, truth);
+        ErrorStats pred = Evaluate(session, on, tickRateHz, horizonMs, truth);
+        std::printf("%-6.0fms %12.4f %12.4f %12.4f %12.4f %12.4f %12.4f\n", horizonMs,
+                    base.rmse, pred.rmse, base.p99, pred.p99, base.stopOvershoot, pred.stopOvershoot);
+    }
+
+    session.Close();
+    if (synthetic) {
+        std::filesystem::remove(path);
+    }
+    return 0;
+}
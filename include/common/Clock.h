@@ -0,0 +1,76 @@
+#pragma once
+#include "common/IClock.h"
+#include "common/WakeEvent.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+
+namespace Mouse2VR {
+
+// The steady clock (InputSampleQueue::NowNs() time base); waits sleep on
+// the caller's DeadlineTimer and WakeEvent
+class SystemClock : public IClock {
+public:
+    int64_t NowNs() override;
+    int64_t WaitUntil(int64_t deadlineNs, DeadlineTimer& timer) override;
+    bool WaitForWake(WakeEvent& wake, int64_t deadlineNs) override;
+};
+
+// Virtual time for deterministic simulation.
+//
+// Time only moves when the driving thread calls AdvanceTo()/AdvanceBy().
+// The waiting thread (Mouse2VRCore's processing thread) then runs through
+// every wait up to the new horizon instantly and in order, each returning
+// exactly at its deadline, and the call returns once that thread is blocked
+// beyond the horizon. Events added with Schedule() run on the waiting
+// thread at their exact virtual time, which is how tests feed input.
+//
+// One waiting thread and one driving thread at most. A WakeEvent signaled
+// from outside an event is seen at the next AdvanceTo(). While interrupted
+// (the initial state, with no thread attached) AdvanceTo() runs the due
+// events itself.
+class SimulatedClock : public IClock {
+public:
+    explicit SimulatedClock(int64_t startNs = 0);
+
+    SimulatedClock(const SimulatedClock&) = delete;
+    SimulatedClock& operator=(const SimulatedClock&) = delete;
+
+    int64_t NowNs() override { return m_now.load(std::memory_order_acquire); }
+    int64_t WaitUntil(int64_t deadlineNs, DeadlineTimer& timer) override;
+    bool WaitForWake(WakeEvent& wake, int64_t deadlineNs) override;
+    void SetInterrupted(bool interrupted) override;
+
+    // Run fn when virtual time reaches atNs (never earlier than now); events
+    // at the same time run in the order they were scheduled
+    void Schedule(int64_t atNs, std::function<void()> fn);
+
+    // Let virtual time run up to targetNs and wait until it has
+    void AdvanceTo(int64_t targetNs);
+    void AdvanceBy(int64_t durationNs);
+
+    // Waits that completed (timed out, were signaled or interrupted)
+    uint64_t GetWaitCount() const { return m_waits.load(std::memory_order_relaxed); }
+
+private:
+    // Run the earliest event due at or before limitNs; false if none
+    bool RunNextEvent(std::unique_lock<std::mutex>& lock, int64_t limitNs);
+    // Park the waiting thread at the horizon until it moves
+    void BlockAtHorizon(std::unique_lock<std::mutex>& lock);
+    void SetNow(int64_t nowNs);
+
+    std::atomic<int64_t> m_now;
+    std::atomic<uint64_t> m_waits{0};
+
+    std::mutex m_mutex;
+    WakeEvent m_advanced;  // Horizon moved or interrupted (wakes the waiting thread)
+    WakeEvent m_blocked;   // Waiting thread blocked or interrupted (wakes the driver)
+    int64_t m_horizonNs;
+    bool m_interrupted = true;
+    bool m_running = false;  // The waiting thread is between waits
+    std::multimap<int64_t, std::function<void()>> m_events;
+};
+
+} // namespace Mouse2VR
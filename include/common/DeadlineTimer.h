@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace Mouse2VR {
+
+// How DeadlineTimer blocks until a deadline
+enum class TimerStrategy {
+    Precise,    // clock_nanosleep(TIMER_ABSTIME) / high-resolution waitable timer, short spin tail
+    TimerFd,    // Linux timerfd armed with an absolute deadline (Precise elsewhere)
+    SleepSpin   // 1 ms sleeps, then spin the last 2 ms (the original scheduler)
+};
+
+const char* TimerStrategyToString(TimerStrategy strategy);
+TimerStrategy TimerStrategyFromString(const std::string& name);  // Precise if unknown
+
+// Blocks the calling thread until an absolute deadline on the steady clock
+// (InputSampleQueue::NowNs() time base).
+//
+// The kernel sleep is aimed spinTailNs before the deadline and the rest is
+// spun, so the tail only has to cover the platform's wake-up overshoot
+// instead of a whole timer period. Not thread-safe: each scheduler thread
+// owns its timer.
+class DeadlineTimer {
+public:
+    explicit DeadlineTimer(TimerStrategy strategy = TimerStrategy::Precise);
+    ~DeadlineTimer();
+
+    DeadlineTimer(const DeadlineTimer&) = delete;
+    DeadlineTimer& operator=(const DeadlineTimer&) = delete;
+
+    // Switch strategy; the spin tail returns to the strategy's default
+    void SetStrategy(TimerStrategy strategy);
+    TimerStrategy GetStrategy() const { return m_strategy; }
+
+    void SetSpinTailNs(int64_t spinTailNs);
+    int64_t GetSpinTailNs() const { return m_spinTailNs; }
+    static int64_t DefaultSpinTailNs(TimerStrategy strategy);
+
+    // Returns how late the call returned (>= 0); deadlines already in the
+    // past return immediately
+    int64_t WaitUntil(int64_t deadlineNs);
+
+private:
+    void KernelSleepUntil(int64_t wakeNs);
+    void CloseHandles();
+
+    TimerStrategy m_strategy;
+    int64_t m_spinTailNs = 0;
+#if defined(_WIN32)
+    void* m_timer = nullptr;
+#elif defined(__linux__)
+    int m_timerFd = -1;
+#endif
+};
+
+} // namespace Mouse2VR
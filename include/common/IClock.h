@@ -0,0 +1,38 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace Mouse2VR {
+
+class DeadlineTimer;
+class WakeEvent;
+
+// Time base and waits of Mouse2VRCore's schedulers.
+//
+// Every timestamp, elapsed time and blocking wait on the processing thread
+// goes through the core's clock, so a simulated clock can replace the
+// steady clock and run the schedulers in virtual time.
+class IClock {
+public:
+    static constexpr int64_t kNoDeadline = std::numeric_limits<int64_t>::max();
+
+    virtual ~IClock() = default;
+
+    // Current time in nanoseconds
+    virtual int64_t NowNs() = 0;
+
+    // Block until deadlineNs; returns how late the call returned (>= 0).
+    // timer is the calling thread's own DeadlineTimer, for clocks that sleep
+    virtual int64_t WaitUntil(int64_t deadlineNs, DeadlineTimer& timer) = 0;
+
+    // Block until wake is signaled (returns true and consumes the signal) or
+    // deadlineNs passes (returns false); kNoDeadline waits for the signal only
+    virtual bool WaitForWake(WakeEvent& wake, int64_t deadlineNs) = 0;
+
+    // While interrupted, waits return immediately. Mouse2VRCore clears it
+    // before starting its processing thread and sets it when stopping, so
+    // the thread never stays blocked on a clock that only moves on request.
+    virtual void SetInterrupted(bool interrupted) { (void)interrupted; }
+};
+
+} // namespace Mouse2VR
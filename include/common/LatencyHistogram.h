@@ -0,0 +1,64 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace Mouse2VR {
+
+// Percentile summary of a LatencyHistogram (all values in nanoseconds)
+struct LatencyStats {
+    uint64_t count = 0;
+    double meanNs = 0.0;
+    int64_t minNs = 0;
+    int64_t p50Ns = 0;
+    int64_t p90Ns = 0;
+    int64_t p99Ns = 0;
+    int64_t p999Ns = 0;
+    int64_t maxNs = 0;
+};
+
+// Fixed-memory HDR-style histogram of durations in nanoseconds.
+//
+// Values below 64 ns are counted exactly; above that each power of two is
+// split into 64 linear sub-buckets, so any reported percentile is within
+// 1/64 (~1.6%) of the true value. Values beyond 2^41 ns (~36 minutes) are
+// clamped. Record() is wait-free for a single writer; GetStats() and
+// Reset() may be called from any thread. Samples recorded concurrently with
+// Reset() may land on either side of it.
+class LatencyHistogram {
+public:
+    static constexpr int kSubBucketBits = 6;
+    static constexpr int kSubBucketCount = 1 << kSubBucketBits;
+    static constexpr int kMaxMagnitude = 40;  // highest bit index tracked
+    static constexpr size_t kBucketCount =
+        static_cast<size_t>(kMaxMagnitude - kSubBucketBits + 2) * kSubBucketCount;
+    static constexpr int64_t kMaxTrackableNs = (int64_t{1} << (kMaxMagnitude + 1)) - 1;
+    
+    LatencyHistogram();
+    
+    // Record one duration (negative values count as zero)
+    void Record(int64_t valueNs);
+    
+    void Reset();
+    
+    LatencyStats GetStats() const;
+    
+    // Value at the given percentile (0-100); 0 if empty
+    int64_t GetPercentile(double percentile) const;
+    
+    uint64_t GetCount() const { return m_count.load(std::memory_order_relaxed); }
+    
+    // Bucket mapping, exposed for tests
+    static size_t BucketIndex(int64_t valueNs);
+    static int64_t BucketUpperBound(size_t index);
+
+private:
+    std::array<std::atomic<uint64_t>, kBucketCount> m_buckets;
+    std::atomic<uint64_t> m_count{0};
+    std::atomic<int64_t> m_sumNs{0};
+    std::atomic<int64_t> m_minNs{INT64_MAX};
+    std::atomic<int64_t> m_maxNs{0};
+};
+
+} // namespace Mouse2VR
@@ -4,13 +4,46 @@
 #include <spdlog/async.h>
 #include <spdlog/sinks/rotating_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/fmt/fmt.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <chrono>
 #include <functional>
+#include <utility>
+#include <vector>
+
+// Compile-time floor: LOG_* calls below this level compile to nothing.
+// 0=DEBUG, 1=INFO, 2=WARNING, 3=ERROR (set via CMake MOUSE2VR_MIN_LOG_LEVEL)
+#ifndef MOUSE2VR_MIN_LOG_LEVEL
+#define MOUSE2VR_MIN_LOG_LEVEL 0
+#endif
 
 namespace Mouse2VR {
 
+// Runtime level switch for one logging component ("Core", "RawInput", ...).
+// Bit N of the mask enables Logger::Level N. LOG_* call sites cache a
+// reference to their component, so a disabled check is one relaxed load.
+class LogComponent {
+public:
+    const char* GetName() const { return m_name; }
+    bool IsEnabled(int level) const {
+        return ((m_levelMask.load(std::memory_order_relaxed) >> level) & 1u) != 0;
+    }
+    uint32_t GetMask() const { return m_levelMask.load(std::memory_order_relaxed); }
+    void SetMask(uint32_t mask) { m_levelMask.store(mask, std::memory_order_relaxed); }
+
+private:
+    friend class Logger;
+    char m_name[32] = {};
+    std::atomic<uint32_t> m_levelMask{0};
+};
+
 class Logger {
 public:
     enum Level {
@@ -20,6 +53,13 @@ public:
         ERROR_LEVEL
     };
 
+    static constexpr size_t kMaxComponents = 64;
+
+    // Mask enabling minLevel and everything above it
+    static constexpr uint32_t MaskFromLevel(Level minLevel) {
+        return (0xFu << minLevel) & 0xFu;
+    }
+
     static Logger& Instance();
 
     void Initialize(const std::string& logPath = "logs/debug.log", bool useExeRelative = true);
@@ -33,6 +73,26 @@ public:
                      const std::string& key1, const std::string& value1,
                      const std::string& key2, const std::string& value2);
     
+    // Deferred formatting: only called once the level check has passed
+    void Write(Level level, const LogComponent& component, std::string_view message);
+    
+    template <typename... Args>
+        requires (sizeof...(Args) > 0)
+    void Write(Level level, const LogComponent& component,
+               fmt::format_string<Args...> format, Args&&... args) {
+        fmt::memory_buffer buffer;
+        fmt::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+        Write(level, component, std::string_view(buffer.data(), buffer.size()));
+    }
+    
+    // Component registry (thread-safe; levels can be changed while running)
+    LogComponent& GetComponent(std::string_view name);
+    void SetComponentLevel(std::string_view name, Level minLevel);
+    void SetComponentMask(std::string_view name, uint32_t mask);
+    void SetAllComponentsLevel(Level minLevel);  // Also the default for new components
+    bool IsEnabled(std::string_view name, Level level);
+    std::vector<std::pair<std::string, uint32_t>> GetComponentMasks() const;
+    
     // Set a provider function that returns current settings as a string
     void SetSettingsProvider(std::function<std::string()> provider);
     
@@ -51,21 +111,47 @@ private:
     static constexpr auto WARNING_RATE_LIMIT = std::chrono::seconds(1);
     std::function<std::string()> m_settingsProvider;
     
+    // Component registry; entries are never removed so references stay valid
+    mutable std::mutex m_componentMutex;
+    std::array<LogComponent, kMaxComponents> m_components;
+    size_t m_componentCount = 0;
+    // Everything above the compile-time floor is on until a component is
+    // narrowed at runtime, so release builds keep writing debug.log
+    std::atomic<uint32_t> m_defaultMask{MaskFromLevel(DEBUG)};
+    
+    void Emit(Level level, std::string_view component, std::string_view message);
     spdlog::level::level_enum ConvertLevel(Level level);
     bool ShouldRateLimit(Level level, const std::string& message);
 };
 
-// Convenience macros
-#define LOG_DEBUG(component, msg) Mouse2VR::Logger::Instance().Log(Mouse2VR::Logger::DEBUG, component, msg)
-#define LOG_INFO(component, msg) Mouse2VR::Logger::Instance().Log(Mouse2VR::Logger::INFO, component, msg)
-#define LOG_WARNING(component, msg) Mouse2VR::Logger::Instance().Log(Mouse2VR::Logger::WARNING, component, msg)
-#define LOG_ERROR(component, msg) Mouse2VR::Logger::Instance().Log(Mouse2VR::Logger::ERROR_LEVEL, component, msg)
+// Logging macros
+//
+// The level is checked against MOUSE2VR_MIN_LOG_LEVEL at compile time and
+// against the component's runtime mask before any argument is evaluated.
+// Messages are either a plain string or an fmt-style format with arguments:
+//   LOG_DEBUG("Processor", "deltaY={} -> deflection={:.4f}", delta.y, y);
+// component must be a string literal (it is looked up once per call site).
+#define MOUSE2VR_LOG(level, component, ...) \
+    do { \
+        if constexpr ((level) >= MOUSE2VR_MIN_LOG_LEVEL) { \
+            static Mouse2VR::LogComponent& m2vrLogComponent_ = \
+                Mouse2VR::Logger::Instance().GetComponent(component); \
+            if (m2vrLogComponent_.IsEnabled(level)) { \
+                Mouse2VR::Logger::Instance().Write(level, m2vrLogComponent_, __VA_ARGS__); \
+            } \
+        } \
+    } while (0)
+
+#define LOG_DEBUG(component, ...) MOUSE2VR_LOG(Mouse2VR::Logger::DEBUG, component, __VA_ARGS__)
+#define LOG_INFO(component, ...) MOUSE2VR_LOG(Mouse2VR::Logger::INFO, component, __VA_ARGS__)
+#define LOG_WARNING(component, ...) MOUSE2VR_LOG(Mouse2VR::Logger::WARNING, component, __VA_ARGS__)
+#define LOG_ERROR(component, ...) MOUSE2VR_LOG(Mouse2VR::Logger::ERROR_LEVEL, component, __VA_ARGS__)
 
 // Convenience macros with data
 #define LOG_DEBUG_DATA(component, msg, key, value) \
-    Mouse2VR::Logger::Instance().LogWithData(Mouse2VR::Logger::DEBUG, component, msg, key, std::to_string(value))
+    MOUSE2VR_LOG(Mouse2VR::Logger::DEBUG, component, "{} | {}={}", msg, key, value)
 #define LOG_INFO_DATA(component, msg, key, value) \
-    Mouse2VR::Logger::Instance().LogWithData(Mouse2VR::Logger::INFO, component, msg, key, std::to_string(value))
+    MOUSE2VR_LOG(Mouse2VR::Logger::INFO, component, "{} | {}={}", msg, key, value)
 
 // Performance timing helper
 class ScopedTimer {
@@ -0,0 +1,181 @@
+#pragma once
+// Live treadmill state published by Mouse2VR in a named shared-memory
+// segment, for game mods, overlays and helpers.
+//
+// Header-only and self-contained: copy this file into a reader project.
+// Open a SharedStateReader with the channel name from config.json
+// ("stateChannel.name") and call TryRead() as often as needed; reads never
+// block the publisher.
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Mouse2VR {
+
+// Plain copy of one published state
+struct SharedStateSnapshot {
+    uint64_t tick = 0;         // Publish count since the publisher opened the segment
+    int64_t monotonicNs = 0;   // Steady clock (CLOCK_MONOTONIC / QueryPerformanceCounter)
+    int64_t unixTimeNs = 0;    // Wall clock
+    double speed = 0.0;        // Game speed, m/s (belt speed * sensitivity)
+    double beltSpeed = 0.0;    // Belt speed, m/s
+    double stickX = 0.0;
+    double stickY = 0.0;
+    int32_t updateRate = 0;    // Target output rate, Hz
+    bool running = false;      // False once the core has stopped
+};
+
+// Segment layout. The payload is guarded by a seqlock: the publisher makes
+// the sequence odd, stores the fields and makes it even again; a reader
+// copies the fields between two loads of the same even sequence. Fields
+// are relaxed atomics so a read racing a write is merely retried.
+struct SharedStateLayout {
+    static constexpr uint32_t kMagic = 0x5453324D;  // "M2ST"
+    static constexpr uint32_t kVersion = 2;  // 2: beltSpeed added, speed is game speed
+
+    std::atomic<uint32_t> magic;      // Stored last once the segment is set up
+    uint32_t version;
+    uint32_t size;                    // sizeof(SharedStateLayout)
+    uint32_t reserved;
+    std::atomic<uint64_t> sequence;   // Odd while a publish is in progress
+
+    std::atomic<uint64_t> tick;
+    std::atomic<int64_t> monotonicNs;
+    std::atomic<int64_t> unixTimeNs;
+    std::atomic<double> speed;
+    std::atomic<double> beltSpeed;
+    std::atomic<double> stickX;
+    std::atomic<double> stickY;
+    std::atomic<int32_t> updateRate;
+    std::atomic<uint32_t> running;
+};
+static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<double>::is_always_lock_free,
+              "Shared-memory atomics must be lock-free");
+
+// Platform name of a channel ("mouse2vr-state" -> "/mouse2vr-state" or
+// "Local\mouse2vr-state")
+inline std::string SharedStateObjectName(const std::string& name) {
+#ifdef _WIN32
+    return "Local\\" + name;
+#else
+    return "/" + name;
+#endif
+}
+
+// Read-only view of a published segment
+class SharedStateReader {
+public:
+    static constexpr int kMaxRetries = 1000;
+
+    explicit SharedStateReader(std::string name = "mouse2vr-state") : m_name(std::move(name)) { Open(); }
+    ~SharedStateReader() { Close(); }
+
+    SharedStateReader(const SharedStateReader&) = delete;
+    SharedStateReader& operator=(const SharedStateReader&) = delete;
+
+    // Map the segment; false until a publisher has created it
+    bool Open() {
+        if (m_layout) {
+            return true;
+        }
+        std::string object = SharedStateObjectName(m_name);
+#ifdef _WIN32
+        m_mapping = OpenFileMappingA(FILE_MAP_READ, FALSE, object.c_str());
+        if (!m_mapping) {
+            return false;
+        }
+        void* view = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, sizeof(SharedStateLayout));
+        if (!view) {
+            Close();
+            return false;
+        }
+#else
+        int fd = shm_open(object.c_str(), O_RDONLY, 0);
+        if (fd < 0) {
+            return false;
+        }
+        void* view = mmap(nullptr, sizeof(SharedStateLayout), PROT_READ, MAP_SHARED, fd, 0);
+        close(fd);
+        if (view == MAP_FAILED) {
+            return false;
+        }
+#endif
+        m_layout = static_cast<const SharedStateLayout*>(view);
+        return true;
+    }
+
+    bool IsOpen() const { return m_layout != nullptr; }
+
+    // Copy the latest state. False if the segment is not mapped or not set
+    // up, or a publish kept the payload busy for kMaxRetries attempts (the
+    // publisher died mid-write).
+    bool TryRead(SharedStateSnapshot& out) const {
+        if (!m_layout || m_layout->magic.load(std::memory_order_acquire) != SharedStateLayout::kMagic ||
+            m_layout->version != SharedStateLayout::kVersion) {
+            return false;
+        }
+        for (int attempt = 0; attempt < kMaxRetries; ++attempt) {
+            uint64_t before = m_layout->sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue;
+            }
+            SharedStateSnapshot copy;
+            copy.tick = m_layout->tick.load(std::memory_order_relaxed);
+            copy.monotonicNs = m_layout->monotonicNs.load(std::memory_order_relaxed);
+            copy.unixTimeNs = m_layout->unixTimeNs.load(std::memory_order_relaxed);
+            copy.speed = m_layout->speed.load(std::memory_order_relaxed);
+            copy.beltSpeed = m_layout->beltSpeed.load(std::memory_order_relaxed);
+            copy.stickX = m_layout->stickX.load(std::memory_order_relaxed);
+            copy.stickY = m_layout->stickY.load(std::memory_order_relaxed);
+            copy.updateRate = m_layout->updateRate.load(std::memory_order_relaxed);
+            copy.running = m_layout->running.load(std::memory_order_relaxed) != 0;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_layout->sequence.load(std::memory_order_relaxed) == before) {
+                out = copy;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void Close() {
+#ifdef _WIN32
+        if (m_layout) {
+            UnmapViewOfFile(m_layout);
+        }
+        if (m_mapping) {
+            CloseHandle(m_mapping);
+            m_mapping = nullptr;
+        }
+#else
+        if (m_layout) {
+            munmap(const_cast<SharedStateLayout*>(m_layout), sizeof(SharedStateLayout));
+        }
+#endif
+        m_layout = nullptr;
+    }
+
+private:
+    std::string m_name;
+    const SharedStateLayout* m_layout = nullptr;
+#ifdef _WIN32
+    HANDLE m_mapping = nullptr;
+#endif
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,111 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+namespace Mouse2VR {
+
+// Wait-free single-producer/single-consumer ring buffer.
+//
+// Exactly one thread may call TryPush() and exactly one (other) thread may
+// call the consumer methods (Pop/PopBatch/ConsumeAll/Peek). Neither side ever
+// blocks or retries: a push into a full ring fails immediately so the caller
+// can decide what to do with the item.
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscRing capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "SpscRing only stores trivially copyable types");
+
+public:
+    static constexpr size_t capacity() { return Capacity; }
+
+    // Producer: append one item, returns false if the ring is full
+    bool TryPush(const T& item) {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tailCache >= Capacity) {
+            m_tailCache = m_tail.load(std::memory_order_acquire);
+            if (head - m_tailCache >= Capacity) {
+                return false;
+            }
+        }
+        m_buffer[head & kMask] = item;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer: remove one item, returns false if the ring is empty
+    bool Pop(T& out) {
+        return PopBatch(&out, 1) == 1;
+    }
+
+    // Consumer: remove up to maxCount items into out, returns number copied
+    size_t PopBatch(T* out, size_t maxCount) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        const size_t available = Available(tail);
+        const size_t count = available < maxCount ? available : maxCount;
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = m_buffer[(tail + i) & kMask];
+        }
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer: invoke fn(const T&) for every queued item and remove them
+    template <typename Fn>
+    size_t ConsumeAll(Fn&& fn) {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        const size_t count = Available(tail);
+        for (size_t i = 0; i < count; ++i) {
+            fn(m_buffer[(tail + i) & kMask]);
+        }
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer: invoke fn(const T&) for every queued item without removing them
+    template <typename Fn>
+    size_t Peek(Fn&& fn) const {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        const size_t count = Available(tail);
+        for (size_t i = 0; i < count; ++i) {
+            fn(m_buffer[(tail + i) & kMask]);
+        }
+        return count;
+    }
+
+    // Approximate number of queued items (exact when called from either side
+    // while the other side is idle)
+    size_t SizeApprox() const {
+        const size_t head = m_head.load(std::memory_order_acquire);
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        return head - tail;
+    }
+
+    bool Empty() const { return SizeApprox() == 0; }
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+    static constexpr size_t kCacheLine = 64;
+
+    size_t Available(size_t tail) const {
+        if (m_headCache == tail) {
+            m_headCache = m_head.load(std::memory_order_acquire);
+        }
+        return m_headCache - tail;
+    }
+
+    // Producer-owned: write index and its cached view of the read index
+    alignas(kCacheLine) std::atomic<size_t> m_head{0};
+    size_t m_tailCache = 0;
+
+    // Consumer-owned: read index and its cached view of the write index
+    alignas(kCacheLine) std::atomic<size_t> m_tail{0};
+    mutable size_t m_headCache = 0;
+
+    alignas(kCacheLine) std::array<T, Capacity> m_buffer{};
+};
+
+} // namespace Mouse2VR
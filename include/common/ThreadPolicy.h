@@ -0,0 +1,68 @@
+#pragma once
+#include <cstdint>
+#include <string>
+
+namespace Mouse2VR {
+
+// Priority within the normal scheduling class
+enum class ThreadPriority {
+    Normal,       // Leave as inherited (the process may already be niced)
+    AboveNormal,  // THREAD_PRIORITY_ABOVE_NORMAL / nice -5
+    High,         // THREAD_PRIORITY_HIGHEST / nice -10
+    TimeCritical  // THREAD_PRIORITY_TIME_CRITICAL / nice -20
+};
+
+// Linux scheduling class; the real-time classes preempt every normal thread
+enum class ThreadScheduler {
+    Normal,     // SCHED_OTHER (leave as inherited)
+    Fifo,       // SCHED_FIFO (Linux only)
+    RoundRobin  // SCHED_RR (Linux only)
+};
+
+const char* ThreadPriorityToString(ThreadPriority priority);
+ThreadPriority ThreadPriorityFromString(const std::string& name);  // Normal if unknown
+const char* ThreadSchedulerToString(ThreadScheduler scheduler);
+ThreadScheduler ThreadSchedulerFromString(const std::string& name);  // Normal if unknown
+
+struct ThreadPolicyConfig {
+    ThreadPriority priority = ThreadPriority::Normal;  // Ignored under a real-time scheduler
+    ThreadScheduler scheduler = ThreadScheduler::Normal;
+    int realtimePriority = 10;   // 1-99 for Fifo/RoundRobin
+    uint64_t affinityMask = 0;   // Bit n = CPU n; 0 leaves affinity alone
+
+    bool IsDefault() const {
+        return priority == ThreadPriority::Normal && scheduler == ThreadScheduler::Normal && affinityMask == 0;
+    }
+
+    bool operator==(const ThreadPolicyConfig& other) const {
+        return priority == other.priority && scheduler == other.scheduler &&
+               realtimePriority == other.realtimePriority && affinityMask == other.affinityMask;
+    }
+};
+
+// What the OS reports for a thread after a policy was applied. Settings the
+// process lacks the rights for (CAP_SYS_NICE, RLIMIT_RTPRIO, ...) stay at
+// their previous values and are listed in failures.
+struct AppliedThreadPolicy {
+    bool applied = false;        // A policy was applied to the thread
+    ThreadPriority priority = ThreadPriority::Normal;
+    ThreadScheduler scheduler = ThreadScheduler::Normal;
+    int realtimePriority = 0;
+    uint64_t affinityMask = 0;   // CPUs the thread may run on (0 = unknown)
+    std::string failures;        // "; "-separated, empty when everything took effect
+
+    bool Succeeded() const { return applied && failures.empty(); }
+};
+
+// Apply a policy to the calling thread and read back the result
+AppliedThreadPolicy ApplyThreadPolicy(const ThreadPolicyConfig& policy);
+
+// The calling thread's current policy, as the OS reports it
+AppliedThreadPolicy QueryThreadPolicy();
+
+// Keep the process's pages resident so a real-time thread never waits on a
+// page fault: mlockall(MCL_CURRENT | MCL_FUTURE) on Linux, a hard minimum
+// working set on Windows. Returns false if the OS refused.
+bool LockProcessMemory();
+
+} // namespace Mouse2VR
@@ -0,0 +1,40 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+namespace Mouse2VR {
+
+// std::mutex that records how often, and for how long, lock() had to wait.
+//
+// The uncontended path is a single try_lock(); the clock is only read when
+// another thread already holds the mutex, so wrapping a hot lock with this
+// costs nothing until there is contention worth measuring.
+class TimedMutex {
+public:
+    void lock() {
+        if (m_mutex.try_lock()) {
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        m_mutex.lock();
+        auto waited = std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count();
+        m_waitNs.fetch_add(waited, std::memory_order_relaxed);
+        m_contendedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    bool try_lock() { return m_mutex.try_lock(); }
+    void unlock() { m_mutex.unlock(); }
+    
+    int64_t GetWaitNs() const { return m_waitNs.load(std::memory_order_relaxed); }
+    uint64_t GetContendedCount() const { return m_contendedCount.load(std::memory_order_relaxed); }
+
+private:
+    std::mutex m_mutex;
+    std::atomic<int64_t> m_waitNs{0};
+    std::atomic<uint64_t> m_contendedCount{0};
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Mouse2VR {
+
+// IPv4 UDP socket over BSD sockets / Winsock, for the small datagram feeds
+// (frame clock, stick-state stream). Sends and receives never allocate.
+class UdpSocket {
+public:
+    UdpSocket();  // Opens the socket; check IsOpen()
+    ~UdpSocket();
+
+    UdpSocket(const UdpSocket&) = delete;
+    UdpSocket& operator=(const UdpSocket&) = delete;
+
+    bool IsOpen() const { return m_socket != kInvalidSocket; }
+
+    // Bind to host:port ("0.0.0.0" for every interface, port 0 for any)
+    bool Bind(const std::string& host, uint16_t port);
+
+    // Fix the destination for Send()
+    bool Connect(const std::string& host, uint16_t port);
+
+    // Port the socket is bound to (after Bind() or the first send)
+    uint16_t GetLocalPort() const;
+
+    bool SetNonBlocking();
+    void SetReceiveBufferSize(int bytes);
+
+    // Datagram to the connected peer; false unless sent whole
+    bool Send(const void* data, size_t size);
+
+    // Datagram to host-order IPv4 address and port
+    bool SendTo(const void* data, size_t size, uint32_t address, uint16_t port);
+
+    // Next datagram's size (truncated to capacity), or -1 if none is queued
+    // on a non-blocking socket or on error
+    int Receive(void* buffer, size_t capacity);
+
+    // Block until a datagram is queued or timeoutMs passes; true if readable
+    bool WaitReadable(int timeoutMs);
+
+    // Parse dotted IPv4 ("127.0.0.1") to a host-order address
+    static bool ParseAddress(const std::string& host, uint32_t& address);
+
+private:
+    static constexpr intptr_t kInvalidSocket = -1;
+
+    intptr_t m_socket = kInvalidSocket;
+};
+
+} // namespace Mouse2VR
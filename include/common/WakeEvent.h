@@ -0,0 +1,57 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+
+#if !defined(_WIN32) && !defined(__linux__)
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace Mouse2VR {
+
+// Auto-reset event used to wake a consumer thread when new input arrives.
+//
+// Signal() is safe from any thread and costs a single atomic exchange when
+// the event is already pending, so producers can call it for every sample;
+// only the first signal after the consumer wakes reaches the kernel.
+// Backends: eventfd on Linux, an auto-reset event object on Windows, and a
+// condition variable elsewhere.
+class WakeEvent {
+public:
+    WakeEvent();
+    ~WakeEvent();
+    
+    WakeEvent(const WakeEvent&) = delete;
+    WakeEvent& operator=(const WakeEvent&) = delete;
+    
+    void Signal();
+    
+    // Block until signaled; consumes the signal
+    void Wait();
+    
+    // Block until signaled or the timeout expires. Returns true if signaled
+    // (and consumes the signal). May occasionally return true without new
+    // data, so callers must tolerate spurious wakes.
+    bool WaitFor(std::chrono::nanoseconds timeout);
+    
+    // Number of Signal() calls that had to wake the kernel object
+    uint64_t GetKernelSignalCount() const { return m_kernelSignals.load(std::memory_order_relaxed); }
+
+private:
+    bool WaitImpl(long long timeoutNs);  // < 0 waits forever
+    
+    std::atomic<bool> m_pending{false};
+    std::atomic<uint64_t> m_kernelSignals{0};
+    
+#if defined(_WIN32)
+    void* m_handle = nullptr;
+#elif defined(__linux__)
+    int m_fd = -1;
+#else
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    bool m_signaled = false;
+#endif
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,110 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+
+#ifdef _WIN32
+#include "common/WindowsHeaders.h"
+#else
+#include <time.h>
+#endif
+
+namespace Mouse2VR {
+
+enum class ActivityState {
+    Active,  // Input seen within the idle timeout; full update rate
+    Idle     // No input for the idle timeout; idle rate or parked
+};
+
+inline const char* ActivityStateToString(ActivityState state) {
+    return state == ActivityState::Idle ? "idle" : "active";
+}
+
+// CPU time consumed so far by the calling thread
+inline int64_t ThreadCpuTimeNs() {
+#ifdef _WIN32
+    FILETIME creation, exit, kernel, user;
+    if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user)) {
+        return 0;
+    }
+    auto ticks = [](const FILETIME& t) {
+        return (static_cast<int64_t>(t.dwHighDateTime) << 32) | t.dwLowDateTime;
+    };
+    return (ticks(kernel) + ticks(user)) * 100;
+#else
+    timespec ts = {};
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+#endif
+}
+
+// Per-state time accounting for the processing thread, indexed by ActivityState
+struct ActivityStats {
+    ActivityState state = ActivityState::Active;
+    bool parked = false;           // Blocked until input arrives
+    int64_t cpuNs[2] = {};         // Processing thread CPU time spent in each state
+    int64_t wallNs[2] = {};        // Wall time spent in each state
+    uint64_t ticks[2] = {};        // Controller updates published in each state
+    uint64_t idleTransitions = 0;  // Active -> Idle
+    uint64_t wakeTransitions = 0;  // Idle -> Active
+
+    int64_t CpuNs(ActivityState s) const { return cpuNs[static_cast<int>(s)]; }
+    int64_t WallNs(ActivityState s) const { return wallNs[static_cast<int>(s)]; }
+    uint64_t Ticks(ActivityState s) const { return ticks[static_cast<int>(s)]; }
+
+    // Fraction of one core used while in the given state
+    double CpuLoad(ActivityState s) const {
+        return WallNs(s) > 0 ? static_cast<double>(CpuNs(s)) / static_cast<double>(WallNs(s)) : 0.0;
+    }
+};
+
+// Idle/active state machine for adaptive scheduling.
+//
+// The first input count switches to Active immediately, while Idle is only
+// entered after a full timeout without input. The asymmetry is the
+// hysteresis: a stray count costs one timeout at full rate, and the gaps
+// between strides never drop the scheduler to the idle rate mid-walk.
+class ActivityTracker {
+public:
+    void Configure(int64_t idleTimeoutNs) {
+        m_idleTimeoutNs = std::max<int64_t>(0, idleTimeoutNs);
+    }
+
+    // Feed one tick's input at nowNs; returns true when the state changed
+    bool Update(bool hasInput, int64_t nowNs) {
+        if (!m_started) {
+            m_lastInputNs = nowNs;
+            m_started = true;
+        }
+        if (hasInput) {
+            m_lastInputNs = nowNs;
+            if (m_state == ActivityState::Idle) {
+                m_state = ActivityState::Active;
+                return true;
+            }
+            return false;
+        }
+        if (m_state == ActivityState::Active && nowNs - m_lastInputNs >= m_idleTimeoutNs) {
+            m_state = ActivityState::Idle;
+            return true;
+        }
+        return false;
+    }
+
+    // Back to Active with the timeout restarting at the next Update()
+    void Reset() {
+        m_state = ActivityState::Active;
+        m_started = false;
+    }
+
+    ActivityState GetState() const { return m_state; }
+    bool IsIdle() const { return m_state == ActivityState::Idle; }
+    int64_t GetIdleTimeoutNs() const { return m_idleTimeoutNs; }
+
+private:
+    ActivityState m_state = ActivityState::Active;
+    int64_t m_idleTimeoutNs = 500000000;
+    int64_t m_lastInputNs = 0;
+    bool m_started = false;
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,82 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <string_view>
+#include <nlohmann/json.hpp>
+#include "core/ConfigManager.h"
+
+namespace Mouse2VR {
+
+class Mouse2VRCore;
+
+// Typed JSON commands from the UI (WebView bridge), independent of the host.
+//
+//   request: {"id":3,"cmd":"set","args":{"sensitivity":1.5,"dpi":1600}}
+//   reply:   {"id":3,"ok":true,"result":{...}}
+//            {"id":3,"ok":false,"error":{"code":"out_of_range","field":"dpi","message":"..."}}
+//
+// The id is echoed back (null if missing or the request was unreadable).
+// "set" checks every field before applying any, so one message changes all
+// of its settings or none, with one config publish and one save.
+enum class BridgeErrorCode {
+    None,
+    ParseError,      // Not JSON
+    InvalidRequest,  // JSON, but not a request object
+    UnknownCommand,
+    UnknownSetting,
+    WrongType,
+    OutOfRange,
+    Unavailable      // Command the host does not support
+};
+
+const char* BridgeErrorCodeToString(BridgeErrorCode code);
+BridgeErrorCode BridgeErrorCodeFromString(const std::string& name);  // None if unknown
+
+struct BridgeError {
+    BridgeErrorCode code = BridgeErrorCode::None;
+    std::string field;    // Offending key, if any
+    std::string message;
+};
+
+// Decode the args of a "set" command; false with error set on the first
+// bad field (change is then partially filled and must be discarded)
+bool ParseSettingsChange(const nlohmann::json& args, SettingsChange& change, BridgeError& error);
+
+// Decodes requests, dispatches them through a static command table to the
+// core and encodes the replies. Call from one thread (the UI thread).
+class BridgeDispatcher {
+public:
+    explicit BridgeDispatcher(Mouse2VRCore& core) : m_core(core) {}
+
+    // Host side of "setTelemetryRate" (the push timer); without it the
+    // command replies "unavailable"
+    void SetTelemetryRateHandler(std::function<void(int hz)> handler) { m_setTelemetryRate = std::move(handler); }
+
+    // Handle one UTF-8 JSON request; returns the reply. Never throws on
+    // malformed input.
+    std::string Handle(std::string_view request);
+
+private:
+    using Handler = bool (BridgeDispatcher::*)(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    struct Command {
+        std::string_view name;
+        Handler handler;
+    };
+    static const Command kCommands[];
+
+    bool Set(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool GetConfig(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool GetStatus(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool GetSpeed(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool GetSchedulerStats(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool GetPhaseStats(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool Start(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool Stop(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool StartTest(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+    bool SetTelemetryRate(const nlohmann::json& args, nlohmann::json& result, BridgeError& error);
+
+    Mouse2VRCore& m_core;
+    std::function<void(int hz)> m_setTelemetryRate;
+};
+
+} // namespace Mouse2VR
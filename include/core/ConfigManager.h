@@ -1,8 +1,18 @@
 #pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <mutex>
+#include <thread>
 #include <nlohmann/json.hpp>
+#include "common/DeadlineTimer.h"
+#include "common/ThreadPolicy.h"
+#include "common/WakeEvent.h"
+#include "core/FrameClock.h"
 #include "core/InputProcessor.h"
+#include "core/SharedStatePublisher.h"
 
 namespace Mouse2VR {
 
@@ -16,11 +26,34 @@ struct AppConfig {
     bool lockY = false;
     float maxSpeed = 1.0f;
     float countsPerMeter = 39370.1f;  // Default: 1000 DPI * 39.3701 inches/meter
+    VelocityEstimatorConfig velocity;  // Belt velocity filter
+    PredictionConfig prediction;       // Latency-hiding extrapolation
+    ResponseCurveConfig curve;         // Speed-to-deflection response curve
     
     // Update settings
     int updateIntervalMs = 20;  // 50Hz default
     bool adaptiveMode = false;  // Switch between high/low update rates
-    int idleUpdateIntervalMs = 33;  // ~30Hz when idle
+    int idleUpdateIntervalMs = 33;  // ~30Hz when idle; 0 parks until input arrives
+    int idleTimeoutMs = 500;        // Time without input before going idle
+    TimerStrategy timerStrategy = TimerStrategy::Precise;  // How the scheduler waits for tick deadlines
+    
+    // Event-driven mode: arriving input wakes the processing thread instead
+    // of waiting for the next tick; updateIntervalMs becomes the keep-alive
+    // interval used while no input arrives
+    bool eventDriven = false;
+    int coalesceWindowUs = 1000;    // Batch reports arriving closer than this
+    int maxOutputRateHz = 1000;     // Hard cap on controller updates
+    
+    // External frame clock the fixed-rate scheduler phase-locks to
+    FrameClockConfig frameClock;
+    
+    // Shared-memory channel publishing live state to other processes
+    StateChannelConfig stateChannel;
+    
+    // Thread scheduling, applied when the core starts
+    ThreadPolicyConfig processingThread;
+    ThreadPolicyConfig inputThread;
+    bool lockMemory = false;  // Keep pages resident (mlockall)
     
     // Debug settings
     bool showDebugInfo = true;
@@ -38,20 +71,70 @@ struct AppConfig {
         config.lockY = lockY;
         config.maxSpeed = maxSpeed;
         config.countsPerMeter = countsPerMeter;
+        config.velocity = velocity;
+        config.prediction = prediction;
+        config.curve = curve;
         return config;
     }
 };
 
+// A set of settings changed together (e.g. one UI command); fields left
+// empty keep their current value
+struct SettingsChange {
+    std::optional<float> sensitivity;
+    std::optional<float> countsPerMeter;
+    std::optional<bool> invertY;
+    std::optional<bool> lockX;
+    std::optional<bool> lockY;
+    std::optional<int> updateRateHz;
+    std::optional<bool> eventDriven;
+    std::optional<int> coalesceWindowUs;
+    std::optional<int> maxOutputRateHz;
+    std::optional<bool> adaptiveMode;
+    std::optional<int> idleUpdateIntervalMs;
+    std::optional<int> idleTimeoutMs;
+    
+    bool Empty() const;
+    bool ChangesProcessing() const;  // Any field of ProcessingConfig
+    
+    void ApplyTo(AppConfig& config) const;
+    void ApplyTo(ProcessingConfig& config) const;
+};
+
+struct ConfigSaveStats {
+    uint64_t requests = 0;  // RequestSave() calls
+    uint64_t writes = 0;    // Files written (Save, debounced writes, Flush)
+    uint64_t failures = 0;  // Writes that failed; the old file is left intact
+};
+
 class ConfigManager {
 public:
     ConfigManager(const std::string& configPath = "config.json");
+    ~ConfigManager();  // Stops the writer and flushes a pending save
+    
+    ConfigManager(const ConfigManager&) = delete;
+    ConfigManager& operator=(const ConfigManager&) = delete;
     
     // Load configuration from file
     bool Load();
     
-    // Save current configuration to file
+    // Save current configuration to file now. The file is replaced
+    // atomically (temp file, fsync, rename), so a crash leaves either the
+    // old or the new config, never a torn one.
     bool Save();
     
+    // Save in the background: a writer thread writes once no request has
+    // come in for the debounce window, or once the oldest unsaved change
+    // has waited maxDelay, so a burst of changes (a dragged slider) costs
+    // one write and the caller never touches the disk
+    void RequestSave();
+    void SetSaveDelay(std::chrono::milliseconds debounce, std::chrono::milliseconds maxDelay);
+    
+    // Write a pending save now (any thread); true if nothing was pending
+    bool Flush();
+    
+    ConfigSaveStats GetSaveStats() const;
+    
     // Get current configuration (thread-safe)
     AppConfig GetConfig() const;
     
@@ -66,6 +149,25 @@ private:
     AppConfig m_config;
     mutable std::mutex m_configMutex;  // Protects m_config
     
+    // Background saving
+    std::mutex m_writeMutex;     // One file write at a time
+    std::mutex m_writerMutex;    // Starting and stopping the writer
+    std::thread m_writer;
+    WakeEvent m_writerWake;
+    std::atomic<bool> m_stopWriter{false};
+    std::atomic<bool> m_dirty{false};           // Changes not yet written
+    std::atomic<int64_t> m_pendingSinceNs{0};   // First unsaved request
+    std::atomic<int64_t> m_lastRequestNs{0};
+    std::atomic<int64_t> m_debounceNs{250000000};
+    std::atomic<int64_t> m_maxDelayNs{1000000000};
+    std::atomic<uint64_t> m_saveRequests{0};
+    std::atomic<uint64_t> m_writes{0};
+    std::atomic<uint64_t> m_writeFailures{0};
+    
+    void WriterLoop();
+    bool WriteIfDirty();
+    bool WriteConfigFile();
+    
     // JSON serialization
     static nlohmann::json ConfigToJson(const AppConfig& config);
     static AppConfig JsonToConfig(const nlohmann::json& j);
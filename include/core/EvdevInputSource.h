@@ -0,0 +1,104 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <linux/input.h>
+#include "common/TimedMutex.h"
+#include "core/IInputSource.h"
+#include "core/InputSampleQueue.h"
+
+namespace Mouse2VR {
+
+// Linux evdev input source.
+//
+// A reader thread waits on the device node with epoll and pulls batches of
+// struct input_event per read(). REL_X/REL_Y motion is accumulated until
+// SYN_REPORT and then pushed as one timestamped sample. Any readable
+// descriptor carrying input_event records works, so tests can substitute a
+// pipe or a regular file for /dev/input/eventN.
+class EvdevInputSource : public IInputSource {
+public:
+    static constexpr size_t kReadBatch = 64;  // events per read()
+
+    // Open devicePath (e.g. "/dev/input/event3") on Start()
+    explicit EvdevInputSource(std::string devicePath);
+
+    // Read from an already-open descriptor; the source takes ownership
+    EvdevInputSource(int fd, std::string name);
+
+    ~EvdevInputSource() override;
+
+    EvdevInputSource(const EvdevInputSource&) = delete;
+    EvdevInputSource& operator=(const EvdevInputSource&) = delete;
+
+    // IInputSource
+    bool Start() override;
+    void Stop() override;
+    MouseDelta GetAndResetDeltas() override;
+    size_t DrainSamples(InputSample* out, size_t maxCount) override;
+    void SetWakeEvent(WakeEvent* wake) override { m_samples.SetWakeEvent(wake); }
+    void SetThreadPolicy(const ThreadPolicyConfig& policy) override;       // Applied on Start()
+    AppliedThreadPolicy GetAppliedThreadPolicy() const override;
+    uint64_t GetSampleCount() const override { return m_samples.GetPushedCount(); }
+    uint64_t GetMergedSampleCount() const override { return m_samples.GetMergedCount(); }
+    const char* GetName() const override { return "evdev"; }
+
+    bool IsRunning() const { return m_running; }
+
+    // True once the descriptor reported end of stream (regular file or
+    // closed pipe); a real device node never ends while connected
+    bool IsAtEndOfStream() const { return m_endOfStream; }
+
+    // Statistics
+    uint64_t GetReadCount() const { return m_readCount.load(std::memory_order_relaxed); }
+    uint64_t GetEventCount() const { return m_eventCount.load(std::memory_order_relaxed); }
+    uint64_t GetDroppedReportCount() const { return m_droppedReports.load(std::memory_order_relaxed); }
+    int64_t GetDrainLockWaitNs() const { return m_drainMutex.GetWaitNs(); }
+    uint64_t GetDrainLockContentionCount() const { return m_drainMutex.GetContendedCount(); }
+
+    // Decode a batch of events into the sample queue. Called by the reader
+    // thread; exposed so tests and benchmarks can feed events directly.
+    void ProcessEvents(const input_event* events, size_t count);
+
+private:
+    bool OpenDevice();
+    void CloseDescriptors();
+    void ReadLoop();
+    bool ReadAvailable();  // returns false on end of stream or error
+
+    std::string m_devicePath;
+    int m_fd = -1;
+    int m_epollFd = -1;
+    int m_wakeFd = -1;         // eventfd used to interrupt epoll_wait on Stop()
+    bool m_pollable = false;   // false for regular files, which epoll rejects
+    bool m_kernelTimestamps = false;  // event times are CLOCK_MONOTONIC
+
+    std::thread m_readerThread;
+    std::atomic<bool> m_running{false};
+    mutable std::mutex m_policyMutex;
+    ThreadPolicyConfig m_threadPolicy;
+    AppliedThreadPolicy m_appliedPolicy;
+    std::atomic<bool> m_endOfStream{false};
+
+    // Reader-thread state: motion since the last SYN_REPORT
+    int32_t m_pendingX = 0;
+    int32_t m_pendingY = 0;
+    bool m_dropping = false;   // discarding until next SYN_REPORT after SYN_DROPPED
+
+    // Read buffer; a partial input_event left by a short pipe read is kept
+    // at the front and completed by the next read
+    alignas(input_event) unsigned char m_readBuffer[kReadBatch * sizeof(input_event)] = {};
+    size_t m_bufferFill = 0;
+
+    InputSampleQueue m_samples;
+    mutable TimedMutex m_drainMutex;  // serializes consumers only
+
+    std::atomic<uint64_t> m_readCount{0};
+    std::atomic<uint64_t> m_eventCount{0};
+    std::atomic<uint64_t> m_droppedReports{0};
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,133 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "common/IClock.h"
+#include "common/UdpSocket.h"
+#include "core/IFrameClock.h"
+
+namespace Mouse2VR {
+
+enum class FrameClockSource {
+    None,  // Free-running at the configured update rate
+    Udp    // Vsync timestamps sent to a loopback UDP port (FrameClockPacket)
+};
+
+const char* FrameClockSourceToString(FrameClockSource source);
+FrameClockSource FrameClockSourceFromString(const std::string& name);  // None if unknown
+
+struct FrameClockConfig {
+    FrameClockSource source = FrameClockSource::None;
+    int port = 47810;     // Loopback port for the Udp source
+    int leadUs = 2000;    // How long before each vsync an update should land
+
+    bool operator==(const FrameClockConfig& other) const {
+        return source == other.source && port == other.port && leadUs == other.leadUs;
+    }
+};
+
+// Output tick grid locked to a frame clock.
+//
+// Grid points sit leadNs before vsyncs. The spacing is the whole number of
+// ticks per frame (or frames per tick) closest to the requested rate, so
+// every frame sees its update at the same phase instead of beating against
+// it. The grid is anchored to absolute time, so it stays put while the
+// clock reports newer vsyncs of the same cadence.
+struct PhaseGrid {
+    int64_t anchorNs = 0;  // A grid point, reduced modulo stepNs
+    int64_t stepNs = 0;
+
+    static PhaseGrid Create(const FrameTiming& timing, int64_t leadNs, int targetHz);
+
+    // First grid point strictly after ns
+    int64_t NextAfter(int64_t ns) const;
+
+    // Signed distance from ns to the nearest grid point (positive = late)
+    int64_t ErrorAt(int64_t ns) const;
+};
+
+// Frame clock with a fixed cadence: vsyncs at phaseNs + k * periodNs.
+// Stand-in for a real compositor in tests and benchmarks. Reads the steady
+// clock unless given the clock the core runs on (e.g. a SimulatedClock).
+class SyntheticFrameClock : public IFrameClock {
+public:
+    explicit SyntheticFrameClock(int64_t periodNs, int64_t phaseNs = 0, std::shared_ptr<IClock> clock = nullptr)
+        : m_periodNs(periodNs), m_phaseNs(phaseNs), m_clock(std::move(clock)) {}
+
+    // Change cadence while running (any thread)
+    void SetTiming(int64_t periodNs, int64_t phaseNs) {
+        m_periodNs.store(periodNs, std::memory_order_relaxed);
+        m_phaseNs.store(phaseNs, std::memory_order_relaxed);
+    }
+
+    // Make GetTiming() report no timing, as a stalled feed would
+    void SetAvailable(bool available) { m_available.store(available, std::memory_order_relaxed); }
+
+    FrameTiming GetTiming() override;
+    const char* GetName() const override { return "synthetic"; }
+
+    // Vsync at or before nowNs
+    int64_t LastVsyncAt(int64_t nowNs) const;
+
+private:
+    std::atomic<int64_t> m_periodNs;
+    std::atomic<int64_t> m_phaseNs;
+    std::atomic<bool> m_available{true};
+    std::shared_ptr<IClock> m_clock;
+};
+
+// Wire format of the UDP feed, host byte order (the feed is loopback only)
+struct FrameClockPacket {
+    static constexpr uint32_t kMagic = 0x4346324D;  // "M2FC"
+    static constexpr uint32_t kVersion = 1;
+
+    uint32_t magic = kMagic;
+    uint32_t version = kVersion;
+    int64_t vsyncNs = 0;   // Steady clock (CLOCK_MONOTONIC / QueryPerformanceCounter)
+    int64_t periodNs = 0;
+};
+static_assert(sizeof(FrameClockPacket) == 24, "FrameClockPacket is a wire format");
+
+// Frame clock fed by FrameClockPackets on a loopback UDP port, e.g. from a
+// compositor plugin reporting its vsync timestamps. GetTiming() drains the
+// socket without blocking and keeps the newest packet; timing older than
+// staleAfterNs is reported as unavailable so the scheduler free-runs.
+class UdpFrameClock : public IFrameClock {
+public:
+    explicit UdpFrameClock(uint16_t port, int64_t staleAfterNs = 250000000);
+
+    bool IsOpen() const { return m_open; }
+    uint16_t GetPort() const { return m_port; }  // Bound port (useful when created with 0)
+
+    FrameTiming GetTiming() override;
+    const char* GetName() const override { return "udp"; }
+
+    uint64_t GetPacketCount() const { return m_packets; }
+    uint64_t GetRejectedCount() const { return m_rejected; }
+
+private:
+    UdpSocket m_socket;
+    bool m_open = false;
+    uint16_t m_port = 0;
+    int64_t m_staleAfterNs;
+    FrameTiming m_timing;
+    int64_t m_receivedNs = 0;
+    uint64_t m_packets = 0;
+    uint64_t m_rejected = 0;
+};
+
+// Sends FrameClockPackets to a UdpFrameClock on the same machine
+class FrameClockSender {
+public:
+    explicit FrameClockSender(uint16_t port);
+
+    bool IsOpen() const { return m_socket.IsOpen(); }
+    bool Send(const FrameTiming& timing);
+
+private:
+    UdpSocket m_socket;
+    uint16_t m_port;
+};
+
+} // namespace Mouse2VR
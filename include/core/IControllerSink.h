@@ -0,0 +1,32 @@
+#pragma once
+
+namespace Mouse2VR {
+
+// Destination for processed stick values (virtual gamepad, test double, ...).
+//
+// Mouse2VRCore calls SetSpeed(), SetLeftStick() and then Update() once per
+// output tick on the processing thread; Update() returns once the report
+// has been handed to the driver.
+class IControllerSink {
+public:
+    virtual ~IControllerSink() = default;
+    
+    virtual bool Initialize() = 0;
+    virtual void Shutdown() = 0;
+    
+    // Stick position (-1.0 to 1.0)
+    virtual void SetLeftStick(float x, float y) = 0;
+    
+    // Belt speed behind the stick value, for sinks that forward it
+    virtual void SetSpeed(float metersPerSecond) { (void)metersPerSecond; }
+    
+    // Send current state to the device
+    virtual void Update() = 0;
+    
+    virtual bool IsConnected() const = 0;
+    
+    // Short name for logging ("ViGEm", ...)
+    virtual const char* GetName() const = 0;
+};
+
+} // namespace Mouse2VR
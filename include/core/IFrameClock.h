@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+
+namespace Mouse2VR {
+
+// Display refresh timing on the steady clock (InputSampleQueue::NowNs()
+// time base): one recent vsync and the frame period
+struct FrameTiming {
+    int64_t vsyncNs = 0;
+    int64_t periodNs = 0;  // 0 = no timing available
+
+    bool IsValid() const { return periodNs > 0; }
+};
+
+// Source of headset/compositor frame timing that Mouse2VRCore's fixed-rate
+// scheduler phase-locks its output to.
+//
+// GetTiming() is called from the processing thread once per tick and must
+// not block; implementations that receive timing from elsewhere return the
+// latest value they have (or an invalid FrameTiming once it goes stale).
+class IFrameClock {
+public:
+    virtual ~IFrameClock() = default;
+
+    virtual FrameTiming GetTiming() = 0;
+
+    // Short name for logging ("synthetic", "udp", ...)
+    virtual const char* GetName() const = 0;
+};
+
+} // namespace Mouse2VR
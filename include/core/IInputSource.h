@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "core/MouseDelta.h"
+#include "core/InputSampleQueue.h"
+#include "common/ThreadPolicy.h"
+#include "common/WakeEvent.h"
+
+namespace Mouse2VR {
+
+// Source of relative treadmill counts consumed by Mouse2VRCore.
+//
+// Implementations capture input on their own thread (or from a window
+// message pump) and hand it to the processing thread through the drain
+// methods, which are safe to call while capture is running.
+class IInputSource {
+public:
+    virtual ~IInputSource() = default;
+    
+    // Begin/stop delivering input (called from Mouse2VRCore::Start/Stop)
+    virtual bool Start() = 0;
+    virtual void Stop() = 0;
+    
+    // Get accumulated deltas since last call (thread-safe)
+    virtual MouseDelta GetAndResetDeltas() = 0;
+    
+    // Move up to maxCount timestamped samples into out, oldest first (thread-safe)
+    virtual size_t DrainSamples(InputSample* out, size_t maxCount) = 0;
+    
+    // Current time in the time base of the sample timestamps, which is not
+    // necessarily the core's clock; latency is measured against this
+    virtual int64_t NowNs() const { return InputSampleQueue::NowNs(); }
+    
+    // Signal wake after new input is queued, so Mouse2VRCore can run
+    // event-driven instead of polling (nullptr to detach)
+    virtual void SetWakeEvent(WakeEvent* wake) = 0;
+    
+    // Scheduling policy for the thread that captures input, applied by that
+    // thread the next time it runs. Sources without a capture thread of
+    // their own ignore it.
+    virtual void SetThreadPolicy(const ThreadPolicyConfig& policy) { (void)policy; }
+    virtual AppliedThreadPolicy GetAppliedThreadPolicy() const { return {}; }
+    
+    // Input path statistics
+    virtual uint64_t GetSampleCount() const = 0;
+    virtual uint64_t GetMergedSampleCount() const = 0;
+    
+    // Short name for logging ("RawInput", "evdev", ...)
+    virtual const char* GetName() const = 0;
+};
+
+} // namespace Mouse2VR
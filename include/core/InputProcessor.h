@@ -1,6 +1,15 @@
 #pragma once
-#include "core/RawInputHandler.h"
+#include "core/MouseDelta.h"
+#include "core/ResponseCurve.h"
+#include "core/VelocityEstimator.h"
+#include "core/VelocityPredictor.h"
 #include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <vector>
 
 namespace Mouse2VR {
 
@@ -15,8 +24,55 @@ struct ProcessingConfig {
     
     // Calibration values
     float countsPerMeter = 39370.1f;  // Default: 1000 DPI * 39.3701 inches/meter
+    
+    // Filtering of the per-tick belt velocity
+    VelocityEstimatorConfig velocity;
+    
+    // Forward projection of the filtered velocity
+    PredictionConfig prediction;
+    
+    // Speed-to-deflection shaping (applied to the deflection magnitude)
+    ResponseCurveConfig curve;
+};
+
+// Immutable view of a ProcessingConfig with everything the per-tick path
+// needs precomputed. Published by SetConfig and never modified afterwards.
+struct ProcessingSnapshot {
+    ProcessingConfig config;
+    uint64_t version = 0;            // 1 for the first config, +1 per publish
+    
+    float dpi = 0.0f;                // countsPerMeter / 39.3701
+    float stickScale = 0.0f;         // counts/s -> deflection: 0.0254 / 6.1 / dpi * sensitivity
+    float realWorldScale = 0.0f;     // counts/s -> belt m/s: 1 / countsPerMeter (0 if uncalibrated)
+    float gameSpeedScale = 0.0f;     // counts/s -> game m/s: realWorldScale * sensitivity
+    float deadzoneScale = 1.0f;      // 1 / (1 - deadzone)
+    ResponseCurve curve;             // Compiled config.curve
+    
+    static std::unique_ptr<ProcessingSnapshot> Create(const ProcessingConfig& config, uint64_t version);
+};
+
+// Vector instruction set used by ProcessBatch
+enum class SimdLevel : uint8_t {
+    Scalar = 0,
+    Sse2 = 1,
+    Avx2 = 2
 };
 
+const char* SimdLevelToString(SimdLevel level);
+
+// Best level supported by both this build and the running CPU
+SimdLevel DetectSimdLevel();
+
+// Maps belt counts to stick deflection.
+//
+// Threading: ProcessDelta/ProcessBatch run on a single processing thread.
+// SetConfig, ModifyConfig, GetConfig, calibration and the metric getters
+// may be called from any thread. A config change publishes a new immutable
+// ProcessingSnapshot with one atomic store; the processing thread picks it
+// up with one atomic load per tick, so the hot path never takes a lock.
+// Snapshots the processing thread can no longer see are freed on the next
+// publish. A processing thread that stops ticking (parked, stopped) calls
+// ReleaseSnapshot so publishes meanwhile free everything but the newest.
 class InputProcessor {
 public:
     InputProcessor();
@@ -24,39 +80,93 @@ public:
     // Process raw mouse delta and return stick position
     void ProcessDelta(const MouseDelta& delta, float deltaTime, float& outX, float& outY);
     
+    // Process a run of ticks at once (replay, offline analysis). Produces the
+    // same stick and speed values, bit for bit, as calling ProcessDelta and
+    // GetSpeedMetersPerSecond for each element in turn. Processes as many
+    // elements as the shortest span holds.
+    void ProcessBatch(std::span<const MouseDelta> deltas, std::span<const float> deltaTimes,
+                      std::span<float> outX, std::span<float> outY, std::span<float> outSpeed);
+    
+    // Instruction set for ProcessBatch (capped at DetectSimdLevel())
+    void SetSimdLevel(SimdLevel level);
+    SimdLevel GetSimdLevel() const { return m_simdLevel; }
+    
     // Update configuration
     void SetConfig(const ProcessingConfig& config);
     ProcessingConfig GetConfig() const;
     
+    // Read-modify-write of the config without losing concurrent updates
+    void ModifyConfig(const std::function<void(ProcessingConfig&)>& modify);
+    
+    // Version of the newest published snapshot
+    uint64_t GetConfigVersion() const;
+    
+    // Snapshots currently kept alive (the newest plus any the processing
+    // thread may still be reading)
+    size_t GetLiveSnapshotCount() const;
+    
+    // Processing thread: no snapshot is held until the next tick. Call
+    // before blocking without ticking; the next tick re-acquires.
+    void ReleaseSnapshot();
+    
     // Calibration
     void StartCalibration();
     void EndCalibration(float distanceMeters);
     bool IsCalibrating() const { return m_calibrating; }
     
     // Get game speed in m/s (real world speed * sensitivity multiplier)
-    float GetSpeedMetersPerSecond() const { return m_currentSpeed; }
+    float GetSpeedMetersPerSecond() const { return m_currentSpeed.load(std::memory_order_relaxed); }
     
     // Get real world speed in m/s (without multiplier)
-    float GetRealWorldSpeed() const { return m_realWorldSpeed; }
+    float GetRealWorldSpeed() const { return m_realWorldSpeed.load(std::memory_order_relaxed); }
     
     // Get stick deflection percentage (0-100)
     float GetStickDeflectionPercent() const;
 
 private:
-    ProcessingConfig m_config;
+    // === Snapshot publication ===
+    std::atomic<const ProcessingSnapshot*> m_snapshot{nullptr};
+    std::atomic<uint64_t> m_readerVersion{0};  // Oldest version the processing thread may hold
+    std::atomic<bool> m_readerActive{false};   // Processing thread may hold a snapshot at all
+    mutable std::mutex m_publishMutex;         // Serializes writers; never taken per tick
+    std::vector<std::unique_ptr<ProcessingSnapshot>> m_snapshots;  // Live, oldest first
+    
     std::atomic<bool> m_calibrating{false};
     
-    // Calibration data
-    MouseDelta m_calibrationDeltas;
+    // Calibration data (accumulated on the processing thread)
+    std::atomic<long> m_calibrationCountsX{0};
+    std::atomic<long> m_calibrationCountsY{0};
+    
+    // Current state (written per tick, read by the UI)
+    std::atomic<float> m_currentSpeed{0.0f};      // Game speed (with multiplier)
+    std::atomic<float> m_realWorldSpeed{0.0f};    // Real world speed (without multiplier)
+    std::atomic<float> m_lastStickX{0.0f};
+    std::atomic<float> m_lastStickY{0.0f};
+    
+    // === Processing thread only ===
+    
+    // Velocity estimation per axis (counts/s)
+    VelocityEstimator m_velocityX;
+    VelocityEstimator m_velocityY;
+    VelocityPredictor m_predictX;
+    VelocityPredictor m_predictY;
+    uint64_t m_appliedVersion = 0;  // Snapshot the estimators were configured from
+    bool m_holdingSnapshot = false; // m_readerActive as last set by this thread
+    
+    SimdLevel m_simdLevel;
+    
+    // Called with m_publishMutex held
+    void PublishLocked(const ProcessingConfig& config);
+    
+    // Current snapshot for this tick; reconfigures the filters when it changed
+    const ProcessingSnapshot& AcquireSnapshot();
     
-    // Current state
-    float m_currentSpeed = 0.0f;      // Game speed (with multiplier)
-    float m_realWorldSpeed = 0.0f;    // Real world speed (without multiplier)
-    float m_lastStickX = 0.0f;
-    float m_lastStickY = 0.0f;
+    // Filtered (and predicted) velocity plus speed metrics for one tick
+    void EstimateVelocity(const ProcessingSnapshot& snapshot, const MouseDelta& delta, float deltaTime,
+                          float& countsPerSecX, float& countsPerSecY, float& gameSpeed);
     
     // Apply deadzone to stick value
-    float ApplyDeadzone(float value) const;
+    static float ApplyDeadzone(const ProcessingSnapshot& snapshot, float value);
 };
 
 } // namespace Mouse2VR
\ No newline at end of file
@@ -0,0 +1,128 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "common/SpscRing.h"
+#include "common/WakeEvent.h"
+#include "core/MouseDelta.h"
+
+namespace Mouse2VR {
+
+// One mouse report as it arrived from the device
+struct InputSample {
+    int64_t timestampNs = 0;  // steady_clock time of arrival
+    int32_t dx = 0;
+    int32_t dy = 0;
+};
+
+// Timestamped input path between the input thread and the processing thread.
+//
+// Push() is wait-free and never loses counts: when the ring is full the
+// sample is folded into an overflow accumulator (and counted as merged)
+// which the consumer picks up on its next drain. Until then later pushes
+// join the accumulator too, so it always holds the newest counts and
+// drained timestamps never go backwards. If a wake event is set,
+// every push signals it so an event-driven consumer can block instead of
+// polling.
+class InputSampleQueue {
+public:
+    static constexpr size_t kCapacity = 4096;
+
+    static int64_t NowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Producer side (single thread)
+    void Push(int64_t timestampNs, int32_t dx, int32_t dy) {
+        if (!HasOverflow() && m_ring.TryPush(InputSample{timestampNs, dx, dy})) {
+            m_pushedCount.store(m_pushedCount.load(std::memory_order_relaxed) + 1,
+                                std::memory_order_relaxed);
+        } else {
+            m_overflowX.fetch_add(dx, std::memory_order_relaxed);
+            m_overflowY.fetch_add(dy, std::memory_order_relaxed);
+            m_overflowTimestampNs.store(timestampNs, std::memory_order_relaxed);
+            m_mergedCount.store(m_mergedCount.load(std::memory_order_relaxed) + 1,
+                                std::memory_order_release);
+        }
+        
+        if (WakeEvent* wake = m_wakeEvent.load(std::memory_order_acquire)) {
+            wake->Signal();
+        }
+    }
+
+    void Push(int32_t dx, int32_t dy) { Push(NowNs(), dx, dy); }
+
+    // Consumer side (single thread): copy up to maxCount samples into out,
+    // oldest first. Counts merged during overflow are returned as one
+    // trailing sample once the ring itself has been emptied; with a small
+    // maxCount that can be a later call.
+    size_t Drain(InputSample* out, size_t maxCount) {
+        size_t count = m_ring.PopBatch(out, maxCount);
+        if (count < maxCount && HasOverflow()) {
+            InputSample merged;
+            merged.timestampNs = m_overflowTimestampNs.load(std::memory_order_relaxed);
+            merged.dx = static_cast<int32_t>(m_overflowX.exchange(0, std::memory_order_relaxed));
+            merged.dy = static_cast<int32_t>(m_overflowY.exchange(0, std::memory_order_relaxed));
+            if (merged.dx != 0 || merged.dy != 0) {
+                out[count++] = merged;
+            }
+        }
+        return count;
+    }
+
+    // Consumer side: remove everything and return the summed counts
+    MouseDelta DrainAggregate() {
+        MouseDelta total;
+        m_ring.ConsumeAll([&total](const InputSample& s) {
+            total.x += s.dx;
+            total.y += s.dy;
+        });
+        total.x += static_cast<long>(m_overflowX.exchange(0, std::memory_order_relaxed));
+        total.y += static_cast<long>(m_overflowY.exchange(0, std::memory_order_relaxed));
+        return total;
+    }
+
+    // Consumer side: summed counts currently queued, without removing them
+    MouseDelta PeekAggregate() const {
+        MouseDelta total;
+        m_ring.Peek([&total](const InputSample& s) {
+            total.x += s.dx;
+            total.y += s.dy;
+        });
+        total.x += static_cast<long>(m_overflowX.load(std::memory_order_relaxed));
+        total.y += static_cast<long>(m_overflowY.load(std::memory_order_relaxed));
+        return total;
+    }
+
+    size_t SizeApprox() const { return m_ring.SizeApprox(); }
+    
+    // Signal this event after every push (nullptr to stop). The event must
+    // outlive the queue or be cleared before it is destroyed.
+    void SetWakeEvent(WakeEvent* wake) { m_wakeEvent.store(wake, std::memory_order_release); }
+
+    // Statistics (readable from any thread)
+    uint64_t GetPushedCount() const { return m_pushedCount.load(std::memory_order_relaxed); }
+    uint64_t GetMergedCount() const { return m_mergedCount.load(std::memory_order_relaxed); }
+
+private:
+    bool HasOverflow() const {
+        return m_overflowX.load(std::memory_order_relaxed) != 0 ||
+               m_overflowY.load(std::memory_order_relaxed) != 0;
+    }
+
+    SpscRing<InputSample, kCapacity> m_ring;
+
+    // Overflow accumulator used only while the ring is full
+    std::atomic<int64_t> m_overflowX{0};
+    std::atomic<int64_t> m_overflowY{0};
+    std::atomic<int64_t> m_overflowTimestampNs{0};
+
+    std::atomic<uint64_t> m_pushedCount{0};
+    std::atomic<uint64_t> m_mergedCount{0};
+    
+    std::atomic<WakeEvent*> m_wakeEvent{nullptr};
+};
+
+} // namespace Mouse2VR
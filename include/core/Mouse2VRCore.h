@@ -1,30 +1,86 @@
 #pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <atomic>
 #include <mutex>
 #include <chrono>
+#include <string>
 #include <thread>
+#include <vector>
 
 // Include Windows.h for HWND
 #include "common/WindowsHeaders.h"
+#include "common/DeadlineTimer.h"
+#include "common/IClock.h"
+#include "common/LatencyHistogram.h"
+#include "common/ThreadPolicy.h"
+#include "common/WakeEvent.h"
+#include "core/ActivityTracker.h"
+#include "core/Telemetry.h"
 
 namespace Mouse2VR {
 
 // Forward declarations
+class IInputSource;
 class RawInputHandler;
-class ViGEmController;
+class IControllerSink;
+class IFrameClock;
 class InputProcessor;
 class ConfigManager;
+class SessionRecorder;
+class SharedStatePublisher;
+class OutputFanout;
+struct OutputSinkStats;
 struct AppConfig;
+struct SettingsChange;
+struct ConfigSaveStats;
+struct MouseDelta;
 
 // Simple data structure for mouse/controller state
 struct ControllerState {
-    double speed = 0.0;
+    double speed = 0.0;       // Game speed, m/s (belt speed * sensitivity)
+    double beltSpeed = 0.0;   // Belt speed, m/s
     double stickX = 0.0;
     double stickY = 0.0;
     int updateRate = 60;
 };
 
+// Scheduler timing since start (or the last reset). Lateness is how long
+// after its deadline each tick was released; tick time covers drain,
+// processing and the controller update.
+struct SchedulerStats {
+    LatencyStats lateness;
+    LatencyStats tickTime;
+    uint64_t ticks = 0;
+    uint64_t missedFrames = 0;  // Ticks whose deadline had passed before the wait
+    int targetHz = 0;
+    int achievedHz = 0;
+};
+
+// Phase of controller updates relative to the external frame clock's
+// target (leadNs before a vsync). Errors are measured when each update's
+// controller submit returns; positive means later than the target.
+struct PhaseStats {
+    bool locked = false;         // Last tick was scheduled from frame timing
+    int64_t framePeriodNs = 0;
+    int64_t stepNs = 0;          // Update spacing on the phase-locked grid
+    int64_t leadNs = 0;
+    uint64_t lockedTicks = 0;
+    uint64_t unlockedTicks = 0;  // Ticks that ran free (no clock, or no timing)
+    double meanErrorNs = 0.0;
+    LatencyStats absError;       // |error| distribution
+};
+
+// Scheduling the processing and input threads actually got (see
+// AppliedThreadPolicy::failures for settings the OS refused)
+struct ThreadPolicyReport {
+    AppliedThreadPolicy processing;
+    AppliedThreadPolicy input;     // applied == false until the input thread has run
+    bool memoryLocked = false;
+};
+
 // Main core class that manages all the components
 class Mouse2VRCore {
 public:
@@ -33,7 +89,15 @@ public:
     
     // Lifecycle
     bool Initialize();
+#ifdef _WIN32
     bool Initialize(HWND hwnd);
+#endif
+    // Initialize with a caller-provided input source (evdev, test sources, ...)
+    // and the platform's default controller sink
+    bool Initialize(std::unique_ptr<IInputSource> inputSource);
+    // Initialize with caller-provided input and output (tests, benchmarks)
+    bool Initialize(std::unique_ptr<IInputSource> inputSource,
+                    std::unique_ptr<IControllerSink> controller);
     void Start();
     void Stop();
     void Shutdown();
@@ -51,6 +115,31 @@ public:
     void SetLockX(bool lock);
     void SetCountsPerMeter(float countsPerMeter);
     
+    // Apply several settings at once: one processor config publish and one
+    // config save request for the whole change. Values are clamped like the
+    // single setters above.
+    void ApplySettings(const SettingsChange& change);
+    
+    // Setters only request a save; config.json is written in the background
+    // once changes settle (see ConfigManager::RequestSave). Shutdown()
+    // flushes a pending save.
+    ConfigSaveStats GetConfigSaveStats() const;
+    bool FlushConfig();
+    uint64_t GetProcessorConfigVersion() const;  // Bumped by every processor config publish
+    
+    // Event-driven scheduling: arriving input wakes the processing thread and
+    // is published after at most the coalescing window (a lone event goes out
+    // immediately). The fixed update rate then only paces idle updates.
+    void SetEventDriven(bool enabled);
+    bool IsEventDriven() const { return m_eventDriven.load(); }
+    void SetCoalescing(int coalesceWindowUs, int maxOutputRateHz);
+    
+    // Adaptive scheduling: after idleTimeoutMs without input either scheduler
+    // drops to the idle update interval, or parks until input arrives when
+    // that interval is 0. The first count restores the full rate.
+    void SetAdaptiveMode(bool enabled, int idleUpdateIntervalMs, int idleTimeoutMs);
+    bool IsAdaptiveMode() const { return m_adaptiveMode.load(); }
+    
     // Statistics
     double GetCurrentSpeed() const;
     double GetAverageSpeed() const;
@@ -59,12 +148,72 @@ public:
     int GetSpeedQueryCount() const { return m_speedQueryCount.load(); }
     void ResetSpeedQueryCount() { m_speedQueryCount = 0; }
     
+    // Motion-to-output latency: time from each input sample's arrival to the
+    // return of the controller Update() that carried it
+    LatencyStats GetLatencyStats() const { return m_latency.GetStats(); }
+    void ResetLatencyStats() { m_latency.Reset(); }
+    
+    // Lock-free snapshot of the scheduler's per-tick timing
+    SchedulerStats GetSchedulerStats() const;
+    void ResetSchedulerStats();
+    
+    // Phase-lock the fixed-rate scheduler to an external frame clock (call
+    // while stopped; nullptr detaches). Updates then land leadUs before each
+    // vsync, at the whole number of updates per frame nearest the update
+    // rate. Without valid timing the scheduler free-runs as before. The
+    // event-driven scheduler stays input-driven and ignores the clock.
+    bool SetFrameClock(std::unique_ptr<IFrameClock> frameClock);
+    void SetFrameLead(int leadUs);
+    PhaseStats GetPhaseStats() const;
+    void ResetPhaseStats();
+    
+    // Per-tick telemetry for the UI: while enabled, every published state is
+    // buffered until the UI thread takes it as one batch per frame
+    void SetTelemetryEnabled(bool enabled) { m_telemetryEnabled = enabled; }
+    size_t TakeTelemetry(TelemetryBatch& batch);
+    
+    // Secondary controller sinks fed from the processing thread's results by
+    // worker threads, each at its own rate (0 = every result); the primary
+    // sink stays inline and is never delayed by them. Call while stopped.
+    bool AddOutputSink(std::unique_ptr<IControllerSink> sink, int rateHz);
+    std::vector<OutputSinkStats> GetOutputSinkStats() const;
+    
+    // Publish every tick's state to a shared-memory channel for other
+    // processes (call while stopped; nullptr stops publishing). Readers use
+    // the header-only SharedStateReader.
+    bool SetStatePublisher(std::unique_ptr<SharedStatePublisher> publisher);
+    
+    // Scheduling policy for the processing and input threads and optional
+    // memory locking; applied on the next Start(). Real-time classes need
+    // CAP_SYS_NICE (or RLIMIT_RTPRIO) on Linux, which GetThreadPolicyReport()
+    // shows when missing.
+    void SetThreadPolicy(const ThreadPolicyConfig& processing, const ThreadPolicyConfig& input, bool lockMemory);
+    ThreadPolicyReport GetThreadPolicyReport() const;
+    
+    // Time base for every timestamp and wait of the schedulers (call while
+    // stopped; nullptr restores the steady clock). With a SimulatedClock the
+    // schedulers run in virtual time, as fast as the host allows.
+    bool SetClock(std::shared_ptr<IClock> clock);
+    IClock& GetClock() const { return *m_clock; }
+    
+    // Processing thread CPU and wall time per activity state. The idle/active
+    // state is tracked whether or not adaptive mode is on, so the cost of
+    // idling at full rate can be compared with the adaptive schedule.
+    ActivityStats GetActivityStats() const;
+    void ResetActivityStats();
+    
+    // Session recording (raw input reaching the processor, for offline replay)
+    bool StartRecording(const std::string& path);
+    void StopRecording();
+    bool IsRecording() const;
+    
     // Testing
     void StartMovementTest();
     bool IsTestRunning() const { return m_isTestRunning; }
     
-    // Internal access for WM_INPUT processing
-    RawInputHandler* GetInputHandler() const { return m_inputHandler.get(); }
+    // Internal access for WM_INPUT processing (nullptr for non-Raw Input sources)
+    RawInputHandler* GetInputHandler() const { return m_rawInputHandler; }
+    IInputSource* GetInputSource() const { return m_inputSource.get(); }
     
     // Test interfaces
     struct ProcessorConfig {
@@ -84,10 +233,14 @@ public:
     std::string GetCurrentSettingsSnapshot() const;
     
 private:
-    std::unique_ptr<RawInputHandler> m_inputHandler;
-    std::unique_ptr<ViGEmController> m_controller;
+    // Declared before the input source so it outlives any producer signaling it
+    WakeEvent m_inputEvent;
+    std::unique_ptr<IInputSource> m_inputSource;
+    RawInputHandler* m_rawInputHandler = nullptr;  // Non-owning view when the source is Raw Input
+    std::unique_ptr<IControllerSink> m_controller;
     std::unique_ptr<InputProcessor> m_processor;
     std::unique_ptr<ConfigManager> m_config;
+    std::unique_ptr<SessionRecorder> m_recorder;
     
     std::atomic<bool> m_isRunning;
     std::atomic<bool> m_isInitialized;
@@ -96,19 +249,106 @@ private:
     mutable std::mutex m_stateMutex;
     ControllerState m_currentState;
     
-    // Timing
-    std::chrono::steady_clock::time_point m_lastUpdate;
+    // Timing; the clock is replaced only while stopped
+    std::shared_ptr<IClock> m_clock;
+    int64_t m_lastUpdateNs;
     std::atomic<int> m_updateRateHz{60};  // Default 60Hz
     
+    // Event-driven scheduling
+    std::atomic<bool> m_eventDriven{false};
+    std::atomic<int> m_coalesceWindowUs{1000};
+    std::atomic<int> m_maxOutputRateHz{1000};
+    
+    // Adaptive scheduling (idle interval 0 = park until input)
+    std::atomic<bool> m_adaptiveMode{false};
+    std::atomic<int> m_idleUpdateIntervalMs{33};
+    std::atomic<int> m_idleTimeoutMs{500};
+    
+    // Tick deadlines; the timer belongs to the processing thread, which
+    // picks up strategy changes at the next tick
+    std::atomic<TimerStrategy> m_timerStrategy{TimerStrategy::Precise};
+    DeadlineTimer m_timer;
+    
+    // Activity state machine and stats, owned by the processing thread. Wall
+    // and CPU time are rolled up on state changes, around parking and every
+    // kActivityRollupNs, so a tick costs no CPU clock read.
+    static constexpr int64_t kActivityRollupNs = 100000000;
+    ActivityTracker m_activity;
+    ActivityStats m_activityStats;
+    int64_t m_activityMarkNs = 0;     // Wall/CPU time accounted up to here
+    int64_t m_activityMarkCpuNs = 0;
+    
+    // Copy of m_activityStats for readers, guarded by a seqlock (odd while
+    // the processing thread is writing)
+    struct PublishedActivity {
+        std::atomic<uint64_t> lock{0};
+        std::atomic<bool> live{false};  // Processing thread running, markNs current
+        std::atomic<int64_t> markNs{0};
+        std::atomic<ActivityState> state{ActivityState::Active};
+        std::atomic<bool> parked{false};
+        std::atomic<int64_t> cpuNs[2]{};
+        std::atomic<int64_t> wallNs[2]{};
+        std::atomic<uint64_t> ticks[2]{};
+        std::atomic<uint64_t> idleTransitions{0};
+        std::atomic<uint64_t> wakeTransitions{0};
+    };
+    PublishedActivity m_publishedActivity;
+    
+    // Stats at the last ResetActivityStats; readers only
+    mutable std::mutex m_activityBaselineMutex;
+    ActivityStats m_activityBaseline;
+    
     // Actual update rate tracking
-    std::chrono::steady_clock::time_point m_rateTrackingStart;
+    int64_t m_rateTrackingStartNs = 0;
     std::atomic<int> m_updateCount{0};
     std::atomic<int> m_actualUpdateRate{0};
     mutable std::atomic<int> m_speedQueryCount{0};
     
+    // Latency tracking: arrival times of the samples in the current tick,
+    // recorded into the histogram once the report is submitted
+    static constexpr size_t kMaxTrackedArrivals = 4096;
+    std::array<int64_t, kMaxTrackedArrivals> m_tickArrivalNs{};
+    size_t m_tickArrivalCount = 0;
+    LatencyHistogram m_latency;
+    
+    // Scheduler timing, written by the processing thread only
+    LatencyHistogram m_tickLateness;
+    LatencyHistogram m_tickTime;
+    std::atomic<uint64_t> m_schedulerTicks{0};
+    std::atomic<uint64_t> m_missedFrames{0};
+    
+    // Frame clock phase lock (clock owned by the processing thread while running)
+    std::unique_ptr<IFrameClock> m_frameClock;
+    std::atomic<int> m_frameLeadUs{2000};
+    std::atomic<bool> m_phaseLocked{false};
+    std::atomic<int64_t> m_framePeriodNs{0};
+    std::atomic<int64_t> m_phaseStepNs{0};
+    std::atomic<uint64_t> m_lockedTicks{0};
+    std::atomic<uint64_t> m_unlockedTicks{0};
+    std::atomic<int64_t> m_phaseErrorSumNs{0};
+    LatencyHistogram m_phaseError;
+    
+    // UI telemetry, filled by the processing thread
+    std::atomic<bool> m_telemetryEnabled{false};
+    TelemetryBuffer m_telemetry;
+    
+    // Secondary sinks, fed by the processing thread
+    std::unique_ptr<OutputFanout> m_outputs;
+    
+    // Shared-memory state channel, written by the processing thread
+    std::unique_ptr<SharedStatePublisher> m_statePublisher;
+    
+    // Thread policy, applied by each thread as it starts
+    mutable std::mutex m_threadPolicyMutex;
+    ThreadPolicyConfig m_processingPolicy;
+    ThreadPolicyConfig m_inputPolicy;
+    bool m_lockMemory = false;
+    bool m_memoryLocked = false;
+    AppliedThreadPolicy m_processingPolicyApplied;
+    
     // Testing
     std::atomic<bool> m_isTestRunning{false};
-    std::chrono::steady_clock::time_point m_testStartTime;
+    int64_t m_testStartNs = 0;
     float m_testDuration = 5.0f;
     int m_testUpdateCount = 0;
     float m_testTotalDistance = 0.0f;
@@ -120,7 +360,22 @@ private:
     
     // Internal methods
     void ProcessingLoop();
+    void FixedRateLoop();
+    void EventDrivenLoop();
     void UpdateController();
+    size_t DrainInput(MouseDelta& delta);
+    void ProcessAndPublish(const MouseDelta& delta);
+    void ApplyTimerStrategy();
+    void ApplyProcessingThreadPolicy();
+    void AccountActivity(int64_t nowNs);
+    void UpdateActivity(bool hasInput, bool published);
+    void SetParked(bool parked);
+    void PublishActivity(bool live);
+    ActivityStats ReadActivity() const;  // Published stats, wall time extended to now
+    void PublishCentered();
+    void PublishState(const ControllerState& state, bool running);
+    bool ShouldPark() const;
+    std::chrono::nanoseconds IdleInterval() const;
 };
 
 } // namespace Mouse2VR
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace Mouse2VR {
+
+struct MouseDelta {
+    long x = 0;
+    long y = 0;
+    
+    void reset() {
+        x = 0;
+        y = 0;
+    }
+    
+    MouseDelta operator+(const MouseDelta& other) const {
+        return {x + other.x, y + other.y};
+    }
+    
+    MouseDelta& operator+=(const MouseDelta& other) {
+        x += other.x;
+        y += other.y;
+        return *this;
+    }
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,100 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/LatencyHistogram.h"
+#include "common/WakeEvent.h"
+#include "core/IControllerSink.h"
+
+namespace Mouse2VR {
+
+// One processing result as handed to the fan-out sinks
+struct OutputSample {
+    uint64_t sequence = 0;     // Publish count; 0 = nothing published yet
+    int64_t publishedNs = 0;   // Steady clock when the processing thread published
+    float stickX = 0.0f;
+    float stickY = 0.0f;
+    float speed = 0.0f;
+};
+
+// Per-sink delivery statistics since start (or the last reset)
+struct OutputSinkStats {
+    std::string name;
+    int rateHz = 0;            // 0 = every publish
+    uint64_t delivered = 0;    // Update() calls
+    uint64_t repeated = 0;     // Deliveries of a result the sink already had
+    uint64_t skipped = 0;      // Results superseded before the sink got to them
+    LatencyStats age;          // Publish to the sink's Update() returning
+    LatencyStats updateTime;   // Duration of the sink's Update()
+};
+
+// Output stage for secondary controller sinks (network stream, recorder,
+// telemetry, ...), each driven by its own worker thread.
+//
+// The processing thread publishes each result into a single seqlock slot
+// and moves on; workers copy the newest result at their own pace. A sink
+// with a rate sends the newest result every 1/rate seconds, repeating it
+// when nothing new arrived; a sink with rate 0 wakes on every publish and
+// skips whatever was superseded while it was busy. Either way a slow sink
+// only falls behind itself, never the publisher or the other sinks.
+class OutputFanout {
+public:
+    OutputFanout() = default;
+    ~OutputFanout();
+
+    OutputFanout(const OutputFanout&) = delete;
+    OutputFanout& operator=(const OutputFanout&) = delete;
+
+    // Initialize and register a sink (while stopped). False if the sink
+    // fails to initialize.
+    bool AddSink(std::unique_ptr<IControllerSink> sink, int rateHz);
+    size_t GetSinkCount() const { return m_workers.size(); }
+
+    void Start();
+    void Stop();
+    bool IsRunning() const { return m_running.load(std::memory_order_relaxed); }
+
+    // Called by the single processing thread; never blocks on a sink
+    void Publish(float stickX, float stickY, float speed);
+
+    // Newest published result (sequence 0 before the first publish)
+    OutputSample ReadLatest() const;
+
+    std::vector<OutputSinkStats> GetStats() const;
+    void ResetStats();
+
+private:
+    struct Worker {
+        std::unique_ptr<IControllerSink> sink;
+        int rateHz = 0;
+        WakeEvent wake;
+        std::thread thread;
+        uint64_t lastSequence = 0;  // Owned by the worker thread
+        uint64_t startSequence = 0; // Published before Start; not counted as skipped
+        std::atomic<uint64_t> delivered{0};
+        std::atomic<uint64_t> repeated{0};
+        std::atomic<uint64_t> skipped{0};
+        LatencyHistogram age;
+        LatencyHistogram updateTime;
+    };
+
+    void RunWorker(Worker& worker);
+    void Deliver(Worker& worker);
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::atomic<bool> m_running{false};
+
+    // Latest result, guarded by a seqlock (odd while a publish is in progress)
+    std::atomic<uint64_t> m_lock{0};
+    std::atomic<uint64_t> m_sequence{0};
+    std::atomic<int64_t> m_publishedNs{0};
+    std::atomic<float> m_stickX{0.0f};
+    std::atomic<float> m_stickY{0.0f};
+    std::atomic<float> m_speed{0.0f};
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,60 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+
+namespace Mouse2VR {
+
+// Decides when the event-driven scheduler may publish after input arrives.
+//
+// A lone event (nothing else within the coalescing window) is forwarded as
+// soon as the output rate cap allows. While input keeps arriving faster than
+// the window, outputs are held back to one per window so a burst of reports
+// is summed into a single controller update. The rate cap applies to every
+// output, including idle keep-alive updates.
+class OutputThrottle {
+public:
+    void Configure(int64_t coalesceWindowNs, int maxOutputRateHz) {
+        m_coalesceWindowNs = std::max<int64_t>(0, coalesceWindowNs);
+        m_minSpacingNs = maxOutputRateHz > 0 ? 1000000000LL / maxOutputRateHz : 0;
+    }
+    
+    // Record input arriving at eventNs and return the earliest time the
+    // resulting output may be published (eventNs itself for a lone event)
+    int64_t OnInput(int64_t eventNs) {
+        bool burst = m_hasInput && eventNs - m_lastInputNs < m_coalesceWindowNs;
+        m_lastInputNs = eventNs;
+        m_hasInput = true;
+        
+        if (!m_hasOutput) {
+            return eventNs;
+        }
+        int64_t earliest = m_lastOutputNs + m_minSpacingNs;
+        if (burst) {
+            earliest = std::max(earliest, m_lastOutputNs + m_coalesceWindowNs);
+        }
+        return std::max(eventNs, earliest);
+    }
+    
+    void OnOutput(int64_t outputNs) {
+        m_lastOutputNs = outputNs;
+        m_hasOutput = true;
+    }
+    
+    void Reset() {
+        m_hasInput = false;
+        m_hasOutput = false;
+    }
+    
+    int64_t GetCoalesceWindowNs() const { return m_coalesceWindowNs; }
+    int64_t GetMinSpacingNs() const { return m_minSpacingNs; }
+
+private:
+    int64_t m_coalesceWindowNs = 0;
+    int64_t m_minSpacingNs = 0;
+    int64_t m_lastInputNs = 0;
+    int64_t m_lastOutputNs = 0;
+    bool m_hasInput = false;
+    bool m_hasOutput = false;
+};
+
+} // namespace Mouse2VR
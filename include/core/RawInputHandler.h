@@ -1,44 +1,54 @@
 #pragma once
 #include <atomic>
+#include <cstddef>
 #include <mutex>
+#include "common/TimedMutex.h"
 #include "common/WindowsHeaders.h"
+#include "core/MouseDelta.h"
+#include "core/InputSampleQueue.h"
+#include "core/IInputSource.h"
 
 namespace Mouse2VR {
 
-struct MouseDelta {
-    long x = 0;
-    long y = 0;
-    
-    void reset() {
-        x = 0;
-        y = 0;
-    }
-    
-    MouseDelta operator+(const MouseDelta& other) const {
-        return {x + other.x, y + other.y};
-    }
-    
-    MouseDelta& operator+=(const MouseDelta& other) {
-        x += other.x;
-        y += other.y;
-        return *this;
-    }
-};
-
-class RawInputHandler {
+// Windows Raw Input source. Events arrive as WM_INPUT on the window passed
+// to Initialize(); the owner forwards them to ProcessRawInput().
+class RawInputHandler : public IInputSource {
 public:
     RawInputHandler();
-    ~RawInputHandler();
+    ~RawInputHandler() override;
     
     bool Initialize(HWND targetWindow);
     void Shutdown();
     
+    // IInputSource: delivery is driven by the window's message pump
+    bool Start() override { return true; }
+    void Stop() override {}
+    const char* GetName() const override { return "RawInput"; }
+    
     // Get accumulated deltas since last call (thread-safe)
-    MouseDelta GetAndResetDeltas();
+    MouseDelta GetAndResetDeltas() override;
     
     // Get current deltas without resetting (thread-safe)
     MouseDelta GetDeltas() const;
     
+    // Move up to maxCount timestamped samples into out, oldest first (thread-safe)
+    size_t DrainSamples(InputSample* out, size_t maxCount) override;
+    
+    // Signal wake whenever a sample is queued
+    void SetWakeEvent(WakeEvent* wake) override { m_samples.SetWakeEvent(wake); }
+    
+    // Applied to the window's message thread by the next ProcessRawInput()
+    void SetThreadPolicy(const ThreadPolicyConfig& policy) override;
+    AppliedThreadPolicy GetAppliedThreadPolicy() const override;
+    
+    // Input path statistics
+    uint64_t GetSampleCount() const override { return m_samples.GetPushedCount(); }
+    uint64_t GetMergedSampleCount() const override { return m_samples.GetMergedCount(); }
+    
+    // Time consumers spent waiting on each other for the drain lock
+    int64_t GetDrainLockWaitNs() const { return m_drainMutex.GetWaitNs(); }
+    uint64_t GetDrainLockContentionCount() const { return m_drainMutex.GetContendedCount(); }
+    
     // Process Raw Input message
     void ProcessRawInput(LPARAM lParam);
     
@@ -49,11 +59,20 @@ public:
     bool IsInitialized() const { return m_initialized; }
 
 private:
+    void ApplyPendingThreadPolicy();
+    
     HWND m_targetWindow = nullptr;
     std::atomic<bool> m_initialized{false};
     
-    mutable std::mutex m_deltaMutex;
-    MouseDelta m_accumulatedDeltas;
+    // Written wait-free by the input thread; m_drainMutex only serializes
+    // consumers against each other and is never taken by the producer
+    InputSampleQueue m_samples;
+    mutable TimedMutex m_drainMutex;
+    
+    std::atomic<bool> m_policyPending{false};
+    mutable std::mutex m_policyMutex;
+    ThreadPolicyConfig m_threadPolicy;
+    AppliedThreadPolicy m_appliedPolicy;
     
     static RawInputHandler* s_instance;
 };
@@ -0,0 +1,84 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "common/IClock.h"
+#include "core/IControllerSink.h"
+#include "core/InputSampleQueue.h"
+
+namespace Mouse2VR {
+
+// One report as the pad would have received it
+struct RecordedReport {
+    int64_t timestampNs = 0;
+    float stickX = 0.0f;
+    float stickY = 0.0f;
+
+    bool operator==(const RecordedReport& other) const {
+        return timestampNs == other.timestampNs && stickX == other.stickX && stickY == other.stickY;
+    }
+};
+
+// Controller sink that keeps every report in memory, for running and
+// benchmarking the whole pipeline without a gamepad driver.
+//
+// Reports are stamped from the given clock (the steady clock by default;
+// pass the core's SimulatedClock for virtual time) into a buffer allocated
+// up front, so Update() never allocates. Reports beyond the capacity are
+// counted but not kept. Written by the processing thread; the counters
+// may be read from any thread, the reports once the core is stopped or
+// blocked on a simulated clock.
+class RecordingControllerSink : public IControllerSink {
+public:
+    explicit RecordingControllerSink(size_t capacity = 1 << 16, std::shared_ptr<IClock> clock = nullptr)
+        : m_clock(std::move(clock)), m_reports(capacity) {}
+
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    bool IsConnected() const override { return true; }
+    const char* GetName() const override { return "recording"; }
+
+    void SetLeftStick(float x, float y) override {
+        m_x = x;
+        m_y = y;
+    }
+
+    void Update() override {
+        uint64_t index = m_updates.load(std::memory_order_relaxed);
+        if (index < m_reports.size()) {
+            m_reports[index] = RecordedReport{m_clock ? m_clock->NowNs() : InputSampleQueue::NowNs(), m_x, m_y};
+        }
+        m_updates.store(index + 1, std::memory_order_release);
+    }
+
+    // Update() calls, including any beyond the capacity
+    uint64_t GetUpdateCount() const { return m_updates.load(std::memory_order_acquire); }
+    uint64_t GetDroppedCount() const {
+        uint64_t updates = GetUpdateCount();
+        return updates > m_reports.size() ? updates - m_reports.size() : 0;
+    }
+
+    // Stick values of the latest Update()
+    float GetLastX() const { return m_x; }
+    float GetLastY() const { return m_y; }
+
+    std::vector<RecordedReport> GetReports() const {
+        size_t count = static_cast<size_t>(std::min<uint64_t>(GetUpdateCount(), m_reports.size()));
+        return std::vector<RecordedReport>(m_reports.begin(), m_reports.begin() + count);
+    }
+
+    // Forget all reports (not while the core is running)
+    void Clear() { m_updates.store(0, std::memory_order_release); }
+
+private:
+    std::shared_ptr<IClock> m_clock;
+    std::vector<RecordedReport> m_reports;
+    std::atomic<uint64_t> m_updates{0};
+    std::atomic<float> m_x{0.0f};
+    std::atomic<float> m_y{0.0f};
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Mouse2VR {
+
+// Shape of the speed-to-deflection mapping
+enum class ResponseCurveType : uint8_t {
+    Linear = 0,     // deflection = counts/s / dpi * 0.0254 / 6.1 (original behaviour)
+    Piecewise = 1,  // Straight segments between control points
+    Spline = 2,     // Monotone cubic through the control points (no overshoot)
+    Gamma = 3       // (input / inputMax) ^ gamma
+};
+
+const char* ResponseCurveTypeToString(ResponseCurveType type);
+ResponseCurveType ResponseCurveTypeFromString(const std::string& name);  // Linear if unknown
+
+struct CurvePoint {
+    float input = 0.0f;   // Linear deflection (before the curve)
+    float output = 0.0f;  // Deflection sent to the stick
+    
+    bool operator==(const CurvePoint& other) const {
+        return input == other.input && output == other.output;
+    }
+};
+
+struct ResponseCurveConfig {
+    ResponseCurveType type = ResponseCurveType::Linear;
+    
+    // Input range covered by the curve; inputs beyond it hold the last value.
+    // 1.0 is full deflection of the linear mapping (6.1 m/s game speed).
+    float inputMax = 1.0f;
+    
+    // Gamma
+    float gamma = 1.0f;
+    
+    // Piecewise / Spline: sorted by input, (0, 0) is implied if missing
+    std::vector<CurvePoint> points;
+    
+    bool operator==(const ResponseCurveConfig& other) const {
+        return type == other.type && inputMax == other.inputMax &&
+               gamma == other.gamma && points == other.points;
+    }
+    bool operator!=(const ResponseCurveConfig& other) const { return !(*this == other); }
+};
+
+// Response curve compiled into a fixed-size lookup table.
+//
+// Compile() does all the curve math once; Evaluate() is a multiply, one
+// table pair and a lerp whatever the curve type. A Linear curve compiles to
+// nothing and InputProcessor skips it entirely.
+class ResponseCurve {
+public:
+    static constexpr size_t kTableSize = 256;  // Segments; the table holds kTableSize + 1 entries
+    
+    void Compile(const ResponseCurveConfig& config);
+    
+    bool IsIdentity() const { return m_identity; }
+    
+    // Table lookup with linear interpolation, input >= 0
+    float Evaluate(float input) const {
+        float t = input * m_indexScale;
+        if (!(t < static_cast<float>(kTableSize))) {
+            return m_table[kTableSize];
+        }
+        int index = static_cast<int>(t);
+        float frac = t - static_cast<float>(index);
+        float a = m_table[index];
+        float b = m_table[index + 1];
+        return a + (b - a) * frac;
+    }
+    
+    // Direct evaluation of the configured curve (for tests and tooling)
+    float EvaluateExact(float input) const;
+    
+    const float* GetTable() const { return m_table.data(); }
+    float GetIndexScale() const { return m_indexScale; }
+
+private:
+    ResponseCurveConfig m_config;
+    bool m_identity = true;
+    float m_indexScale = static_cast<float>(kTableSize);
+    std::array<float, kTableSize + 1> m_table = {};
+    
+    // Control points with the implied origin, and spline tangents
+    std::vector<CurvePoint> m_points;
+    std::vector<float> m_tangents;
+};
+
+} // namespace Mouse2VR
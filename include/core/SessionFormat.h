@@ -0,0 +1,147 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "core/InputProcessor.h"
+
+namespace Mouse2VR {
+
+// Binary session recording (.m2vr) layout.
+//
+// A file is one SessionHeader followed by a flat array of fixed-size
+// SessionRecords, so a mapped file can be walked in place without parsing.
+// Sample records carry every count as it arrived; tick records mark each
+// ProcessDelta call with the exact delta and deltaTime that were used.
+
+enum class SessionRecordKind : uint16_t {
+    Sample = 0,   // One input report: dx/dy as delivered by the device
+    Tick = 1      // One processing tick: dx/dy summed, tickSeconds = deltaTime
+};
+
+struct SessionRecord {
+    int64_t timestampNs = 0;  // steady_clock time (arrival for samples, tick time for ticks)
+    int32_t dx = 0;
+    int32_t dy = 0;
+    uint16_t deviceId = 0;
+    SessionRecordKind kind = SessionRecordKind::Sample;
+    float tickSeconds = 0.0f;
+};
+
+static_assert(sizeof(SessionRecord) == 24, "SessionRecord layout is part of the file format");
+
+struct SessionHeader {
+    static constexpr char kMagic[8] = {'M', '2', 'V', 'R', 'S', 'E', 'S', '1'};
+    static constexpr uint32_t kVersion = 1;
+
+    char magic[8] = {};
+    uint32_t version = kVersion;
+    uint32_t headerSize = sizeof(SessionHeader);
+    uint32_t recordSize = sizeof(SessionRecord);
+    uint32_t updateRateHz = 0;
+    int64_t startTimeNs = 0;
+    uint64_t recordCount = 0;     // 0 if the recorder did not finish cleanly
+
+    // ProcessingConfig at the start of the session
+    float sensitivity = 1.0f;
+    float deadzone = 0.0f;
+    float maxSpeed = 1.0f;
+    float countsPerMeter = 39370.1f;
+    uint8_t invertX = 0;
+    uint8_t invertY = 0;
+    uint8_t lockX = 0;
+    uint8_t lockY = 0;
+
+    // VelocityEstimatorConfig (zero in files written before it existed,
+    // which reads back as VelocityFilter::None)
+    uint8_t velocityFilter = 0;
+    uint8_t velocityMedianWindow = 0;
+    uint8_t velocityReserved[2] = {};
+    float velocityEmaTimeConstant = 0.0f;
+    float velocityOneEuroMinCutoff = 0.0f;
+    float velocityOneEuroBeta = 0.0f;
+    float velocityOneEuroDerivativeCutoff = 0.0f;
+    float velocityAlphaBetaAlpha = 0.0f;
+    float velocityAlphaBetaBeta = 0.0f;
+
+    // PredictionConfig (zero = disabled in older files)
+    uint8_t predictionEnabled = 0;
+    uint8_t predictionReserved[3] = {};
+    float predictionHorizonMs = 0.0f;
+    float predictionAccelerationTimeConstant = 0.0f;
+    float predictionMaxLeadFraction = 0.0f;
+    float predictionFastStopRatio = 0.0f;
+
+    uint8_t reserved[20] = {};
+
+    static SessionHeader Create(const ProcessingConfig& config, int updateRateHz, int64_t startTimeNs) {
+        SessionHeader header;
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.updateRateHz = static_cast<uint32_t>(updateRateHz);
+        header.startTimeNs = startTimeNs;
+        header.sensitivity = config.sensitivity;
+        header.deadzone = config.deadzone;
+        header.maxSpeed = config.maxSpeed;
+        header.countsPerMeter = config.countsPerMeter;
+        header.invertX = config.invertX;
+        header.invertY = config.invertY;
+        header.lockX = config.lockX;
+        header.lockY = config.lockY;
+        header.velocityFilter = static_cast<uint8_t>(config.velocity.filter);
+        header.velocityMedianWindow = static_cast<uint8_t>(config.velocity.medianWindow);
+        header.velocityEmaTimeConstant = config.velocity.emaTimeConstant;
+        header.velocityOneEuroMinCutoff = config.velocity.oneEuroMinCutoff;
+        header.velocityOneEuroBeta = config.velocity.oneEuroBeta;
+        header.velocityOneEuroDerivativeCutoff = config.velocity.oneEuroDerivativeCutoff;
+        header.velocityAlphaBetaAlpha = config.velocity.alphaBetaAlpha;
+        header.velocityAlphaBetaBeta = config.velocity.alphaBetaBeta;
+        header.predictionEnabled = config.prediction.enabled;
+        header.predictionHorizonMs = config.prediction.horizonMs;
+        header.predictionAccelerationTimeConstant = config.prediction.accelerationTimeConstant;
+        header.predictionMaxLeadFraction = config.prediction.maxLeadFraction;
+        header.predictionFastStopRatio = config.prediction.fastStopRatio;
+        return header;
+    }
+
+    bool IsValid() const {
+        return std::memcmp(magic, kMagic, sizeof(kMagic)) == 0 &&
+               version == kVersion &&
+               headerSize == sizeof(SessionHeader) &&
+               recordSize == sizeof(SessionRecord);
+    }
+
+    // The response curve is not recorded (its point list does not fit the
+    // fixed header); replay curved sessions through a configured processor
+    ProcessingConfig ToProcessingConfig() const {
+        ProcessingConfig config;
+        config.sensitivity = sensitivity;
+        config.deadzone = deadzone;
+        config.maxSpeed = maxSpeed;
+        config.countsPerMeter = countsPerMeter;
+        config.invertX = invertX != 0;
+        config.invertY = invertY != 0;
+        config.lockX = lockX != 0;
+        config.lockY = lockY != 0;
+        if (velocityFilter != 0) {
+            config.velocity.filter = static_cast<VelocityFilter>(velocityFilter);
+            config.velocity.medianWindow = velocityMedianWindow;
+            config.velocity.emaTimeConstant = velocityEmaTimeConstant;
+            config.velocity.oneEuroMinCutoff = velocityOneEuroMinCutoff;
+            config.velocity.oneEuroBeta = velocityOneEuroBeta;
+            config.velocity.oneEuroDerivativeCutoff = velocityOneEuroDerivativeCutoff;
+            config.velocity.alphaBetaAlpha = velocityAlphaBetaAlpha;
+            config.velocity.alphaBetaBeta = velocityAlphaBetaBeta;
+        }
+        if (predictionEnabled != 0) {
+            config.prediction.enabled = true;
+            config.prediction.horizonMs = predictionHorizonMs;
+            config.prediction.accelerationTimeConstant = predictionAccelerationTimeConstant;
+            config.prediction.maxLeadFraction = predictionMaxLeadFraction;
+            config.prediction.fastStopRatio = predictionFastStopRatio;
+        }
+        return config;
+    }
+};
+
+static_assert(sizeof(SessionHeader) == 128, "SessionHeader layout is part of the file format");
+
+} // namespace Mouse2VR
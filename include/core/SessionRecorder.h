@@ -0,0 +1,68 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "common/SpscRing.h"
+#include "core/InputSampleQueue.h"
+#include "core/SessionFormat.h"
+
+namespace Mouse2VR {
+
+// Records the raw input reaching InputProcessor to a .m2vr session file.
+//
+// The Record* methods are called on the processing thread and only copy
+// into a preallocated ring; a background writer thread appends to disk.
+// If the writer falls behind, records are dropped and counted rather than
+// stalling input processing.
+class SessionRecorder {
+public:
+    static constexpr size_t kRingCapacity = 65536;   // ~8 s of 8 kHz input
+
+    SessionRecorder();
+    ~SessionRecorder();
+
+    SessionRecorder(const SessionRecorder&) = delete;
+    SessionRecorder& operator=(const SessionRecorder&) = delete;
+
+    // Create/overwrite path and start the writer (control thread)
+    bool Start(const std::string& path, const ProcessingConfig& config, int updateRateHz);
+
+    // Flush remaining records, finalize the header and close the file
+    void Stop();
+
+    bool IsRecording() const { return m_recording.load(std::memory_order_acquire); }
+
+    // Producer side (processing thread, allocation-free)
+    void RecordSamples(const InputSample* samples, size_t count, uint16_t deviceId);
+    void RecordTick(int64_t timestampNs, const MouseDelta& delta, float deltaTime);
+
+    // Statistics
+    uint64_t GetWrittenCount() const { return m_writtenCount.load(std::memory_order_relaxed); }
+    uint64_t GetDroppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); }
+    const std::string& GetPath() const { return m_path; }
+
+private:
+    void Push(const SessionRecord& record);
+    void WriterLoop();
+    size_t FlushRing();
+
+    std::unique_ptr<SpscRing<SessionRecord, kRingCapacity>> m_ring;
+    std::mutex m_controlMutex;   // Serializes Start/Stop
+    std::string m_path;
+    std::FILE* m_file = nullptr;
+    SessionHeader m_header;
+
+    std::thread m_writerThread;
+    std::atomic<bool> m_recording{false};
+    std::atomic<bool> m_writerRunning{false};
+
+    std::atomic<uint64_t> m_writtenCount{0};
+    std::atomic<uint64_t> m_droppedCount{0};
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,86 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "core/InputProcessor.h"
+#include "core/SessionFormat.h"
+
+namespace Mouse2VR {
+
+// Read-only memory mapping of a .m2vr session file
+class MappedSession {
+public:
+    MappedSession() = default;
+    ~MappedSession();
+
+    MappedSession(const MappedSession&) = delete;
+    MappedSession& operator=(const MappedSession&) = delete;
+
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return m_data != nullptr; }
+    const SessionHeader& GetHeader() const { return *reinterpret_cast<const SessionHeader*>(m_data); }
+    const SessionRecord* GetRecords() const { return m_records; }
+    size_t GetRecordCount() const { return m_recordCount; }
+
+private:
+    const unsigned char* m_data = nullptr;
+    size_t m_size = 0;
+    const SessionRecord* m_records = nullptr;
+    size_t m_recordCount = 0;
+
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+};
+
+// Receives every processed tick during replay (stands in for the controller)
+class IReplaySink {
+public:
+    virtual ~IReplaySink() = default;
+    virtual void OnTick(int64_t timestampNs, float stickX, float stickY, float speed) = 0;
+};
+
+// Mock controller sink that keeps running totals instead of a full trace
+class ReplayStatsSink : public IReplaySink {
+public:
+    void OnTick(int64_t timestampNs, float stickX, float stickY, float speed) override;
+
+    uint64_t tickCount = 0;
+    int64_t lastTimestampNs = 0;
+    float lastStickX = 0.0f;
+    float lastStickY = 0.0f;
+    float peakSpeed = 0.0f;
+    double stickYSum = 0.0;
+    double speedSum = 0.0;
+};
+
+struct ReplayOptions {
+    // 0 = use the recorded tick records (exact reproduction of the session).
+    // Otherwise resample the raw sample records at this rate, which lets a
+    // recording be re-run against a different scheduler rate.
+    int tickRateHz = 0;
+};
+
+struct ReplayResult {
+    uint64_t ticks = 0;
+    uint64_t samples = 0;
+    double sessionSeconds = 0.0;   // recorded time span
+    double wallSeconds = 0.0;      // time taken to replay
+};
+
+// Drives InputProcessor from a recorded session as fast as the CPU allows
+class ReplayEngine {
+public:
+    // Uses the config from the session header
+    static ReplayResult Run(const MappedSession& session, IReplaySink& sink,
+                            const ReplayOptions& options = {});
+
+    // Uses an existing processor (e.g. to try different tuning)
+    static ReplayResult Run(const MappedSession& session, InputProcessor& processor,
+                            IReplaySink& sink, const ReplayOptions& options = {});
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include "common/SharedState.h"
+
+namespace Mouse2VR {
+
+struct StateChannelConfig {
+    bool enabled = false;
+    std::string name = "mouse2vr-state";  // Shared-memory object name, without platform prefix
+
+    bool operator==(const StateChannelConfig& other) const {
+        return enabled == other.enabled && name == other.name;
+    }
+};
+
+// Writing end of the shared-memory state channel (see SharedState.h).
+//
+// Creates or reuses the named segment, so readers that mapped it keep
+// working across publisher restarts. Publish() is wait-free: a handful of
+// stores, never a lock or a syscall. One publishing thread at a time.
+class SharedStatePublisher {
+public:
+    explicit SharedStatePublisher(std::string name);
+    ~SharedStatePublisher();
+
+    SharedStatePublisher(const SharedStatePublisher&) = delete;
+    SharedStatePublisher& operator=(const SharedStatePublisher&) = delete;
+
+    bool IsOpen() const { return m_layout != nullptr; }
+    const std::string& GetName() const { return m_name; }
+
+    // tick is filled in from the publish count
+    void Publish(const SharedStateSnapshot& state);
+
+    uint64_t GetPublishCount() const { return m_tick; }
+
+    // Delete the named segment (mapped views stay valid)
+    static bool Remove(const std::string& name);
+
+private:
+    std::string m_name;
+    SharedStateLayout* m_layout = nullptr;
+    uint64_t m_tick = 0;
+#ifdef _WIN32
+    void* m_mapping = nullptr;
+#endif
+};
+
+} // namespace Mouse2VR
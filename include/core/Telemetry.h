@@ -0,0 +1,64 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "common/SpscRing.h"
+
+namespace Mouse2VR {
+
+// State of one published tick, as the UI graphs it
+struct TelemetrySample {
+    int64_t timestampNs = 0;   // Core clock
+    float speed = 0.0f;        // Belt speed, m/s (unsigned)
+    float stickY = 0.0f;
+};
+
+// Every tick since the previous batch, for one UI frame
+struct TelemetryBatch {
+    std::vector<TelemetrySample> samples;  // Oldest first; capacity is kept between batches
+    uint64_t dropped = 0;                  // Ticks lost to a full buffer since the previous batch
+    int actualHz = 0;                      // Achieved output rate
+
+    void Clear() {
+        samples.clear();
+        dropped = 0;
+        actualHz = 0;
+    }
+
+    // Append as one compact JSON object, columns instead of objects per
+    // sample. t0 is the first tick's time in milliseconds; the t column is
+    // each tick's offset from t0 in microseconds:
+    // {"type":"telemetry","t0":12.345,"hz":100,"dropped":0,
+    //  "t":[0,10000,...],"speed":[1.2,...],"stickY":[0.25,...]}
+    void AppendJson(std::string& out) const;
+};
+
+// Hand-off of tick states from the processing thread to the UI thread.
+// Record() is wait-free and never allocates; when the UI falls more than
+// kCapacity ticks behind, further ticks are counted and dropped.
+class TelemetryBuffer {
+public:
+    static constexpr size_t kCapacity = 4096;
+
+    // Processing thread
+    void Record(const TelemetrySample& sample) {
+        if (!m_ring.TryPush(sample)) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // UI thread: move every queued sample into batch (appending) and add
+    // the drops since the last call; returns the number of samples moved
+    size_t Drain(TelemetryBatch& batch);
+
+    uint64_t GetDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+private:
+    SpscRing<TelemetrySample, kCapacity> m_ring;
+    std::atomic<uint64_t> m_dropped{0};
+    uint64_t m_reportedDropped = 0;  // UI thread
+};
+
+} // namespace Mouse2VR
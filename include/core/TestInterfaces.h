@@ -63,8 +63,13 @@ public:
     TestMetricsCollector() : startTime(std::chrono::steady_clock::now()) {}
     
     void RecordUpdate() {
+        RecordUpdate(std::chrono::steady_clock::now());
+    }
+    
+    // For updates made on a simulated clock, at their virtual time
+    void RecordUpdate(std::chrono::steady_clock::time_point at) {
         updates++;
-        lastUpdateTime = std::chrono::steady_clock::now();
+        lastUpdateTime = at;
     }
     
     void RecordWebViewUpdate() {
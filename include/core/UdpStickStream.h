@@ -0,0 +1,144 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "common/IClock.h"
+#include "common/LatencyHistogram.h"
+#include "common/UdpSocket.h"
+#include "core/IControllerSink.h"
+
+namespace Mouse2VR {
+
+// One stick report on the wire. Fixed 32 bytes, little-endian:
+//   0 magic u32 "M2SS" | 4 version u16 | 6 flags u16 (0) | 8 sequence u32
+//  12 timestampNs i64 (sender's steady clock) | 20 stickX f32 | 24 stickY f32
+//  28 speed f32 (m/s)
+struct StickStatePacket {
+    static constexpr uint32_t kMagic = 0x5353324D;  // "M2SS"
+    static constexpr uint16_t kVersion = 1;
+    static constexpr size_t kSize = 32;
+
+    uint32_t sequence = 0;
+    int64_t timestampNs = 0;
+    float stickX = 0.0f;
+    float stickY = 0.0f;
+    float speed = 0.0f;
+
+    void Encode(uint8_t (&out)[kSize]) const;
+
+    // False if size, magic or version do not match
+    static bool Decode(const uint8_t* data, size_t size, StickStatePacket& packet);
+};
+
+// Controller sink that streams every report as a StickStatePacket to
+// host:port, for a sensor box driving a gaming PC over the network.
+//
+// One non-blocking send() per Update() from a preallocated buffer: nothing
+// is allocated per report, and a full socket buffer drops the report
+// instead of stalling the tick. Timestamps come from the given clock (the
+// steady clock by default).
+class UdpStickSink : public IControllerSink {
+public:
+    UdpStickSink(std::string host, uint16_t port, std::shared_ptr<IClock> clock = nullptr);
+
+    bool Initialize() override;
+    void Shutdown() override;
+    bool IsConnected() const override { return m_connected; }
+    const char* GetName() const override { return "udp"; }
+
+    void SetLeftStick(float x, float y) override;
+    void SetSpeed(float metersPerSecond) override { m_speed = metersPerSecond; }
+    void Update() override;
+
+    uint64_t GetSentCount() const { return m_sent.load(std::memory_order_relaxed); }
+    uint64_t GetFailedSendCount() const { return m_failedSends.load(std::memory_order_relaxed); }
+
+private:
+    std::string m_host;
+    uint16_t m_port;
+    std::shared_ptr<IClock> m_clock;
+    UdpSocket m_socket;
+    bool m_connected = false;
+
+    float m_x = 0.0f;
+    float m_y = 0.0f;
+    float m_speed = 0.0f;
+    uint32_t m_sequence = 0;
+    uint8_t m_buffer[StickStatePacket::kSize] = {};
+    std::atomic<uint64_t> m_sent{0};
+    std::atomic<uint64_t> m_failedSends{0};
+};
+
+struct StickStreamStats {
+    uint64_t received = 0;    // Valid packets, including duplicates and stale ones
+    uint64_t lost = 0;        // Sequence numbers skipped and not (yet) seen
+    uint64_t reordered = 0;   // Packets that arrived after a later one
+    uint64_t duplicates = 0;
+    uint64_t stale = 0;       // Too old for the reorder window, or from before the first
+    uint64_t rejected = 0;    // Wrong size, magic or version
+    uint64_t resyncs = 0;     // Sender restarts detected
+};
+
+// Latest state from a StickStatePacket stream
+struct StickStreamState {
+    bool valid = false;
+    uint32_t sequence = 0;
+    int64_t timestampNs = 0;  // Sender's clock
+    int64_t arrivalNs = 0;    // Receiver's clock
+    float stickX = 0.0f;
+    float stickY = 0.0f;
+    float speed = 0.0f;
+};
+
+// Receiving end of a UdpStickSink stream.
+//
+// Tracks loss and reordering over a 64-packet window, with sequence numbers
+// compared modulo 2^32; only packets newer than the latest replace the
+// state. A run of packets far behind the window means the sender restarted
+// and the tracking starts over. Transit time (arrival minus sender
+// timestamp) is only a latency when both ends share a clock, i.e. on the
+// same machine. Not thread-safe: one thread polls and reads.
+class StickStateReceiver {
+public:
+    static constexpr int kWindow = 64;
+    static constexpr int kResyncAfterStale = 3;
+
+    // Listen on host:port ("0.0.0.0" for every interface, port 0 for any)
+    explicit StickStateReceiver(uint16_t port, const std::string& host = "0.0.0.0");
+
+    bool IsOpen() const { return m_open; }
+    uint16_t GetPort() const { return m_port; }
+
+    // Handle every queued datagram without blocking; returns how many
+    // replaced the state
+    int Poll();
+
+    // Block up to timeoutMs for a datagram, then Poll()
+    int Wait(int timeoutMs);
+
+    // Account one datagram received at arrivalNs; true if it replaced the
+    // state. Exposed for tests.
+    bool OnPacket(const uint8_t* data, size_t size, int64_t arrivalNs);
+
+    const StickStreamState& GetState() const { return m_state; }
+    const StickStreamStats& GetStats() const { return m_stats; }
+    LatencyStats GetTransitStats() const { return m_transit.GetStats(); }
+
+    void ResetStats();
+
+private:
+    UdpSocket m_socket;
+    bool m_open = false;
+    uint16_t m_port = 0;
+
+    StickStreamState m_state;
+    StickStreamStats m_stats;
+    LatencyHistogram m_transit;
+    uint64_t m_window = 0;     // Bit i set: m_state.sequence - i was received
+    uint32_t m_firstSequence = 0;  // Earlier packets were never expected
+    int m_staleRun = 0;
+};
+
+} // namespace Mouse2VR
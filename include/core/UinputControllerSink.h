@@ -0,0 +1,79 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <linux/input.h>
+#include "core/IControllerSink.h"
+
+namespace Mouse2VR {
+
+// Linux virtual gamepad through /dev/uinput.
+//
+// Creates an absolute-axis pad (left and right sticks at -32768..32767,
+// one button so the device is classified as a joystick) with the Xbox 360
+// vendor and product ids. Update() writes every axis that changed plus the
+// SYN_REPORT in a single write(), and nothing when the report is
+// unchanged. ABS_Y follows the evdev convention (positive = down), so a
+// forward stick is written negated, as xpad does.
+class UinputControllerSink : public IControllerSink {
+public:
+    static constexpr int32_t kAxisMin = -32768;
+    static constexpr int32_t kAxisMax = 32767;
+    static constexpr size_t kMaxEventsPerReport = 5;  // 4 axes + SYN_REPORT
+
+    // Open and set up devicePath on Initialize()
+    explicit UinputControllerSink(std::string devicePath = "/dev/uinput");
+
+    // Write reports to an already-open descriptor with no device setup; the
+    // sink takes ownership. Tests read the events back from a pipe.
+    UinputControllerSink(int fd, std::string name);
+
+    ~UinputControllerSink() override;
+
+    UinputControllerSink(const UinputControllerSink&) = delete;
+    UinputControllerSink& operator=(const UinputControllerSink&) = delete;
+
+    // IControllerSink
+    bool Initialize() override;
+    void Shutdown() override;
+    void SetLeftStick(float x, float y) override;
+    void Update() override;
+    bool IsConnected() const override { return m_connected; }
+    const char* GetName() const override { return "uinput"; }
+
+    void SetRightStick(float x, float y);
+
+    // Statistics
+    uint64_t GetWriteCount() const { return m_writeCount.load(std::memory_order_relaxed); }
+    uint64_t GetEventCount() const { return m_eventCount.load(std::memory_order_relaxed); }
+    uint64_t GetUnchangedCount() const { return m_unchangedCount.load(std::memory_order_relaxed); }
+    uint64_t GetFailedWriteCount() const { return m_failedWrites.load(std::memory_order_relaxed); }
+
+    // Convert -1.0..1.0 to the axis range
+    static int32_t FloatToAxis(float value);
+
+private:
+    enum Axis { LeftX, LeftY, RightX, RightY, AxisCount };
+
+    bool CreateDevice();
+    void CloseDevice();
+
+    std::string m_devicePath;
+    int m_fd = -1;
+    bool m_ownsDevice = true;  // false for descriptors passed in
+    bool m_created = false;    // UI_DEV_CREATE succeeded
+    bool m_connected = false;
+
+    int32_t m_axes[AxisCount] = {};
+    int32_t m_sentAxes[AxisCount] = {};
+    bool m_sentAny = false;    // The first report sends every axis
+    input_event m_batch[kMaxEventsPerReport] = {};
+
+    std::atomic<uint64_t> m_writeCount{0};
+    std::atomic<uint64_t> m_eventCount{0};
+    std::atomic<uint64_t> m_unchangedCount{0};
+    std::atomic<uint64_t> m_failedWrites{0};
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,83 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Mouse2VR {
+
+// Velocity filter applied to each tick's counts-per-second measurement
+enum class VelocityFilter : uint8_t {
+    None = 0,       // Raw delta / deltaTime (original behaviour)
+    Ema = 1,        // Exponential moving average with a time constant
+    OneEuro = 2,    // Adaptive low-pass: smooth when slow, responsive when fast
+    AlphaBeta = 3,  // Alpha-beta tracker (steady-state Kalman) with acceleration
+    Median = 4      // Streaming median over the last N ticks (spike rejection)
+};
+
+const char* VelocityFilterToString(VelocityFilter filter);
+VelocityFilter VelocityFilterFromString(const std::string& name);  // None if unknown
+
+struct VelocityEstimatorConfig {
+    VelocityFilter filter = VelocityFilter::None;
+    
+    // Ema
+    float emaTimeConstant = 0.05f;       // seconds
+    
+    // OneEuro
+    float oneEuroMinCutoff = 1.0f;       // Hz, smoothing at low speed
+    float oneEuroBeta = 0.001f;          // cutoff gain per count/s^2
+    float oneEuroDerivativeCutoff = 1.0f;// Hz, smoothing of the speed derivative
+    
+    // AlphaBeta
+    float alphaBetaAlpha = 0.5f;         // velocity correction gain (0-1)
+    float alphaBetaBeta = 0.1f;          // acceleration correction gain (0-2)
+    
+    // Median
+    int medianWindow = 5;                // ticks, clamped to 1..kMaxMedianWindow
+    
+    bool operator==(const VelocityEstimatorConfig& other) const;
+    bool operator!=(const VelocityEstimatorConfig& other) const { return !(*this == other); }
+};
+
+// One-axis velocity estimator.
+//
+// Update() takes the velocity measured over one tick (counts/s) and its
+// duration, and returns the filtered velocity. Every filter keeps a fixed
+// amount of state and does constant work per call; nothing allocates.
+class VelocityEstimator {
+public:
+    static constexpr int kMaxMedianWindow = 15;
+    
+    void Configure(const VelocityEstimatorConfig& config);
+    void Reset();
+    
+    float Update(float measured, float deltaTime);
+    
+    float GetVelocity() const { return m_velocity; }
+    
+    // Estimated rate of change of velocity (counts/s^2); only the AlphaBeta
+    // and OneEuro filters track it, others report 0
+    float GetAcceleration() const { return m_acceleration; }
+    
+    const VelocityEstimatorConfig& GetConfig() const { return m_config; }
+
+private:
+    float UpdateEma(float measured, float deltaTime);
+    float UpdateOneEuro(float measured, float deltaTime);
+    float UpdateAlphaBeta(float measured, float deltaTime);
+    float UpdateMedian(float measured);
+    
+    VelocityEstimatorConfig m_config;
+    bool m_initialized = false;
+    float m_velocity = 0.0f;
+    float m_acceleration = 0.0f;
+    
+    // Median: circular history plus a sorted copy kept in step with it
+    std::array<float, kMaxMedianWindow> m_history{};
+    std::array<float, kMaxMedianWindow> m_sorted{};
+    int m_historyCount = 0;
+    int m_historyNext = 0;
+};
+
+} // namespace Mouse2VR
@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+
+namespace Mouse2VR {
+
+struct PredictionConfig {
+    bool enabled = false;
+    float horizonMs = 20.0f;               // How far ahead to project the belt speed
+    float accelerationTimeConstant = 0.05f;// seconds, smoothing of the acceleration estimate
+    float maxLeadFraction = 0.5f;          // Projection may differ from the estimate by at most this fraction
+    float fastStopRatio = 0.25f;           // Raw speed below this fraction of the estimate = stopping
+    
+    bool operator==(const PredictionConfig& other) const {
+        return enabled == other.enabled &&
+               horizonMs == other.horizonMs &&
+               accelerationTimeConstant == other.accelerationTimeConstant &&
+               maxLeadFraction == other.maxLeadFraction &&
+               fastStopRatio == other.fastStopRatio;
+    }
+    bool operator!=(const PredictionConfig& other) const { return !(*this == other); }
+};
+
+// One-axis extrapolation of the estimated velocity to hide output latency.
+//
+// The prediction is estimate + acceleration * horizon, limited so it never
+// strays more than maxLeadFraction from the estimate and never crosses zero.
+// When the raw measurement collapses (the walker stops), the raw value is
+// returned directly and the acceleration history is dropped, so a stop is
+// never extrapolated past.
+class VelocityPredictor {
+public:
+    void Configure(const PredictionConfig& config);
+    void Reset();
+    
+    // estimated: filtered velocity this tick; measured: raw velocity this
+    // tick (both counts/s). Returns the velocity to publish.
+    float Update(float estimated, float measured, float deltaTime);
+    
+    float GetAcceleration() const { return m_acceleration; }
+    bool IsFastStopping() const { return m_fastStop; }
+
+private:
+    PredictionConfig m_config;
+    bool m_initialized = false;
+    bool m_fastStop = false;
+    float m_lastEstimate = 0.0f;
+    float m_acceleration = 0.0f;
+};
+
+} // namespace Mouse2VR
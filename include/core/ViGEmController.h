@@ -2,28 +2,31 @@
 #include <memory>
 #include "common/WindowsHeaders.h"
 #include <ViGEm/Client.h>
+#include "core/IControllerSink.h"
 
 namespace Mouse2VR {
 
-class ViGEmController {
+// Virtual Xbox 360 pad on the ViGEm bus
+class ViGEmController : public IControllerSink {
 public:
     ViGEmController();
-    ~ViGEmController();
+    ~ViGEmController() override;
     
-    bool Initialize();
-    void Shutdown();
+    bool Initialize() override;
+    void Shutdown() override;
     
     // Update stick position (-1.0 to 1.0)
-    void SetLeftStick(float x, float y);
+    void SetLeftStick(float x, float y) override;
     void SetRightStick(float x, float y);
     
     // Update button states
     void SetButton(int button, bool pressed);
     
     // Send current state to virtual controller
-    void Update();
+    void Update() override;
     
-    bool IsConnected() const { return m_connected; }
+    bool IsConnected() const override { return m_connected; }
+    const char* GetName() const override { return "ViGEm"; }
     
 private:
     PVIGEM_CLIENT m_client = nullptr;
@@ -92,9 +92,11 @@ int main(int argc, char* argv[]) {
     std::cout << "  X-Axis: " << (config.lockX ? "Locked" : "Active") << "\n";
     std::cout << "  Y-Axis: " << (config.lockY ? "Locked" : "Active") 
               << (config.invertY ? " (Inverted)" : "") << "\n";
-    if (config.adaptiveMode) {
+    if (config.adaptiveMode && config.idleUpdateIntervalMs > 0) {
         std::cout << "  Adaptive Mode: ON (" << (1000 / config.idleUpdateIntervalMs) 
                   << " Hz idle)\n";
+    } else if (config.adaptiveMode) {
+        std::cout << "  Adaptive Mode: ON (parked when idle)\n";
     }
     
     std::cout << "\nStarting main loop. Press Ctrl+C to exit.\n";
@@ -133,7 +135,11 @@ int main(int argc, char* argv[]) {
         // Wait for timeout or notification
         std::unique_lock<std::mutex> lock(g_updateMutex);
         auto currentInterval = (config.adaptiveMode && !isMoving) ? idleInterval : updateInterval;
-        g_updateCV.wait_for(lock, currentInterval);
+        if (currentInterval.count() > 0) {
+            g_updateCV.wait_for(lock, currentInterval);
+        } else {
+            g_updateCV.wait(lock);  // Parked until input arrives
+        }
         lock.unlock();
         
         auto now = std::chrono::steady_clock::now();
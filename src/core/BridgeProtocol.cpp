@@ -0,0 +1,341 @@
+#include "core/BridgeProtocol.h"
+#include "core/Mouse2VRCore.h"
+#include <cmath>
+#include <cstdio>
+
+namespace Mouse2VR {
+
+namespace {
+
+enum class FieldType { Number, Integer, Boolean };
+
+// One settable field: its JSON name, type, accepted range and where the
+// value goes in a SettingsChange
+struct SettingField {
+    std::string_view name;
+    FieldType type;
+    double min;
+    double max;
+    void (*assign)(SettingsChange& change, double value);
+};
+
+constexpr double kInchesPerMeter = 39.3701;
+constexpr double kGameSprintSpeed = 6.1;  // HL2 max sprint speed (m/s) at full deflection
+
+const SettingField kSettingFields[] = {
+    {"adaptiveMode", FieldType::Boolean, 0, 1,
+     [](SettingsChange& c, double v) { c.adaptiveMode = v != 0.0; }},
+    {"coalesceWindowUs", FieldType::Integer, 0, 100000,
+     [](SettingsChange& c, double v) { c.coalesceWindowUs = static_cast<int>(v); }},
+    {"dpi", FieldType::Integer, 100, 25600,
+     [](SettingsChange& c, double v) { c.countsPerMeter = static_cast<float>(v * kInchesPerMeter); }},
+    {"eventDriven", FieldType::Boolean, 0, 1,
+     [](SettingsChange& c, double v) { c.eventDriven = v != 0.0; }},
+    {"idleTimeoutMs", FieldType::Integer, 0, 60000,
+     [](SettingsChange& c, double v) { c.idleTimeoutMs = static_cast<int>(v); }},
+    {"idleUpdateIntervalMs", FieldType::Integer, 0, 1000,
+     [](SettingsChange& c, double v) { c.idleUpdateIntervalMs = static_cast<int>(v); }},
+    {"invertY", FieldType::Boolean, 0, 1,
+     [](SettingsChange& c, double v) { c.invertY = v != 0.0; }},
+    {"lockX", FieldType::Boolean, 0, 1,
+     [](SettingsChange& c, double v) { c.lockX = v != 0.0; }},
+    {"lockY", FieldType::Boolean, 0, 1,
+     [](SettingsChange& c, double v) { c.lockY = v != 0.0; }},
+    {"maxOutputRateHz", FieldType::Integer, 10, 8000,
+     [](SettingsChange& c, double v) { c.maxOutputRateHz = static_cast<int>(v); }},
+    {"sensitivity", FieldType::Number, 0.01, 10.0,
+     [](SettingsChange& c, double v) { c.sensitivity = static_cast<float>(v); }},
+    {"updateRateHz", FieldType::Integer, 10, 200,
+     [](SettingsChange& c, double v) { c.updateRateHz = static_cast<int>(v); }},
+};
+
+const char* FieldTypeName(FieldType type) {
+    switch (type) {
+        case FieldType::Number: return "a number";
+        case FieldType::Integer: return "an integer";
+        case FieldType::Boolean: return "a boolean";
+    }
+    return "a value";
+}
+
+std::string FormatLimit(double value) {
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%g", value);
+    return buffer;
+}
+
+// Check one value against a field's type and range and return it as a double
+bool ReadValue(const nlohmann::json& value, std::string_view name, FieldType type, double min, double max,
+               double& out, BridgeError& error) {
+    bool typeOk = false;
+    switch (type) {
+        case FieldType::Boolean:
+            typeOk = value.is_boolean();
+            out = typeOk && value.get<bool>() ? 1.0 : 0.0;
+            break;
+        case FieldType::Integer:
+            // JavaScript numbers have no integer type; 90.0 is fine, 90.5 is not
+            typeOk = value.is_number() && std::floor(value.get<double>()) == value.get<double>();
+            out = typeOk ? value.get<double>() : 0.0;
+            break;
+        case FieldType::Number:
+            typeOk = value.is_number();
+            out = typeOk ? value.get<double>() : 0.0;
+            break;
+    }
+    if (!typeOk) {
+        error = {BridgeErrorCode::WrongType, std::string(name), std::string(name) + " must be " + FieldTypeName(type)};
+        return false;
+    }
+    if (type != FieldType::Boolean && (out < min || out > max)) {
+        error = {BridgeErrorCode::OutOfRange, std::string(name),
+                 std::string(name) + " must be between " + FormatLimit(min) + " and " + FormatLimit(max)};
+        return false;
+    }
+    return true;
+}
+
+nlohmann::json ConfigToJson(const Mouse2VRCore& core) {
+    Mouse2VRCore::ProcessorConfig config = core.GetProcessorConfig();
+    return nlohmann::json{
+        {"dpi", std::lround(config.countsPerMeter / kInchesPerMeter)},
+        {"sensitivity", std::round(config.sensitivity * 1e4) / 1e4},  // Not 1.2000000476837158
+        {"updateRateHz", core.GetTargetUpdateRate()},
+        {"invertY", config.invertY},
+        {"lockX", config.lockX},
+        {"lockY", config.lockY},
+        {"eventDriven", core.IsEventDriven()},
+        {"adaptiveMode", core.IsAdaptiveMode()},
+        {"runEnabled", core.IsRunning()}
+    };
+}
+
+double Ms(double ns) {
+    return ns / 1e6;
+}
+
+} // namespace
+
+const char* BridgeErrorCodeToString(BridgeErrorCode code) {
+    switch (code) {
+        case BridgeErrorCode::None: return "none";
+        case BridgeErrorCode::ParseError: return "parse_error";
+        case BridgeErrorCode::InvalidRequest: return "invalid_request";
+        case BridgeErrorCode::UnknownCommand: return "unknown_command";
+        case BridgeErrorCode::UnknownSetting: return "unknown_setting";
+        case BridgeErrorCode::WrongType: return "wrong_type";
+        case BridgeErrorCode::OutOfRange: return "out_of_range";
+        case BridgeErrorCode::Unavailable: return "unavailable";
+    }
+    return "none";
+}
+
+BridgeErrorCode BridgeErrorCodeFromString(const std::string& name) {
+    for (BridgeErrorCode code : {BridgeErrorCode::ParseError, BridgeErrorCode::InvalidRequest,
+                                 BridgeErrorCode::UnknownCommand, BridgeErrorCode::UnknownSetting,
+                                 BridgeErrorCode::WrongType, BridgeErrorCode::OutOfRange,
+                                 BridgeErrorCode::Unavailable}) {
+        if (name == BridgeErrorCodeToString(code)) {
+            return code;
+        }
+    }
+    return BridgeErrorCode::None;
+}
+
+bool ParseSettingsChange(const nlohmann::json& args, SettingsChange& change, BridgeError& error) {
+    if (!args.is_object() || args.empty()) {
+        error = {BridgeErrorCode::InvalidRequest, "args", "set needs an object of settings"};
+        return false;
+    }
+    for (auto it = args.begin(); it != args.end(); ++it) {
+        const std::string& key = it.key();
+        const SettingField* field = nullptr;
+        for (const SettingField& candidate : kSettingFields) {
+            if (candidate.name == key) {
+                field = &candidate;
+                break;
+            }
+        }
+        if (!field) {
+            error = {BridgeErrorCode::UnknownSetting, key, "Unknown setting: " + key};
+            return false;
+        }
+        double value = 0.0;
+        if (!ReadValue(it.value(), field->name, field->type, field->min, field->max, value, error)) {
+            return false;
+        }
+        field->assign(change, value);
+    }
+    return true;
+}
+
+const BridgeDispatcher::Command BridgeDispatcher::kCommands[] = {
+    {"set", &BridgeDispatcher::Set},
+    {"getConfig", &BridgeDispatcher::GetConfig},
+    {"getStatus", &BridgeDispatcher::GetStatus},
+    {"getSpeed", &BridgeDispatcher::GetSpeed},
+    {"getSchedulerStats", &BridgeDispatcher::GetSchedulerStats},
+    {"getPhaseStats", &BridgeDispatcher::GetPhaseStats},
+    {"start", &BridgeDispatcher::Start},
+    {"stop", &BridgeDispatcher::Stop},
+    {"startTest", &BridgeDispatcher::StartTest},
+    {"setTelemetryRate", &BridgeDispatcher::SetTelemetryRate},
+};
+
+std::string BridgeDispatcher::Handle(std::string_view text) {
+    nlohmann::json id = nullptr;
+    nlohmann::json result = nlohmann::json::object();
+    BridgeError error;
+    bool ok = false;
+
+    nlohmann::json request = nlohmann::json::parse(text.begin(), text.end(), nullptr, false);
+    if (request.is_discarded()) {
+        error = {BridgeErrorCode::ParseError, "", "Request is not valid JSON"};
+    } else if (!request.is_object()) {
+        error = {BridgeErrorCode::InvalidRequest, "", "Request must be an object"};
+    } else {
+        auto idIt = request.find("id");
+        if (idIt != request.end() && (idIt->is_number() || idIt->is_string())) {
+            id = *idIt;
+        }
+        auto cmdIt = request.find("cmd");
+        auto argsIt = request.find("args");
+        const Command* command = nullptr;
+        if (cmdIt == request.end() || !cmdIt->is_string()) {
+            error = {BridgeErrorCode::InvalidRequest, "cmd", "Request needs a cmd string"};
+        } else {
+            const std::string& name = cmdIt->get_ref<const std::string&>();
+            for (const Command& candidate : kCommands) {
+                if (candidate.name == name) {
+                    command = &candidate;
+                    break;
+                }
+            }
+            if (!command) {
+                error = {BridgeErrorCode::UnknownCommand, "cmd", "Unknown command: " + name};
+            }
+        }
+        if (command && argsIt != request.end() && !argsIt->is_object()) {
+            error = {BridgeErrorCode::WrongType, "args", "args must be an object"};
+            command = nullptr;
+        }
+        if (command) {
+            static const nlohmann::json kNoArgs = nlohmann::json::object();
+            ok = (this->*command->handler)(argsIt != request.end() ? *argsIt : kNoArgs, result, error);
+        }
+    }
+
+    nlohmann::json reply = {{"id", id}, {"ok", ok}};
+    if (ok) {
+        reply["result"] = std::move(result);
+    } else {
+        reply["error"] = {
+            {"code", BridgeErrorCodeToString(error.code)},
+            {"field", error.field},
+            {"message", error.message}
+        };
+    }
+    // Echoed keys may hold invalid UTF-8; replace rather than throw
+    return reply.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+bool BridgeDispatcher::Set(const nlohmann::json& args, nlohmann::json& result, BridgeError& error) {
+    SettingsChange change;
+    if (!ParseSettingsChange(args, change, error)) {
+        return false;
+    }
+    m_core.ApplySettings(change);
+    result = ConfigToJson(m_core);
+    return true;
+}
+
+bool BridgeDispatcher::GetConfig(const nlohmann::json&, nlohmann::json& result, BridgeError&) {
+    result = ConfigToJson(m_core);
+    return true;
+}
+
+bool BridgeDispatcher::GetStatus(const nlohmann::json&, nlohmann::json& result, BridgeError&) {
+    result = {{"running", m_core.IsRunning()}};
+    return true;
+}
+
+bool BridgeDispatcher::GetSpeed(const nlohmann::json&, nlohmann::json& result, BridgeError&) {
+    ControllerState state = m_core.GetCurrentState();
+    result = {
+        {"treadmillSpeed", state.stickY >= 0 ? state.speed : -state.speed},
+        {"gameSpeed", state.stickY * kGameSprintSpeed},
+        {"stickY", state.stickY},
+        {"actualHz", m_core.GetActualUpdateRate()}
+    };
+    return true;
+}
+
+bool BridgeDispatcher::GetSchedulerStats(const nlohmann::json&, nlohmann::json& result, BridgeError&) {
+    SchedulerStats stats = m_core.GetSchedulerStats();
+    result = {
+        {"targetHz", stats.targetHz},
+        {"achievedHz", stats.achievedHz},
+        {"ticks", stats.ticks},
+        {"missedFrames", stats.missedFrames},
+        {"latenessP50Ms", Ms(static_cast<double>(stats.lateness.p50Ns))},
+        {"latenessP99Ms", Ms(static_cast<double>(stats.lateness.p99Ns))},
+        {"latenessMaxMs", Ms(static_cast<double>(stats.lateness.maxNs))},
+        {"tickP50Ms", Ms(static_cast<double>(stats.tickTime.p50Ns))},
+        {"tickP99Ms", Ms(static_cast<double>(stats.tickTime.p99Ns))}
+    };
+    return true;
+}
+
+bool BridgeDispatcher::GetPhaseStats(const nlohmann::json&, nlohmann::json& result, BridgeError&) {
+    PhaseStats stats = m_core.GetPhaseStats();
+    result = {
+        {"locked", stats.locked},
+        {"framePeriodMs", Ms(static_cast<double>(stats.framePeriodNs))},
+        {"stepMs", Ms(static_cast<double>(stats.stepNs))},
+        {"leadMs", Ms(static_cast<double>(stats.leadNs))},
+        {"lockedTicks", stats.lockedTicks},
+        {"unlockedTicks", stats.unlockedTicks},
+        {"meanErrorMs", Ms(stats.meanErrorNs)},
+        {"absErrorP50Ms", Ms(static_cast<double>(stats.absError.p50Ns))},
+        {"absErrorP99Ms", Ms(static_cast<double>(stats.absError.p99Ns))}
+    };
+    return true;
+}
+
+bool BridgeDispatcher::Start(const nlohmann::json&, nlohmann::json& result, BridgeError&) {
+    m_core.Start();
+    result = {{"running", m_core.IsRunning()}};
+    return true;
+}
+
+bool BridgeDispatcher::Stop(const nlohmann::json&, nlohmann::json& result, BridgeError&) {
+    m_core.Stop();
+    result = {{"running", m_core.IsRunning()}};
+    return true;
+}
+
+bool BridgeDispatcher::StartTest(const nlohmann::json&, nlohmann::json&, BridgeError&) {
+    m_core.StartMovementTest();
+    return true;
+}
+
+bool BridgeDispatcher::SetTelemetryRate(const nlohmann::json& args, nlohmann::json& result, BridgeError& error) {
+    if (!m_setTelemetryRate) {
+        error = {BridgeErrorCode::Unavailable, "", "Telemetry push is not available in this host"};
+        return false;
+    }
+    auto it = args.find("hz");
+    if (it == args.end()) {
+        error = {BridgeErrorCode::InvalidRequest, "hz", "setTelemetryRate needs hz"};
+        return false;
+    }
+    double hz = 0.0;
+    if (!ReadValue(*it, "hz", FieldType::Integer, 0, 240, hz, error)) {
+        return false;
+    }
+    m_setTelemetryRate(static_cast<int>(hz));
+    result = {{"hz", static_cast<int>(hz)}};
+    return true;
+}
+
+} // namespace Mouse2VR
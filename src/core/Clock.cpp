@@ -0,0 +1,145 @@
+#include "common/Clock.h"
+#include "common/DeadlineTimer.h"
+#include "common/WakeEvent.h"
+#include <algorithm>
+#include <chrono>
+
+namespace Mouse2VR {
+
+int64_t SystemClock::NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+int64_t SystemClock::WaitUntil(int64_t deadlineNs, DeadlineTimer& timer) {
+    return timer.WaitUntil(deadlineNs);
+}
+
+bool SystemClock::WaitForWake(WakeEvent& wake, int64_t deadlineNs) {
+    if (deadlineNs == kNoDeadline) {
+        wake.Wait();
+        return true;
+    }
+    return wake.WaitFor(std::chrono::nanoseconds(std::max<int64_t>(0, deadlineNs - NowNs())));
+}
+
+SimulatedClock::SimulatedClock(int64_t startNs)
+    : m_now(startNs)
+    , m_horizonNs(startNs) {
+}
+
+int64_t SimulatedClock::WaitUntil(int64_t deadlineNs, DeadlineTimer&) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_interrupted) {
+        if (RunNextEvent(lock, std::min(deadlineNs, m_horizonNs))) {
+            continue;
+        }
+        if (deadlineNs <= m_horizonNs) {
+            SetNow(std::max(NowNs(), deadlineNs));
+            break;
+        }
+        BlockAtHorizon(lock);
+    }
+    m_waits.fetch_add(1, std::memory_order_relaxed);
+    return 0;  // Virtual waits are never late
+}
+
+bool SimulatedClock::WaitForWake(WakeEvent& wake, int64_t deadlineNs) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    bool signaled = false;
+    for (;;) {
+        // Only consumes a signal that is already pending
+        if (wake.WaitFor(std::chrono::nanoseconds(0))) {
+            signaled = true;
+            break;
+        }
+        if (m_interrupted) {
+            break;
+        }
+        if (RunNextEvent(lock, std::min(deadlineNs, m_horizonNs))) {
+            continue;
+        }
+        if (deadlineNs <= m_horizonNs) {
+            SetNow(std::max(NowNs(), deadlineNs));
+            break;
+        }
+        BlockAtHorizon(lock);
+    }
+    m_waits.fetch_add(1, std::memory_order_relaxed);
+    return signaled;
+}
+
+void SimulatedClock::SetInterrupted(bool interrupted) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_interrupted = interrupted;
+    // Cleared just before a thread starts: it is running until its first wait
+    m_running = !interrupted;
+    m_advanced.Signal();
+    m_blocked.Signal();
+}
+
+void SimulatedClock::Schedule(int64_t atNs, std::function<void()> fn) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_events.emplace(std::max(atNs, NowNs()), std::move(fn));
+}
+
+void SimulatedClock::AdvanceTo(int64_t targetNs) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_horizonNs = std::max(m_horizonNs, targetNs);
+    if (m_interrupted) {
+        while (RunNextEvent(lock, m_horizonNs)) {
+        }
+        SetNow(std::max(NowNs(), m_horizonNs));
+        return;
+    }
+    m_advanced.Signal();
+    while (!m_interrupted && (m_running || NowNs() < m_horizonNs)) {
+        lock.unlock();
+        m_blocked.Wait();
+        lock.lock();
+    }
+}
+
+void SimulatedClock::AdvanceBy(int64_t durationNs) {
+    int64_t targetNs;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        targetNs = m_horizonNs + durationNs;
+    }
+    AdvanceTo(targetNs);
+}
+
+bool SimulatedClock::RunNextEvent(std::unique_lock<std::mutex>& lock, int64_t limitNs) {
+    auto next = m_events.begin();
+    if (next == m_events.end() || next->first > limitNs) {
+        return false;
+    }
+    SetNow(std::max(NowNs(), next->first));
+    std::function<void()> fn = std::move(next->second);
+    m_events.erase(next);
+
+    // Events may schedule more events or read the clock
+    lock.unlock();
+    fn();
+    lock.lock();
+    return true;
+}
+
+void SimulatedClock::BlockAtHorizon(std::unique_lock<std::mutex>& lock) {
+    SetNow(std::max(NowNs(), m_horizonNs));
+    m_running = false;
+    m_blocked.Signal();
+    // Signals are kept until consumed, so none is lost while unlocked
+    while (!m_interrupted && m_horizonNs <= NowNs()) {
+        lock.unlock();
+        m_advanced.Wait();
+        lock.lock();
+    }
+    m_running = true;
+}
+
+void SimulatedClock::SetNow(int64_t nowNs) {
+    m_now.store(nowNs, std::memory_order_release);
+}
+
+} // namespace Mouse2VR
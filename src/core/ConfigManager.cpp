@@ -1,13 +1,157 @@
 #include "core/ConfigManager.h"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 
+#ifdef _WIN32
+#include "common/WindowsHeaders.h"
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 namespace Mouse2VR {
 
+namespace {
+
+nlohmann::json ThreadPolicyToJson(const ThreadPolicyConfig& policy) {
+    return nlohmann::json{
+        {"priority", ThreadPriorityToString(policy.priority)},
+        {"scheduler", ThreadSchedulerToString(policy.scheduler)},
+        {"realtimePriority", policy.realtimePriority},
+        {"affinityMask", policy.affinityMask}
+    };
+}
+
+void ThreadPolicyFromJson(const nlohmann::json& j, ThreadPolicyConfig& policy) {
+    if (j.contains("priority")) policy.priority = ThreadPriorityFromString(j["priority"].get<std::string>());
+    if (j.contains("scheduler")) policy.scheduler = ThreadSchedulerFromString(j["scheduler"].get<std::string>());
+    if (j.contains("realtimePriority")) policy.realtimePriority = j["realtimePriority"];
+    if (j.contains("affinityMask")) policy.affinityMask = j["affinityMask"];
+}
+
+int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Write text to path and make it durable before returning
+bool WriteDurably(const std::string& path, const std::string& text) {
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    DWORD written = 0;
+    bool ok = WriteFile(file, text.data(), static_cast<DWORD>(text.size()), &written, nullptr) &&
+              written == text.size() && FlushFileBuffers(file);
+    CloseHandle(file);
+    return ok;
+#else
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return false;
+    }
+    size_t offset = 0;
+    while (offset < text.size()) {
+        ssize_t written = write(fd, text.data() + offset, text.size() - offset);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            close(fd);
+            return false;
+        }
+        offset += static_cast<size_t>(written);
+    }
+    bool ok = fsync(fd) == 0;
+    return close(fd) == 0 && ok;
+#endif
+}
+
+// Temp file beside path (so the rename stays on one filesystem), unique
+// per process so two instances saving the same config never share it
+std::string TempPathFor(const std::string& path) {
+#ifdef _WIN32
+    unsigned long pid = GetCurrentProcessId();
+#else
+    unsigned long pid = static_cast<unsigned long>(getpid());
+#endif
+    return path + "." + std::to_string(pid) + ".tmp";
+}
+
+// Atomically replace target with source (same directory)
+bool ReplaceWith(const std::string& source, const std::string& target) {
+#ifdef _WIN32
+    return MoveFileExA(source.c_str(), target.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+    if (std::rename(source.c_str(), target.c_str()) != 0) {
+        return false;
+    }
+    // Make the rename itself durable
+    std::filesystem::path directory = std::filesystem::path(target).parent_path();
+    int fd = open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+    return true;
+#endif
+}
+
+} // namespace
+
+bool SettingsChange::Empty() const {
+    return !ChangesProcessing() && !updateRateHz && !eventDriven && !coalesceWindowUs &&
+           !maxOutputRateHz && !adaptiveMode && !idleUpdateIntervalMs && !idleTimeoutMs;
+}
+
+bool SettingsChange::ChangesProcessing() const {
+    return sensitivity || countsPerMeter || invertY || lockX || lockY;
+}
+
+void SettingsChange::ApplyTo(AppConfig& config) const {
+    if (sensitivity) config.sensitivity = *sensitivity;
+    if (countsPerMeter) config.countsPerMeter = *countsPerMeter;
+    if (invertY) config.invertY = *invertY;
+    if (lockX) config.lockX = *lockX;
+    if (lockY) config.lockY = *lockY;
+    if (updateRateHz && *updateRateHz > 0) config.updateIntervalMs = 1000 / *updateRateHz;
+    if (eventDriven) config.eventDriven = *eventDriven;
+    if (coalesceWindowUs) config.coalesceWindowUs = *coalesceWindowUs;
+    if (maxOutputRateHz) config.maxOutputRateHz = *maxOutputRateHz;
+    if (adaptiveMode) config.adaptiveMode = *adaptiveMode;
+    if (idleUpdateIntervalMs) config.idleUpdateIntervalMs = *idleUpdateIntervalMs;
+    if (idleTimeoutMs) config.idleTimeoutMs = *idleTimeoutMs;
+}
+
+void SettingsChange::ApplyTo(ProcessingConfig& config) const {
+    if (sensitivity) config.sensitivity = *sensitivity;
+    if (countsPerMeter) config.countsPerMeter = *countsPerMeter;
+    if (invertY) config.invertY = *invertY;
+    if (lockX) config.lockX = *lockX;
+    if (lockY) config.lockY = *lockY;
+}
+
 ConfigManager::ConfigManager(const std::string& configPath) 
     : m_configPath(configPath) {
 }
 
+ConfigManager::~ConfigManager() {
+    {
+        std::lock_guard<std::mutex> lock(m_writerMutex);
+        m_stopWriter = true;
+    }
+    m_writerWake.Signal();
+    if (m_writer.joinable()) {
+        m_writer.join();
+    }
+    Flush();
+}
+
 bool ConfigManager::Load() {
     std::ifstream file(m_configPath);
     if (!file.is_open()) {
@@ -46,20 +190,97 @@ bool ConfigManager::Load() {
 }
 
 bool ConfigManager::Save() {
+    m_dirty = false;  // This write covers any pending request
+    return WriteConfigFile();
+}
+
+void ConfigManager::RequestSave() {
+    int64_t now = NowNs();
+    m_saveRequests.fetch_add(1, std::memory_order_relaxed);
+    m_lastRequestNs.store(now);
+    if (!m_dirty.exchange(true)) {
+        m_pendingSinceNs.store(now);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_writerMutex);
+        if (m_stopWriter) {
+            return;  // Shutting down; the destructor flushes
+        }
+        if (!m_writer.joinable()) {
+            m_writer = std::thread(&ConfigManager::WriterLoop, this);
+        }
+    }
+    m_writerWake.Signal();
+}
+
+void ConfigManager::SetSaveDelay(std::chrono::milliseconds debounce, std::chrono::milliseconds maxDelay) {
+    m_debounceNs = std::chrono::duration_cast<std::chrono::nanoseconds>(debounce).count();
+    m_maxDelayNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::max(maxDelay, debounce)).count();
+    m_writerWake.Signal();  // Re-evaluate a pending deadline
+}
+
+bool ConfigManager::Flush() {
+    return WriteIfDirty();
+}
+
+ConfigSaveStats ConfigManager::GetSaveStats() const {
+    ConfigSaveStats stats;
+    stats.requests = m_saveRequests.load(std::memory_order_relaxed);
+    stats.writes = m_writes.load(std::memory_order_relaxed);
+    stats.failures = m_writeFailures.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void ConfigManager::WriterLoop() {
+    while (!m_stopWriter) {
+        if (!m_dirty) {
+            m_writerWake.Wait();
+            continue;
+        }
+        // Due once requests have paused for the debounce window, but no
+        // later than maxDelay after the first unsaved one
+        int64_t due = std::min(m_lastRequestNs.load() + m_debounceNs.load(),
+                               m_pendingSinceNs.load() + m_maxDelayNs.load());
+        int64_t now = NowNs();
+        if (now < due) {
+            m_writerWake.WaitFor(std::chrono::nanoseconds(due - now));
+            continue;
+        }
+        WriteIfDirty();
+    }
+}
+
+bool ConfigManager::WriteIfDirty() {
+    if (!m_dirty.exchange(false)) {
+        return true;
+    }
+    return WriteConfigFile();
+}
+
+bool ConfigManager::WriteConfigFile() {
+    std::lock_guard<std::mutex> writeLock(m_writeMutex);
     try {
-        std::ofstream file(m_configPath);
-        if (!file.is_open()) {
-            std::cerr << "Failed to open config file for writing: " << m_configPath << "\n";
-            return false;
+        nlohmann::json j;
+        {
+            std::lock_guard<std::mutex> lock(m_configMutex);
+            j = ConfigToJson(m_config);
         }
+        std::string text = j.dump(4);  // Pretty print with 4 spaces
         
-        std::lock_guard<std::mutex> lock(m_configMutex);
-        nlohmann::json j = ConfigToJson(m_config);
-        file << j.dump(4);  // Pretty print with 4 spaces
+        std::string tempPath = TempPathFor(m_configPath);
+        if (!WriteDurably(tempPath, text) || !ReplaceWith(tempPath, m_configPath)) {
+            std::cerr << "Failed to write config file: " << m_configPath << "\n";
+            std::error_code ignored;
+            std::filesystem::remove(tempPath, ignored);
+            m_writeFailures.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
         
+        m_writes.fetch_add(1, std::memory_order_relaxed);
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Failed to save config: " << e.what() << "\n";
+        m_writeFailures.fetch_add(1, std::memory_order_relaxed);
         return false;
     }
 }
@@ -84,6 +305,11 @@ bool ConfigManager::CreateDefaultConfig() const {
 }
 
 nlohmann::json ConfigManager::ConfigToJson(const AppConfig& config) {
+    nlohmann::json curvePoints = nlohmann::json::array();
+    for (const CurvePoint& point : config.curve.points) {
+        curvePoints.push_back({point.input, point.output});
+    }
+    
     return nlohmann::json{
         {"processing", {
             {"sensitivity", config.sensitivity},
@@ -95,10 +321,52 @@ nlohmann::json ConfigManager::ConfigToJson(const AppConfig& config) {
             {"maxSpeed", config.maxSpeed},
             {"countsPerMeter", config.countsPerMeter}
         }},
+        {"velocity", {
+            {"filter", VelocityFilterToString(config.velocity.filter)},
+            {"emaTimeConstant", config.velocity.emaTimeConstant},
+            {"oneEuroMinCutoff", config.velocity.oneEuroMinCutoff},
+            {"oneEuroBeta", config.velocity.oneEuroBeta},
+            {"oneEuroDerivativeCutoff", config.velocity.oneEuroDerivativeCutoff},
+            {"alphaBetaAlpha", config.velocity.alphaBetaAlpha},
+            {"alphaBetaBeta", config.velocity.alphaBetaBeta},
+            {"medianWindow", config.velocity.medianWindow}
+        }},
+        {"prediction", {
+            {"enabled", config.prediction.enabled},
+            {"horizonMs", config.prediction.horizonMs},
+            {"accelerationTimeConstant", config.prediction.accelerationTimeConstant},
+            {"maxLeadFraction", config.prediction.maxLeadFraction},
+            {"fastStopRatio", config.prediction.fastStopRatio}
+        }},
+        {"curve", {
+            {"type", ResponseCurveTypeToString(config.curve.type)},
+            {"inputMax", config.curve.inputMax},
+            {"gamma", config.curve.gamma},
+            {"points", curvePoints}
+        }},
         {"update", {
             {"updateIntervalMs", config.updateIntervalMs},
             {"adaptiveMode", config.adaptiveMode},
-            {"idleUpdateIntervalMs", config.idleUpdateIntervalMs}
+            {"idleUpdateIntervalMs", config.idleUpdateIntervalMs},
+            {"idleTimeoutMs", config.idleTimeoutMs},
+            {"timerStrategy", TimerStrategyToString(config.timerStrategy)},
+            {"eventDriven", config.eventDriven},
+            {"coalesceWindowUs", config.coalesceWindowUs},
+            {"maxOutputRateHz", config.maxOutputRateHz}
+        }},
+        {"frameClock", {
+            {"source", FrameClockSourceToString(config.frameClock.source)},
+            {"port", config.frameClock.port},
+            {"leadUs", config.frameClock.leadUs}
+        }},
+        {"stateChannel", {
+            {"enabled", config.stateChannel.enabled},
+            {"name", config.stateChannel.name}
+        }},
+        {"threads", {
+            {"processing", ThreadPolicyToJson(config.processingThread)},
+            {"input", ThreadPolicyToJson(config.inputThread)},
+            {"lockMemory", config.lockMemory}
         }},
         {"debug", {
             {"showDebugInfo", config.showDebugInfo},
@@ -124,12 +392,78 @@ AppConfig ConfigManager::JsonToConfig(const nlohmann::json& j) {
         if (proc.contains("countsPerMeter")) config.countsPerMeter = proc["countsPerMeter"];
     }
     
+    // Velocity filter settings
+    if (j.contains("velocity")) {
+        auto& vel = j["velocity"];
+        if (vel.contains("filter")) config.velocity.filter = VelocityFilterFromString(vel["filter"].get<std::string>());
+        if (vel.contains("emaTimeConstant")) config.velocity.emaTimeConstant = vel["emaTimeConstant"];
+        if (vel.contains("oneEuroMinCutoff")) config.velocity.oneEuroMinCutoff = vel["oneEuroMinCutoff"];
+        if (vel.contains("oneEuroBeta")) config.velocity.oneEuroBeta = vel["oneEuroBeta"];
+        if (vel.contains("oneEuroDerivativeCutoff")) config.velocity.oneEuroDerivativeCutoff = vel["oneEuroDerivativeCutoff"];
+        if (vel.contains("alphaBetaAlpha")) config.velocity.alphaBetaAlpha = vel["alphaBetaAlpha"];
+        if (vel.contains("alphaBetaBeta")) config.velocity.alphaBetaBeta = vel["alphaBetaBeta"];
+        if (vel.contains("medianWindow")) config.velocity.medianWindow = vel["medianWindow"];
+    }
+    
+    // Prediction settings
+    if (j.contains("prediction")) {
+        auto& pred = j["prediction"];
+        if (pred.contains("enabled")) config.prediction.enabled = pred["enabled"];
+        if (pred.contains("horizonMs")) config.prediction.horizonMs = pred["horizonMs"];
+        if (pred.contains("accelerationTimeConstant")) config.prediction.accelerationTimeConstant = pred["accelerationTimeConstant"];
+        if (pred.contains("maxLeadFraction")) config.prediction.maxLeadFraction = pred["maxLeadFraction"];
+        if (pred.contains("fastStopRatio")) config.prediction.fastStopRatio = pred["fastStopRatio"];
+    }
+    
+    // Response curve settings; points are [input, output] pairs
+    if (j.contains("curve")) {
+        auto& crv = j["curve"];
+        if (crv.contains("type")) config.curve.type = ResponseCurveTypeFromString(crv["type"].get<std::string>());
+        if (crv.contains("inputMax")) config.curve.inputMax = crv["inputMax"];
+        if (crv.contains("gamma")) config.curve.gamma = crv["gamma"];
+        if (crv.contains("points") && crv["points"].is_array()) {
+            for (const auto& point : crv["points"]) {
+                if (point.is_array() && point.size() == 2) {
+                    config.curve.points.push_back({point[0].get<float>(), point[1].get<float>()});
+                }
+            }
+        }
+    }
+    
     // Update settings
     if (j.contains("update")) {
         auto& upd = j["update"];
         if (upd.contains("updateIntervalMs")) config.updateIntervalMs = upd["updateIntervalMs"];
         if (upd.contains("adaptiveMode")) config.adaptiveMode = upd["adaptiveMode"];
         if (upd.contains("idleUpdateIntervalMs")) config.idleUpdateIntervalMs = upd["idleUpdateIntervalMs"];
+        if (upd.contains("idleTimeoutMs")) config.idleTimeoutMs = upd["idleTimeoutMs"];
+        if (upd.contains("timerStrategy")) config.timerStrategy = TimerStrategyFromString(upd["timerStrategy"].get<std::string>());
+        if (upd.contains("eventDriven")) config.eventDriven = upd["eventDriven"];
+        if (upd.contains("coalesceWindowUs")) config.coalesceWindowUs = upd["coalesceWindowUs"];
+        if (upd.contains("maxOutputRateHz")) config.maxOutputRateHz = upd["maxOutputRateHz"];
+    }
+    
+    // Frame clock settings
+    if (j.contains("frameClock")) {
+        auto& clk = j["frameClock"];
+        if (clk.contains("source")) config.frameClock.source = FrameClockSourceFromString(clk["source"].get<std::string>());
+        if (clk.contains("port")) config.frameClock.port = clk["port"];
+        if (clk.contains("leadUs")) config.frameClock.leadUs = clk["leadUs"];
+    }
+    
+    // State channel settings
+    if (j.contains("stateChannel")) {
+        auto& chn = j["stateChannel"];
+        if (chn.contains("enabled")) config.stateChannel.enabled = chn["enabled"];
+        if (chn.contains("name")) config.stateChannel.name = chn["name"].get<std::string>();
+    }
+    
+    // Thread policy settings
+    if (j.contains("threads")) {
+        auto& thr = j["threads"];
+        if (thr.contains("processing")) ThreadPolicyFromJson(thr["processing"], config.processingThread);
+        if (thr.contains("input")) ThreadPolicyFromJson(thr["input"], config.inputThread);
+        if (thr.contains("lockMemory")) config.lockMemory = thr["lockMemory"];
     }
     
     // Debug settings
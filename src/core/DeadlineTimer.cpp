@@ -0,0 +1,175 @@
+#include "common/DeadlineTimer.h"
+#include "common/Logger.h"
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#if defined(_WIN32)
+#include "common/WindowsHeaders.h"
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
+#elif defined(__linux__)
+#include <cerrno>
+#include <sys/timerfd.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace Mouse2VR {
+
+namespace {
+
+int64_t NowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#if defined(__linux__)
+timespec ToTimespec(int64_t ns) {
+    timespec ts;
+    ts.tv_sec = static_cast<time_t>(ns / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(ns % 1000000000LL);
+    return ts;
+}
+#endif
+
+} // namespace
+
+const char* TimerStrategyToString(TimerStrategy strategy) {
+    switch (strategy) {
+        case TimerStrategy::Precise: return "precise";
+        case TimerStrategy::TimerFd: return "timerfd";
+        case TimerStrategy::SleepSpin: return "sleep-spin";
+    }
+    return "precise";
+}
+
+TimerStrategy TimerStrategyFromString(const std::string& name) {
+    if (name == "timerfd") return TimerStrategy::TimerFd;
+    if (name == "sleep-spin") return TimerStrategy::SleepSpin;
+    return TimerStrategy::Precise;
+}
+
+int64_t DeadlineTimer::DefaultSpinTailNs(TimerStrategy strategy) {
+    if (strategy == TimerStrategy::SleepSpin) {
+        return 2000000;
+    }
+#if defined(_WIN32)
+    // High-resolution waitable timers overshoot by up to ~0.5 ms
+    return 500000;
+#else
+    // Covers the default 50 us timer slack plus wake-up latency
+    return 100000;
+#endif
+}
+
+DeadlineTimer::DeadlineTimer(TimerStrategy strategy) {
+    SetStrategy(strategy);
+}
+
+DeadlineTimer::~DeadlineTimer() {
+    CloseHandles();
+}
+
+void DeadlineTimer::SetStrategy(TimerStrategy strategy) {
+    CloseHandles();
+    m_strategy = strategy;
+    m_spinTailNs = DefaultSpinTailNs(strategy);
+
+#if defined(_WIN32)
+    if (strategy != TimerStrategy::SleepSpin) {
+        m_timer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+        if (!m_timer) {
+            // Pre-1803 Windows: regular timer, so the tail has to cover the
+            // 1 ms timeBeginPeriod granularity
+            m_timer = CreateWaitableTimerExW(nullptr, nullptr, 0, TIMER_ALL_ACCESS);
+            m_spinTailNs = 1500000;
+        }
+        if (!m_timer) {
+            LOG_ERROR("DeadlineTimer", "CreateWaitableTimer failed: {}", GetLastError());
+        }
+    }
+#elif defined(__linux__)
+    if (strategy == TimerStrategy::TimerFd) {
+        m_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC);
+        if (m_timerFd < 0) {
+            LOG_ERROR("DeadlineTimer", "timerfd_create failed ({}); using clock_nanosleep", errno);
+        }
+    }
+#endif
+}
+
+void DeadlineTimer::SetSpinTailNs(int64_t spinTailNs) {
+    m_spinTailNs = spinTailNs < 0 ? 0 : spinTailNs;
+}
+
+void DeadlineTimer::CloseHandles() {
+#if defined(_WIN32)
+    if (m_timer) {
+        CloseHandle(static_cast<HANDLE>(m_timer));
+        m_timer = nullptr;
+    }
+#elif defined(__linux__)
+    if (m_timerFd >= 0) {
+        close(m_timerFd);
+        m_timerFd = -1;
+    }
+#endif
+}
+
+int64_t DeadlineTimer::WaitUntil(int64_t deadlineNs) {
+    int64_t now = NowNs();
+    if (m_strategy == TimerStrategy::SleepSpin) {
+        // === Original scheduler: 1 ms sleeps until inside the spin window ===
+        while (deadlineNs - now > m_spinTailNs) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            now = NowNs();
+        }
+    } else if (deadlineNs - now > m_spinTailNs) {
+        KernelSleepUntil(deadlineNs - m_spinTailNs);
+        now = NowNs();
+    }
+
+    // === Spin tail: absorbs the kernel's wake-up overshoot ===
+    while (now < deadlineNs) {
+        now = NowNs();
+    }
+    return now - deadlineNs;
+}
+
+void DeadlineTimer::KernelSleepUntil(int64_t wakeNs) {
+#if defined(_WIN32)
+    if (m_timer) {
+        // Waitable timers take absolute times on the wall clock only, so
+        // arm a relative due time (negative, 100 ns units) from now
+        LARGE_INTEGER due;
+        due.QuadPart = -std::max<int64_t>(1, (wakeNs - NowNs()) / 100);
+        if (SetWaitableTimerEx(static_cast<HANDLE>(m_timer), &due, 0, nullptr, nullptr, nullptr, 0)) {
+            WaitForSingleObject(static_cast<HANDLE>(m_timer), INFINITE);
+            return;
+        }
+    }
+    std::this_thread::sleep_for(std::chrono::nanoseconds(wakeNs - NowNs()));
+#elif defined(__linux__)
+    // steady_clock is CLOCK_MONOTONIC, so deadlines are absolute and a
+    // preempted thread never oversleeps by the time it lost before the call
+    const timespec target = ToTimespec(wakeNs);
+    if (m_timerFd >= 0) {
+        itimerspec spec = {};
+        spec.it_value = target;
+        if (timerfd_settime(m_timerFd, TFD_TIMER_ABSTIME, &spec, nullptr) == 0) {
+            uint64_t expirations;
+            while (read(m_timerFd, &expirations, sizeof(expirations)) < 0 && errno == EINTR) {
+            }
+            return;
+        }
+    }
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR) {
+    }
+#else
+    std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(wakeNs)));
+#endif
+}
+
+} // namespace Mouse2VR
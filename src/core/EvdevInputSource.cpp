@@ -0,0 +1,269 @@
+#include "core/EvdevInputSource.h"
+#include "common/Logger.h"
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace Mouse2VR {
+
+EvdevInputSource::EvdevInputSource(std::string devicePath)
+    : m_devicePath(std::move(devicePath)) {
+}
+
+EvdevInputSource::EvdevInputSource(int fd, std::string name)
+    : m_devicePath(std::move(name))
+    , m_fd(fd) {
+}
+
+EvdevInputSource::~EvdevInputSource() {
+    Stop();
+    if (m_fd >= 0) {
+        close(m_fd);
+        m_fd = -1;
+    }
+}
+
+bool EvdevInputSource::Start() {
+    if (m_running) {
+        return true;
+    }
+
+    if (!OpenDevice()) {
+        return false;
+    }
+
+    m_endOfStream = false;
+    m_pendingX = 0;
+    m_pendingY = 0;
+    m_dropping = false;
+    m_bufferFill = 0;
+
+    m_running = true;
+    m_readerThread = std::thread(&EvdevInputSource::ReadLoop, this);
+    LOG_INFO("Evdev", "Reading " + m_devicePath + (m_pollable ? " (epoll)" : " (stream)"));
+    return true;
+}
+
+void EvdevInputSource::Stop() {
+    if (!m_running && !m_readerThread.joinable()) {
+        return;
+    }
+
+    m_running = false;
+    if (m_wakeFd >= 0) {
+        uint64_t one = 1;
+        ssize_t written = write(m_wakeFd, &one, sizeof(one));
+        (void)written;
+    }
+
+    if (m_readerThread.joinable()) {
+        m_readerThread.join();
+    }
+
+    CloseDescriptors();
+}
+
+MouseDelta EvdevInputSource::GetAndResetDeltas() {
+    std::lock_guard<TimedMutex> lock(m_drainMutex);
+    return m_samples.DrainAggregate();
+}
+
+size_t EvdevInputSource::DrainSamples(InputSample* out, size_t maxCount) {
+    std::lock_guard<TimedMutex> lock(m_drainMutex);
+    return m_samples.Drain(out, maxCount);
+}
+
+bool EvdevInputSource::OpenDevice() {
+    if (m_fd < 0) {
+        m_fd = open(m_devicePath.c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+        if (m_fd < 0) {
+            LOG_ERROR("Evdev", "Failed to open " + m_devicePath + ": " + std::strerror(errno));
+            return false;
+        }
+    } else {
+        int flags = fcntl(m_fd, F_GETFL);
+        if (flags >= 0) {
+            fcntl(m_fd, F_SETFL, flags | O_NONBLOCK);
+        }
+    }
+
+    // Ask for CLOCK_MONOTONIC event times so they share steady_clock's epoch.
+    // Pipes and files don't support the ioctl; their samples get arrival time.
+    int clockId = CLOCK_MONOTONIC;
+    m_kernelTimestamps = ioctl(m_fd, EVIOCSCLOCKID, &clockId) == 0;
+
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_epollFd < 0 || m_wakeFd < 0) {
+        LOG_ERROR("Evdev", std::string("Failed to create epoll/eventfd: ") + std::strerror(errno));
+        CloseDescriptors();
+        return false;
+    }
+
+    epoll_event wakeEvent = {};
+    wakeEvent.events = EPOLLIN;
+    wakeEvent.data.fd = m_wakeFd;
+    epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeFd, &wakeEvent);
+
+    epoll_event inputEvent = {};
+    inputEvent.events = EPOLLIN;
+    inputEvent.data.fd = m_fd;
+    if (epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_fd, &inputEvent) == 0) {
+        m_pollable = true;
+    } else if (errno == EPERM) {
+        // Regular files are always readable and cannot be polled
+        m_pollable = false;
+    } else {
+        LOG_ERROR("Evdev", "Failed to watch " + m_devicePath + ": " + std::strerror(errno));
+        CloseDescriptors();
+        return false;
+    }
+
+    return true;
+}
+
+void EvdevInputSource::CloseDescriptors() {
+    if (m_epollFd >= 0) {
+        close(m_epollFd);
+        m_epollFd = -1;
+    }
+    if (m_wakeFd >= 0) {
+        close(m_wakeFd);
+        m_wakeFd = -1;
+    }
+}
+
+void EvdevInputSource::SetThreadPolicy(const ThreadPolicyConfig& policy) {
+    std::lock_guard<std::mutex> lock(m_policyMutex);
+    m_threadPolicy = policy;
+}
+
+AppliedThreadPolicy EvdevInputSource::GetAppliedThreadPolicy() const {
+    std::lock_guard<std::mutex> lock(m_policyMutex);
+    return m_appliedPolicy;
+}
+
+void EvdevInputSource::ReadLoop() {
+    {
+        std::lock_guard<std::mutex> lock(m_policyMutex);
+        m_appliedPolicy = m_threadPolicy.IsDefault() ? QueryThreadPolicy() : ApplyThreadPolicy(m_threadPolicy);
+        if (!m_appliedPolicy.failures.empty()) {
+            LOG_WARNING("Evdev", "Reader thread policy not fully applied: " + m_appliedPolicy.failures);
+        }
+    }
+
+    epoll_event events[2];
+
+    while (m_running) {
+        if (m_pollable) {
+            int ready = epoll_wait(m_epollFd, events, 2, -1);
+            if (ready < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                LOG_ERROR("Evdev", std::string("epoll_wait failed: ") + std::strerror(errno));
+                break;
+            }
+
+            bool inputReady = false;
+            for (int i = 0; i < ready; ++i) {
+                if (events[i].data.fd == m_fd) {
+                    inputReady = true;
+                }
+            }
+            if (!inputReady) {
+                continue;  // Woken by Stop()
+            }
+        }
+
+        if (!ReadAvailable()) {
+            break;
+        }
+    }
+
+    m_running = false;
+}
+
+bool EvdevInputSource::ReadAvailable() {
+    // Drain everything currently readable, many events per read()
+    while (m_running) {
+        ssize_t bytes = read(m_fd, m_readBuffer + m_bufferFill, sizeof(m_readBuffer) - m_bufferFill);
+
+        if (bytes < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return true;  // Back to epoll
+            }
+            LOG_ERROR("Evdev", "Read failed on " + m_devicePath + ": " + std::strerror(errno));
+            return false;
+        }
+
+        if (bytes == 0) {
+            m_endOfStream = true;
+            LOG_INFO("Evdev", "End of stream on " + m_devicePath);
+            return false;
+        }
+
+        m_readCount.fetch_add(1, std::memory_order_relaxed);
+        m_bufferFill += static_cast<size_t>(bytes);
+
+        const size_t eventCount = m_bufferFill / sizeof(input_event);
+        ProcessEvents(reinterpret_cast<const input_event*>(m_readBuffer), eventCount);
+
+        const size_t consumed = eventCount * sizeof(input_event);
+        const size_t remainder = m_bufferFill - consumed;
+        if (remainder > 0) {
+            std::memmove(m_readBuffer, m_readBuffer + consumed, remainder);
+        }
+        m_bufferFill = remainder;
+    }
+    return true;
+}
+
+void EvdevInputSource::ProcessEvents(const input_event* events, size_t count) {
+    m_eventCount.fetch_add(count, std::memory_order_relaxed);
+
+    for (size_t i = 0; i < count; ++i) {
+        const input_event& ev = events[i];
+
+        if (ev.type == EV_REL) {
+            if (m_dropping) {
+                continue;
+            }
+            if (ev.code == REL_X) {
+                m_pendingX += ev.value;
+            } else if (ev.code == REL_Y) {
+                m_pendingY += ev.value;
+            }
+        } else if (ev.type == EV_SYN) {
+            if (ev.code == SYN_DROPPED) {
+                // Kernel buffer overran: discard the partial report
+                m_dropping = true;
+                m_pendingX = 0;
+                m_pendingY = 0;
+                m_droppedReports.fetch_add(1, std::memory_order_relaxed);
+            } else if (ev.code == SYN_REPORT) {
+                if (m_dropping) {
+                    m_dropping = false;
+                } else if (m_pendingX != 0 || m_pendingY != 0) {
+                    int64_t timestampNs = m_kernelTimestamps
+                        ? static_cast<int64_t>(ev.input_event_sec) * 1000000000LL +
+                          static_cast<int64_t>(ev.input_event_usec) * 1000LL
+                        : InputSampleQueue::NowNs();
+                    m_samples.Push(timestampNs, m_pendingX, m_pendingY);
+                }
+                m_pendingX = 0;
+                m_pendingY = 0;
+            }
+        }
+    }
+}
+
+} // namespace Mouse2VR
@@ -0,0 +1,140 @@
+#include "core/FrameClock.h"
+#include "core/InputSampleQueue.h"
+#include "common/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace Mouse2VR {
+
+namespace {
+
+int64_t FloorMod(int64_t value, int64_t modulus) {
+    int64_t r = value % modulus;
+    return r < 0 ? r + modulus : r;
+}
+
+} // namespace
+
+const char* FrameClockSourceToString(FrameClockSource source) {
+    return source == FrameClockSource::Udp ? "udp" : "none";
+}
+
+FrameClockSource FrameClockSourceFromString(const std::string& name) {
+    return name == "udp" ? FrameClockSource::Udp : FrameClockSource::None;
+}
+
+// === PhaseGrid ===
+
+PhaseGrid PhaseGrid::Create(const FrameTiming& timing, int64_t leadNs, int targetHz) {
+    PhaseGrid grid;
+    grid.stepNs = timing.periodNs;
+    if (targetHz > 0) {
+        double frameHz = 1e9 / static_cast<double>(timing.periodNs);
+        if (targetHz >= frameHz) {
+            int64_t perFrame = std::max<int64_t>(1, std::llround(targetHz / frameHz));
+            grid.stepNs = timing.periodNs / perFrame;
+        } else {
+            int64_t framesPerTick = std::max<int64_t>(1, std::llround(frameHz / targetHz));
+            grid.stepNs = timing.periodNs * framesPerTick;
+        }
+    }
+    grid.anchorNs = FloorMod(timing.vsyncNs - leadNs, grid.stepNs);
+    return grid;
+}
+
+int64_t PhaseGrid::NextAfter(int64_t ns) const {
+    return ns - FloorMod(ns - anchorNs, stepNs) + stepNs;
+}
+
+int64_t PhaseGrid::ErrorAt(int64_t ns) const {
+    int64_t offset = FloorMod(ns - anchorNs, stepNs);
+    return offset > stepNs / 2 ? offset - stepNs : offset;
+}
+
+// === SyntheticFrameClock ===
+
+int64_t SyntheticFrameClock::LastVsyncAt(int64_t nowNs) const {
+    int64_t period = m_periodNs.load(std::memory_order_relaxed);
+    int64_t phase = m_phaseNs.load(std::memory_order_relaxed);
+    return nowNs - FloorMod(nowNs - phase, period);
+}
+
+FrameTiming SyntheticFrameClock::GetTiming() {
+    FrameTiming timing;
+    if (!m_available.load(std::memory_order_relaxed)) {
+        return timing;
+    }
+    timing.vsyncNs = LastVsyncAt(m_clock ? m_clock->NowNs() : InputSampleQueue::NowNs());
+    timing.periodNs = m_periodNs.load(std::memory_order_relaxed);
+    return timing;
+}
+
+// === UdpFrameClock ===
+
+UdpFrameClock::UdpFrameClock(uint16_t port, int64_t staleAfterNs)
+    : m_staleAfterNs(staleAfterNs) {
+    if (!m_socket.IsOpen()) {
+        LOG_ERROR("FrameClock", "Failed to create UDP socket");
+        return;
+    }
+    if (!m_socket.Bind("127.0.0.1", port)) {
+        LOG_ERROR("FrameClock", "Failed to bind frame clock port {}", port);
+        return;
+    }
+    m_socket.SetNonBlocking();
+    m_port = m_socket.GetLocalPort();
+    m_open = true;
+    LOG_INFO("FrameClock", "Listening for vsync timing on 127.0.0.1:{}", m_port);
+}
+
+FrameTiming UdpFrameClock::GetTiming() {
+    if (!IsOpen()) {
+        return FrameTiming{};
+    }
+
+    // Drain everything queued; only the newest packet matters. Oversized
+    // datagrams report their full size and are rejected.
+    char buffer[64];
+    FrameClockPacket packet;
+    for (;;) {
+        int received = m_socket.Receive(buffer, sizeof(buffer));
+        if (received < 0) {
+            break;
+        }
+        std::memcpy(&packet, buffer, sizeof(packet));
+        if (received != static_cast<int>(sizeof(packet)) ||
+            packet.magic != FrameClockPacket::kMagic || packet.version != FrameClockPacket::kVersion ||
+            packet.periodNs <= 0) {
+            m_rejected++;
+            continue;
+        }
+        m_timing.vsyncNs = packet.vsyncNs;
+        m_timing.periodNs = packet.periodNs;
+        m_receivedNs = InputSampleQueue::NowNs();
+        m_packets++;
+    }
+
+    if (!m_timing.IsValid() || InputSampleQueue::NowNs() - m_receivedNs > m_staleAfterNs) {
+        return FrameTiming{};
+    }
+    return m_timing;
+}
+
+// === FrameClockSender ===
+
+FrameClockSender::FrameClockSender(uint16_t port)
+    : m_port(port) {
+    if (!m_socket.IsOpen()) {
+        LOG_ERROR("FrameClock", "Failed to create UDP socket");
+    }
+}
+
+bool FrameClockSender::Send(const FrameTiming& timing) {
+    FrameClockPacket packet;
+    packet.vsyncNs = timing.vsyncNs;
+    packet.periodNs = timing.periodNs;
+    return m_socket.SendTo(&packet, sizeof(packet), 0x7F000001, m_port);  // 127.0.0.1
+}
+
+} // namespace Mouse2VR
@@ -5,54 +5,78 @@
 
 namespace Mouse2VR {
 
-InputProcessor::InputProcessor() {
-    // Default config is already set via member initialization
+std::unique_ptr<ProcessingSnapshot> ProcessingSnapshot::Create(const ProcessingConfig& config, uint64_t version) {
+    auto snapshot = std::make_unique<ProcessingSnapshot>();
+    snapshot->config = config;
+    snapshot->version = version;
+    
+    // Formula: deflection = counts/sec / DPI * 0.0254 / 6.1 * sensitivity
+    // With DPI from countsPerMeter: DPI = countsPerMeter / 39.3701
+    snapshot->dpi = config.countsPerMeter / 39.3701f;
+    if (snapshot->dpi > 0) {
+        snapshot->stickScale = static_cast<float>(0.0254 / 6.1 / snapshot->dpi * config.sensitivity);
+    }
+    if (config.countsPerMeter > 0) {
+        snapshot->realWorldScale = 1.0f / config.countsPerMeter;
+        snapshot->gameSpeedScale = config.sensitivity / config.countsPerMeter;
+    }
+    if (config.deadzone > 0.0f) {
+        snapshot->deadzoneScale = 1.0f / (1.0f - config.deadzone);
+    }
+    snapshot->curve.Compile(config.curve);
+    return snapshot;
 }
 
-void InputProcessor::ProcessDelta(const MouseDelta& delta, float deltaTime, float& outX, float& outY) {
-    // Calculate physical treadmill speed first (before sensitivity)
-    if (m_config.countsPerMeter > 0 && deltaTime > 0) {
-        // Convert counts/sec to m/s using DPI-based calibration
-        // countsPerMeter = DPI * 39.3701 (inches per meter)
-        m_realWorldSpeed = std::abs(delta.y) / m_config.countsPerMeter / deltaTime;
-        // Apply sensitivity multiplier to get game speed
-        m_currentSpeed = m_realWorldSpeed * m_config.sensitivity;
+InputProcessor::InputProcessor()
+    : m_simdLevel(DetectSimdLevel()) {
+    std::lock_guard<std::mutex> lock(m_publishMutex);
+    PublishLocked(ProcessingConfig{});
+}
+
+const ProcessingSnapshot& InputProcessor::AcquireSnapshot() {
+    if (!m_holdingSnapshot) {
+        // Announce the reader before loading the pointer; pairs with the
+        // store-then-check in PublishLocked (both sequentially consistent)
+        m_readerActive.store(true, std::memory_order_seq_cst);
+        m_holdingSnapshot = true;
+    }
+    const ProcessingSnapshot* snapshot = m_snapshot.load(std::memory_order_seq_cst);
+    if (snapshot->version != m_appliedVersion) {
+        // Older snapshots may be freed from here on
+        m_readerVersion.store(snapshot->version, std::memory_order_release);
+        m_appliedVersion = snapshot->version;
+        m_velocityX.Configure(snapshot->config.velocity);
+        m_velocityY.Configure(snapshot->config.velocity);
+        m_predictX.Configure(snapshot->config.prediction);
+        m_predictY.Configure(snapshot->config.prediction);
     }
+    return *snapshot;
+}
+
+void InputProcessor::ProcessDelta(const MouseDelta& delta, float deltaTime, float& outX, float& outY) {
+    const ProcessingSnapshot& snapshot = AcquireSnapshot();
+    const ProcessingConfig& config = snapshot.config;
     
-    // Calculate stick deflection based on physical speed
-    // Formula: deflection = (counts/sec / DPI * 0.0254) / 6.1
-    // With DPI from countsPerMeter: DPI = countsPerMeter / 39.3701
-    float dpi = m_config.countsPerMeter / 39.3701f;
+    float countsPerSecX = 0.0f;
+    float countsPerSecY = 0.0f;
+    float gameSpeed = 0.0f;
+    EstimateVelocity(snapshot, delta, deltaTime, countsPerSecX, countsPerSecY, gameSpeed);
     
     // Calculate stick deflection for X and Y
     float x = 0.0f;
     float y = 0.0f;
     
-    if (deltaTime > 0 && dpi > 0) {
-        // Convert counts/sec to stick deflection
-        float countsPerSecX = delta.x / deltaTime;
-        float countsPerSecY = delta.y / deltaTime;
-        
-        // Apply the formula: deflection = counts/sec / DPI * 0.0254 / 6.1
-        x = countsPerSecX / dpi * 0.0254f / 6.1f;
-        y = countsPerSecY / dpi * 0.0254f / 6.1f;
-        
-        // Apply sensitivity (game-to-real-world speed multiplier)
-        float sensitivityMultiplier = m_config.sensitivity;
-        x *= sensitivityMultiplier;
-        y *= sensitivityMultiplier;
-        
-        // Debug: log if sensitivity is not being applied
-        if (delta.y != 0 && sensitivityMultiplier != 1.0f) {
-            LOG_DEBUG("Processor", "Sensitivity multiplier: " + std::to_string(sensitivityMultiplier));
-        }
+    if (deltaTime > 0 && snapshot.dpi > 0) {
+        // deflection = counts/sec / DPI * 0.0254 / 6.1 * sensitivity, folded
+        // into one factor when the snapshot was published
+        x = countsPerSecX * snapshot.stickScale;
+        y = countsPerSecY * snapshot.stickScale;
     }
     
     // Debug logging for input processing
     if (delta.y != 0) {
-        LOG_DEBUG("Processor", "Input deltaY=" + std::to_string(delta.y) + 
-                  " -> deflection=" + std::to_string(y) + 
-                  " (DPI=" + std::to_string(dpi) + ")");
+        LOG_DEBUG("Processor", "Input deltaY={} -> deflection={:.6f} (DPI={:.6f}, sensitivity={})",
+                  delta.y, y, snapshot.dpi, config.sensitivity);
     }
     
     // For treadmill usage:
@@ -61,53 +85,128 @@ void InputProcessor::ProcessDelta(const MouseDelta& delta, float deltaTime, floa
     // - So positive mouse Y should = positive stick Y (no inversion needed by default)
     
     // Apply user inversion preferences
-    if (m_config.invertX) x = -x;
-    if (m_config.invertY) y = -y;  // Only invert if user explicitly requests it
+    if (config.invertX) x = -x;
+    if (config.invertY) y = -y;  // Only invert if user explicitly requests it
     
     // Apply axis locks
-    if (m_config.lockX) x = 0.0f;
-    if (m_config.lockY) y = 0.0f;
+    if (config.lockX) x = 0.0f;
+    if (config.lockY) y = 0.0f;
+    
+    // Shape the deflection magnitude with the response curve
+    if (!snapshot.curve.IsIdentity()) {
+        float linear = std::sqrt(x * x + y * y);
+        if (linear > 0.0f) {
+            float curveScale = snapshot.curve.Evaluate(linear) / linear;
+            x *= curveScale;
+            y *= curveScale;
+        }
+    }
     
     // Clamp to max speed
     float magnitude = std::sqrt(x * x + y * y);
-    if (magnitude > m_config.maxSpeed && magnitude > 0.0f) {
-        float scale = m_config.maxSpeed / magnitude;
+    if (magnitude > config.maxSpeed && magnitude > 0.0f) {
+        float scale = config.maxSpeed / magnitude;
         x *= scale;
         y *= scale;
     }
     
     // Apply deadzone
-    x = ApplyDeadzone(x);
-    y = ApplyDeadzone(y);
-    
-    // Force X to 0 for treadmill (Y-axis only movement) ONLY if not testing X-axis
-    // The lockX setting above should control this, not a hardcoded override
-    // Removing this line to respect the lockX setting
+    x = ApplyDeadzone(snapshot, x);
+    y = ApplyDeadzone(snapshot, y);
     
     // Store for metrics
-    m_lastStickX = x;
-    m_lastStickY = y;
-    
-    // Handle calibration
-    if (m_calibrating) {
-        m_calibrationDeltas += delta;
-    }
+    m_lastStickX.store(x, std::memory_order_relaxed);
+    m_lastStickY.store(y, std::memory_order_relaxed);
     
     outX = x;
     outY = y;
 }
 
+void InputProcessor::EstimateVelocity(const ProcessingSnapshot& snapshot, const MouseDelta& delta, float deltaTime,
+                                      float& countsPerSecX, float& countsPerSecY, float& gameSpeed) {
+    // Estimate belt velocity in counts/sec from this tick's counts
+    float estimatedY = 0.0f;
+    if (deltaTime > 0) {
+        float measuredX = delta.x / deltaTime;
+        float measuredY = delta.y / deltaTime;
+        countsPerSecX = m_velocityX.Update(measuredX, deltaTime);
+        estimatedY = m_velocityY.Update(measuredY, deltaTime);
+        
+        // Project ahead by the prediction horizon (pass-through when disabled)
+        countsPerSecX = m_predictX.Update(countsPerSecX, measuredX, deltaTime);
+        countsPerSecY = m_predictY.Update(estimatedY, measuredY, deltaTime);
+    }
+    
+    // Calculate physical treadmill speed (before and after sensitivity)
+    if (snapshot.config.countsPerMeter > 0 && deltaTime > 0) {
+        m_realWorldSpeed.store(std::abs(estimatedY) * snapshot.realWorldScale, std::memory_order_relaxed);
+        // Game speed follows the published (predicted) stick value
+        gameSpeed = std::abs(countsPerSecY) * snapshot.gameSpeedScale;
+        m_currentSpeed.store(gameSpeed, std::memory_order_relaxed);
+    } else {
+        gameSpeed = m_currentSpeed.load(std::memory_order_relaxed);
+    }
+    
+    // Handle calibration
+    if (m_calibrating.load(std::memory_order_relaxed)) {
+        m_calibrationCountsX.fetch_add(delta.x, std::memory_order_relaxed);
+        m_calibrationCountsY.fetch_add(delta.y, std::memory_order_relaxed);
+    }
+}
+
 void InputProcessor::SetConfig(const ProcessingConfig& config) {
-    m_config = config;
+    std::lock_guard<std::mutex> lock(m_publishMutex);
+    PublishLocked(config);
+}
+
+void InputProcessor::ModifyConfig(const std::function<void(ProcessingConfig&)>& modify) {
+    std::lock_guard<std::mutex> lock(m_publishMutex);
+    ProcessingConfig config = m_snapshot.load(std::memory_order_relaxed)->config;
+    modify(config);
+    PublishLocked(config);
+}
+
+void InputProcessor::PublishLocked(const ProcessingConfig& config) {
+    uint64_t version = m_snapshots.empty() ? 1 : m_snapshots.back()->version + 1;
+    m_snapshots.push_back(ProcessingSnapshot::Create(config, version));
+    m_snapshot.store(m_snapshots.back().get(), std::memory_order_seq_cst);
+    
+    // The processing thread only moves forward, so anything older than the
+    // version it last acknowledged is unreachable. Without an active reader
+    // its next tick loads the snapshot just stored, so only that one stays.
+    uint64_t oldestInUse = m_readerActive.load(std::memory_order_seq_cst)
+        ? m_readerVersion.load(std::memory_order_acquire)
+        : version;
+    auto firstLive = std::find_if(m_snapshots.begin(), m_snapshots.end() - 1,
+        [oldestInUse](const std::unique_ptr<ProcessingSnapshot>& s) { return s->version >= oldestInUse; });
+    m_snapshots.erase(m_snapshots.begin(), firstLive);
 }
 
 ProcessingConfig InputProcessor::GetConfig() const {
-    return m_config;
+    std::lock_guard<std::mutex> lock(m_publishMutex);
+    return m_snapshot.load(std::memory_order_relaxed)->config;
+}
+
+uint64_t InputProcessor::GetConfigVersion() const {
+    return m_snapshot.load(std::memory_order_acquire)->version;
+}
+
+size_t InputProcessor::GetLiveSnapshotCount() const {
+    std::lock_guard<std::mutex> lock(m_publishMutex);
+    return m_snapshots.size();
+}
+
+void InputProcessor::ReleaseSnapshot() {
+    if (m_holdingSnapshot) {
+        m_readerActive.store(false, std::memory_order_release);
+        m_holdingSnapshot = false;
+    }
 }
 
 void InputProcessor::StartCalibration() {
+    m_calibrationCountsX = 0;
+    m_calibrationCountsY = 0;
     m_calibrating = true;
-    m_calibrationDeltas.reset();
 }
 
 void InputProcessor::EndCalibration(float distanceMeters) {
@@ -116,34 +215,40 @@ void InputProcessor::EndCalibration(float distanceMeters) {
     }
     
     // For treadmill, use only Y-axis (forward/back movement)
-    float totalCounts = std::abs(static_cast<float>(m_calibrationDeltas.y));
+    float totalCounts = std::abs(static_cast<float>(m_calibrationCountsY.load()));
     
     if (totalCounts > 0) {
-        m_config.countsPerMeter = totalCounts / distanceMeters;
+        ModifyConfig([&](ProcessingConfig& config) {
+            config.countsPerMeter = totalCounts / distanceMeters;
+        });
     }
     
     m_calibrating = false;
-    m_calibrationDeltas.reset();
+    m_calibrationCountsX = 0;
+    m_calibrationCountsY = 0;
 }
 
 float InputProcessor::GetStickDeflectionPercent() const {
-    float magnitude = std::sqrt(m_lastStickX * m_lastStickX + m_lastStickY * m_lastStickY);
+    float x = m_lastStickX.load(std::memory_order_relaxed);
+    float y = m_lastStickY.load(std::memory_order_relaxed);
+    float magnitude = std::sqrt(x * x + y * y);
     return std::min(1.0f, magnitude) * 100.0f;
 }
 
-float InputProcessor::ApplyDeadzone(float value) const {
-    if (m_config.deadzone <= 0.0f) {
+float InputProcessor::ApplyDeadzone(const ProcessingSnapshot& snapshot, float value) {
+    float deadzone = snapshot.config.deadzone;
+    if (deadzone <= 0.0f) {
         return value;
     }
     
     float absValue = std::abs(value);
-    if (absValue < m_config.deadzone) {
+    if (absValue < deadzone) {
         return 0.0f;
     }
     
     // Scale the value to maintain full range after deadzone
     float sign = (value < 0) ? -1.0f : 1.0f;
-    return sign * (absValue - m_config.deadzone) / (1.0f - m_config.deadzone);
+    return sign * (absValue - deadzone) * snapshot.deadzoneScale;
 }
 
 } // namespace Mouse2VR
\ No newline at end of file
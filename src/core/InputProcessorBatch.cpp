@@ -0,0 +1,339 @@
+#include "core/InputProcessor.h"
+#include <algorithm>
+#include <cmath>
+
+// Stick mapping kernels for InputProcessor::ProcessBatch.
+//
+// The velocity filters carry state from tick to tick, so they run first as
+// a scalar pass. The stateless part (scale, invert, lock, response curve,
+// clamp, deadzone) then runs over the whole batch. Every kernel performs the same IEEE
+// operations in the same order as ProcessDelta (no FMA, no reciprocal
+// approximations), which is what keeps the results bit-identical. This file
+// and InputProcessor.cpp are built with floating-point contraction off.
+
+#if MOUSE2VR_ENABLE_SIMD && (defined(__x86_64__) || defined(_M_X64))
+#define MOUSE2VR_SIMD_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#else
+#define MOUSE2VR_SIMD_X86 0
+#endif
+
+#if MOUSE2VR_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+#define MOUSE2VR_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define MOUSE2VR_TARGET_AVX2
+#endif
+
+namespace Mouse2VR {
+
+namespace {
+
+struct StickParams {
+    float dpi;
+    float stickScale;
+    float maxSpeed;
+    float deadzone;
+    float deadzoneScale;
+    bool invertX;
+    bool invertY;
+    bool lockX;
+    bool lockY;
+    const ResponseCurve* curve;  // nullptr for the linear mapping
+};
+
+float DeadzoneScalar(float value, float deadzone, float deadzoneScale) {
+    if (deadzone <= 0.0f) {
+        return value;
+    }
+    float absValue = std::abs(value);
+    if (absValue < deadzone) {
+        return 0.0f;
+    }
+    float sign = (value < 0) ? -1.0f : 1.0f;
+    return sign * (absValue - deadzone) * deadzoneScale;
+}
+
+// x/y hold counts/s on entry and stick deflection on return
+void MapScalar(const float* deltaTimes, float* xs, float* ys, size_t begin, size_t end,
+               const StickParams& p) {
+    for (size_t i = begin; i < end; ++i) {
+        float x = 0.0f;
+        float y = 0.0f;
+        if (deltaTimes[i] > 0 && p.dpi > 0) {
+            x = xs[i] * p.stickScale;
+            y = ys[i] * p.stickScale;
+        }
+        if (p.invertX) x = -x;
+        if (p.invertY) y = -y;
+        if (p.lockX) x = 0.0f;
+        if (p.lockY) y = 0.0f;
+
+        if (p.curve) {
+            float linear = std::sqrt(x * x + y * y);
+            if (linear > 0.0f) {
+                float curveScale = p.curve->Evaluate(linear) / linear;
+                x *= curveScale;
+                y *= curveScale;
+            }
+        }
+
+        float magnitude = std::sqrt(x * x + y * y);
+        if (magnitude > p.maxSpeed && magnitude > 0.0f) {
+            float scale = p.maxSpeed / magnitude;
+            x *= scale;
+            y *= scale;
+        }
+        xs[i] = DeadzoneScalar(x, p.deadzone, p.deadzoneScale);
+        ys[i] = DeadzoneScalar(y, p.deadzone, p.deadzoneScale);
+    }
+}
+
+#if MOUSE2VR_SIMD_X86
+
+// Lanes are selected with and/andnot/or so SSE2 is enough
+inline __m128 Select128(__m128 mask, __m128 ifTrue, __m128 ifFalse) {
+    return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+}
+
+// ResponseCurve::Evaluate for four lanes; the table reads are scalar
+inline __m128 CurveLookup128(__m128 input, const ResponseCurve& curve) {
+    const float* table = curve.GetTable();
+    const __m128 tableSize = _mm_set1_ps(static_cast<float>(ResponseCurve::kTableSize));
+    const __m128 lastSegment = _mm_set1_ps(static_cast<float>(ResponseCurve::kTableSize - 1));
+    __m128 t = _mm_mul_ps(input, _mm_set1_ps(curve.GetIndexScale()));
+    __m128 inRange = _mm_cmplt_ps(t, tableSize);
+    __m128i index = _mm_cvttps_epi32(_mm_min_ps(t, lastSegment));
+    __m128 frac = _mm_sub_ps(t, _mm_cvtepi32_ps(index));
+
+    alignas(16) int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes), index);
+    __m128 a = _mm_setr_ps(table[lanes[0]], table[lanes[1]], table[lanes[2]], table[lanes[3]]);
+    __m128 b = _mm_setr_ps(table[lanes[0] + 1], table[lanes[1] + 1], table[lanes[2] + 1], table[lanes[3] + 1]);
+    __m128 value = _mm_add_ps(a, _mm_mul_ps(_mm_sub_ps(b, a), frac));
+    return Select128(inRange, value, _mm_set1_ps(table[ResponseCurve::kTableSize]));
+}
+
+size_t MapSse2(const float* deltaTimes, float* xs, float* ys, size_t count, const StickParams& p) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 stickScale = _mm_set1_ps(p.stickScale);
+    const __m128 maxSpeed = _mm_set1_ps(p.maxSpeed);
+    const __m128 deadzone = _mm_set1_ps(p.deadzone);
+    const __m128 deadzoneScale = _mm_set1_ps(p.deadzoneScale);
+    const __m128 minusOne = _mm_set1_ps(-1.0f);
+    const __m128 plusOne = _mm_set1_ps(1.0f);
+    const bool applyDeadzone = !(p.deadzone <= 0.0f);
+
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 valid = _mm_cmpgt_ps(_mm_loadu_ps(deltaTimes + i), zero);
+        __m128 x = _mm_mul_ps(_mm_loadu_ps(xs + i), stickScale);
+        __m128 y = _mm_mul_ps(_mm_loadu_ps(ys + i), stickScale);
+        x = _mm_and_ps(valid, x);
+        y = _mm_and_ps(valid, y);
+        if (p.invertX) x = _mm_xor_ps(x, signBit);
+        if (p.invertY) y = _mm_xor_ps(y, signBit);
+        if (p.lockX) x = zero;
+        if (p.lockY) y = zero;
+
+        if (p.curve) {
+            __m128 linear = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+            __m128 curveScale = _mm_div_ps(CurveLookup128(linear, *p.curve), linear);
+            __m128 shaped = _mm_cmpgt_ps(linear, zero);
+            x = Select128(shaped, _mm_mul_ps(x, curveScale), x);
+            y = Select128(shaped, _mm_mul_ps(y, curveScale), y);
+        }
+
+        __m128 magnitude = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)));
+        __m128 clamp = _mm_and_ps(_mm_cmpgt_ps(magnitude, maxSpeed), _mm_cmpgt_ps(magnitude, zero));
+        __m128 scale = _mm_div_ps(maxSpeed, magnitude);
+        x = Select128(clamp, _mm_mul_ps(x, scale), x);
+        y = Select128(clamp, _mm_mul_ps(y, scale), y);
+
+        if (applyDeadzone) {
+            __m128 absX = _mm_andnot_ps(signBit, x);
+            __m128 absY = _mm_andnot_ps(signBit, y);
+            __m128 signX = Select128(_mm_cmplt_ps(x, zero), minusOne, plusOne);
+            __m128 signY = Select128(_mm_cmplt_ps(y, zero), minusOne, plusOne);
+            __m128 outX = _mm_mul_ps(_mm_mul_ps(signX, _mm_sub_ps(absX, deadzone)), deadzoneScale);
+            __m128 outY = _mm_mul_ps(_mm_mul_ps(signY, _mm_sub_ps(absY, deadzone)), deadzoneScale);
+            x = _mm_andnot_ps(_mm_cmplt_ps(absX, deadzone), outX);
+            y = _mm_andnot_ps(_mm_cmplt_ps(absY, deadzone), outY);
+        }
+
+        _mm_storeu_ps(xs + i, x);
+        _mm_storeu_ps(ys + i, y);
+    }
+    return i;
+}
+
+// ResponseCurve::Evaluate for eight lanes using hardware gathers
+MOUSE2VR_TARGET_AVX2
+inline __m256 CurveLookup256(__m256 input, const ResponseCurve& curve) {
+    const float* table = curve.GetTable();
+    const __m256 tableSize = _mm256_set1_ps(static_cast<float>(ResponseCurve::kTableSize));
+    const __m256 lastSegment = _mm256_set1_ps(static_cast<float>(ResponseCurve::kTableSize - 1));
+    __m256 t = _mm256_mul_ps(input, _mm256_set1_ps(curve.GetIndexScale()));
+    __m256 inRange = _mm256_cmp_ps(t, tableSize, _CMP_LT_OQ);
+    __m256i index = _mm256_cvttps_epi32(_mm256_min_ps(t, lastSegment));
+    __m256 frac = _mm256_sub_ps(t, _mm256_cvtepi32_ps(index));
+
+    __m256 a = _mm256_i32gather_ps(table, index, 4);
+    __m256 b = _mm256_i32gather_ps(table + 1, index, 4);
+    __m256 value = _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), frac));
+    return _mm256_blendv_ps(_mm256_set1_ps(table[ResponseCurve::kTableSize]), value, inRange);
+}
+
+MOUSE2VR_TARGET_AVX2
+size_t MapAvx2(const float* deltaTimes, float* xs, float* ys, size_t count, const StickParams& p) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256 stickScale = _mm256_set1_ps(p.stickScale);
+    const __m256 maxSpeed = _mm256_set1_ps(p.maxSpeed);
+    const __m256 deadzone = _mm256_set1_ps(p.deadzone);
+    const __m256 deadzoneScale = _mm256_set1_ps(p.deadzoneScale);
+    const __m256 minusOne = _mm256_set1_ps(-1.0f);
+    const __m256 plusOne = _mm256_set1_ps(1.0f);
+    const bool applyDeadzone = !(p.deadzone <= 0.0f);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 valid = _mm256_cmp_ps(_mm256_loadu_ps(deltaTimes + i), zero, _CMP_GT_OQ);
+        __m256 x = _mm256_mul_ps(_mm256_loadu_ps(xs + i), stickScale);
+        __m256 y = _mm256_mul_ps(_mm256_loadu_ps(ys + i), stickScale);
+        x = _mm256_and_ps(valid, x);
+        y = _mm256_and_ps(valid, y);
+        if (p.invertX) x = _mm256_xor_ps(x, signBit);
+        if (p.invertY) y = _mm256_xor_ps(y, signBit);
+        if (p.lockX) x = zero;
+        if (p.lockY) y = zero;
+
+        if (p.curve) {
+            __m256 linear = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)));
+            __m256 curveScale = _mm256_div_ps(CurveLookup256(linear, *p.curve), linear);
+            __m256 shaped = _mm256_cmp_ps(linear, zero, _CMP_GT_OQ);
+            x = _mm256_blendv_ps(x, _mm256_mul_ps(x, curveScale), shaped);
+            y = _mm256_blendv_ps(y, _mm256_mul_ps(y, curveScale), shaped);
+        }
+
+        __m256 magnitude = _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)));
+        __m256 clamp = _mm256_and_ps(_mm256_cmp_ps(magnitude, maxSpeed, _CMP_GT_OQ),
+                                     _mm256_cmp_ps(magnitude, zero, _CMP_GT_OQ));
+        __m256 scale = _mm256_div_ps(maxSpeed, magnitude);
+        x = _mm256_blendv_ps(x, _mm256_mul_ps(x, scale), clamp);
+        y = _mm256_blendv_ps(y, _mm256_mul_ps(y, scale), clamp);
+
+        if (applyDeadzone) {
+            __m256 absX = _mm256_andnot_ps(signBit, x);
+            __m256 absY = _mm256_andnot_ps(signBit, y);
+            __m256 signX = _mm256_blendv_ps(plusOne, minusOne, _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+            __m256 signY = _mm256_blendv_ps(plusOne, minusOne, _mm256_cmp_ps(y, zero, _CMP_LT_OQ));
+            __m256 outX = _mm256_mul_ps(_mm256_mul_ps(signX, _mm256_sub_ps(absX, deadzone)), deadzoneScale);
+            __m256 outY = _mm256_mul_ps(_mm256_mul_ps(signY, _mm256_sub_ps(absY, deadzone)), deadzoneScale);
+            x = _mm256_andnot_ps(_mm256_cmp_ps(absX, deadzone, _CMP_LT_OQ), outX);
+            y = _mm256_andnot_ps(_mm256_cmp_ps(absY, deadzone, _CMP_LT_OQ), outY);
+        }
+
+        _mm256_storeu_ps(xs + i, x);
+        _mm256_storeu_ps(ys + i, y);
+    }
+    return i;
+}
+
+bool CpuHasAvx2() {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#else
+    int info[4] = {};
+    __cpuid(info, 0);
+    if (info[0] < 7) {
+        return false;
+    }
+    __cpuid(info, 1);
+    const bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    __cpuidex(info, 7, 0);
+    return osSavesYmm && (info[1] & (1 << 5)) != 0;
+#endif
+}
+
+#endif // MOUSE2VR_SIMD_X86
+
+} // namespace
+
+const char* SimdLevelToString(SimdLevel level) {
+    switch (level) {
+        case SimdLevel::Sse2: return "sse2";
+        case SimdLevel::Avx2: return "avx2";
+        case SimdLevel::Scalar:
+        default: return "scalar";
+    }
+}
+
+SimdLevel DetectSimdLevel() {
+#if MOUSE2VR_SIMD_X86
+    static const SimdLevel level = CpuHasAvx2() ? SimdLevel::Avx2 : SimdLevel::Sse2;
+    return level;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+void InputProcessor::SetSimdLevel(SimdLevel level) {
+    m_simdLevel = std::min(level, DetectSimdLevel());
+}
+
+void InputProcessor::ProcessBatch(std::span<const MouseDelta> deltas, std::span<const float> deltaTimes,
+                                  std::span<float> outX, std::span<float> outY, std::span<float> outSpeed) {
+    const size_t count = std::min({deltas.size(), deltaTimes.size(), outX.size(), outY.size(), outSpeed.size()});
+    if (count == 0) {
+        return;
+    }
+
+    const ProcessingSnapshot& snapshot = AcquireSnapshot();
+    const ProcessingConfig& config = snapshot.config;
+
+    // === Stateful pass: filters, prediction, speed, calibration ===
+    for (size_t i = 0; i < count; ++i) {
+        float countsPerSecX = 0.0f;
+        float countsPerSecY = 0.0f;
+        EstimateVelocity(snapshot, deltas[i], deltaTimes[i], countsPerSecX, countsPerSecY, outSpeed[i]);
+        outX[i] = countsPerSecX;
+        outY[i] = countsPerSecY;
+    }
+
+    // === Stateless pass: counts/s -> stick deflection ===
+    const StickParams params{
+        snapshot.dpi,
+        snapshot.stickScale,
+        config.maxSpeed,
+        config.deadzone,
+        snapshot.deadzoneScale,
+        config.invertX,
+        config.invertY,
+        config.lockX,
+        config.lockY,
+        snapshot.curve.IsIdentity() ? nullptr : &snapshot.curve
+    };
+
+    size_t done = 0;
+#if MOUSE2VR_SIMD_X86
+    // A non-positive DPI zeroes everything; leave that to the scalar path
+    if (params.dpi > 0) {
+        if (m_simdLevel == SimdLevel::Avx2) {
+            done = MapAvx2(deltaTimes.data(), outX.data(), outY.data(), count, params);
+        } else if (m_simdLevel == SimdLevel::Sse2) {
+            done = MapSse2(deltaTimes.data(), outX.data(), outY.data(), count, params);
+        }
+    }
+#endif
+    MapScalar(deltaTimes.data(), outX.data(), outY.data(), done, count, params);
+
+    m_lastStickX.store(outX[count - 1], std::memory_order_relaxed);
+    m_lastStickY.store(outY[count - 1], std::memory_order_relaxed);
+}
+
+} // namespace Mouse2VR
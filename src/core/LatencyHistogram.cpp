@@ -0,0 +1,118 @@
+#include "common/LatencyHistogram.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Mouse2VR {
+
+namespace {
+
+int HighestBit(uint64_t value) {
+    int bit = 0;
+    while (value >>= 1) {
+        ++bit;
+    }
+    return bit;
+}
+
+} // namespace
+
+LatencyHistogram::LatencyHistogram() {
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+size_t LatencyHistogram::BucketIndex(int64_t valueNs) {
+    uint64_t value = static_cast<uint64_t>(std::clamp<int64_t>(valueNs, 0, kMaxTrackableNs));
+    if (value < static_cast<uint64_t>(kSubBucketCount)) {
+        return static_cast<size_t>(value);
+    }
+    // Keep the top kSubBucketBits+1 bits: [64, 128) within this power of two
+    int magnitude = HighestBit(value);
+    uint64_t top = value >> (magnitude - kSubBucketBits);
+    return static_cast<size_t>(magnitude - kSubBucketBits + 1) * kSubBucketCount +
+           static_cast<size_t>(top - kSubBucketCount);
+}
+
+int64_t LatencyHistogram::BucketUpperBound(size_t index) {
+    if (index < static_cast<size_t>(kSubBucketCount)) {
+        return static_cast<int64_t>(index);
+    }
+    int magnitude = static_cast<int>(index / kSubBucketCount) + kSubBucketBits - 1;
+    int64_t top = static_cast<int64_t>(index % kSubBucketCount) + kSubBucketCount;
+    int shift = magnitude - kSubBucketBits;
+    return ((top + 1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(int64_t valueNs) {
+    if (valueNs < 0) {
+        valueNs = 0;
+    }
+    m_buckets[BucketIndex(valueNs)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    m_sumNs.fetch_add(valueNs, std::memory_order_relaxed);
+    
+    // Single writer: no CAS loop needed
+    if (valueNs < m_minNs.load(std::memory_order_relaxed)) {
+        m_minNs.store(valueNs, std::memory_order_relaxed);
+    }
+    if (valueNs > m_maxNs.load(std::memory_order_relaxed)) {
+        m_maxNs.store(valueNs, std::memory_order_relaxed);
+    }
+}
+
+void LatencyHistogram::Reset() {
+    for (auto& bucket : m_buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_sumNs.store(0, std::memory_order_relaxed);
+    m_minNs.store(INT64_MAX, std::memory_order_relaxed);
+    m_maxNs.store(0, std::memory_order_relaxed);
+}
+
+int64_t LatencyHistogram::GetPercentile(double percentile) const {
+    // Sum the buckets rather than trusting m_count, which may be a step
+    // ahead of them while a Record() is in flight
+    uint64_t total = 0;
+    for (const auto& bucket : m_buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+    
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    uint64_t target = static_cast<uint64_t>(std::ceil(percentile / 100.0 * static_cast<double>(total)));
+    target = std::max<uint64_t>(target, 1);
+    
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        seen += m_buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            // Never report beyond the exact maximum
+            return std::min(BucketUpperBound(i), m_maxNs.load(std::memory_order_relaxed));
+        }
+    }
+    return m_maxNs.load(std::memory_order_relaxed);
+}
+
+LatencyStats LatencyHistogram::GetStats() const {
+    LatencyStats stats;
+    stats.count = m_count.load(std::memory_order_relaxed);
+    if (stats.count == 0) {
+        return stats;
+    }
+    
+    stats.meanNs = static_cast<double>(m_sumNs.load(std::memory_order_relaxed)) /
+                   static_cast<double>(stats.count);
+    stats.minNs = m_minNs.load(std::memory_order_relaxed);
+    stats.maxNs = m_maxNs.load(std::memory_order_relaxed);
+    stats.p50Ns = GetPercentile(50.0);
+    stats.p90Ns = GetPercentile(90.0);
+    stats.p99Ns = GetPercentile(99.0);
+    stats.p999Ns = GetPercentile(99.9);
+    return stats;
+}
+
+} // namespace Mouse2VR
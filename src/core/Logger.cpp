@@ -1,5 +1,7 @@
 #include "common/Logger.h"
 #include "core/PathUtils.h"
+#include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <iostream>
 
@@ -74,20 +76,33 @@ void Logger::SetSettingsProvider(std::function<std::string()> provider) {
 }
 
 void Logger::Log(Level level, const std::string& component, const std::string& message) {
+    if (!IsEnabled(component, level)) {
+        return;
+    }
+    Emit(level, component, message);
+}
+
+void Logger::Write(Level level, const LogComponent& component, std::string_view message) {
+    Emit(level, component.GetName(), message);
+}
+
+void Logger::Emit(Level level, std::string_view component, std::string_view message) {
     if (!m_logger) {
         std::cerr << "[" << component << "] " << message << std::endl;
         return;
     }
     
     // Rate limit "running behind" messages
-    if (level == DEBUG && message.find("running behind") != std::string::npos) {
-        if (!ShouldRateLimit(level, message)) {
+    if (level == DEBUG && message.find("running behind") != std::string_view::npos) {
+        if (!ShouldRateLimit(level, std::string(message))) {
             return;
         }
     }
     
     // Format message with component
-    std::string formatted = component + "] " + message;
+    std::string formatted;
+    formatted.reserve(component.size() + message.size() + 2);
+    formatted.append(component).append("] ").append(message);
     
     // Append current settings if provider is set
     if (m_settingsProvider) {
@@ -117,6 +132,60 @@ void Logger::Log(Level level, const std::string& component, const std::string& m
     }
 }
 
+LogComponent& Logger::GetComponent(std::string_view name) {
+    std::lock_guard<std::mutex> lock(m_componentMutex);
+    for (size_t i = 0; i < m_componentCount; ++i) {
+        if (name == m_components[i].m_name) {
+            return m_components[i];
+        }
+    }
+    
+    // Registry full: share the last slot rather than fail
+    if (m_componentCount == kMaxComponents) {
+        return m_components[kMaxComponents - 1];
+    }
+    
+    LogComponent& component = m_components[m_componentCount++];
+    size_t length = std::min(name.size(), sizeof(component.m_name) - 1);
+    std::memcpy(component.m_name, name.data(), length);
+    component.m_name[length] = '\0';
+    component.SetMask(m_defaultMask.load(std::memory_order_relaxed));
+    return component;
+}
+
+void Logger::SetComponentLevel(std::string_view name, Level minLevel) {
+    GetComponent(name).SetMask(MaskFromLevel(minLevel));
+}
+
+void Logger::SetComponentMask(std::string_view name, uint32_t mask) {
+    GetComponent(name).SetMask(mask);
+}
+
+void Logger::SetAllComponentsLevel(Level minLevel) {
+    std::lock_guard<std::mutex> lock(m_componentMutex);
+    m_defaultMask = MaskFromLevel(minLevel);
+    for (size_t i = 0; i < m_componentCount; ++i) {
+        m_components[i].SetMask(MaskFromLevel(minLevel));
+    }
+}
+
+bool Logger::IsEnabled(std::string_view name, Level level) {
+    if (level < MOUSE2VR_MIN_LOG_LEVEL) {
+        return false;
+    }
+    return GetComponent(name).IsEnabled(level);
+}
+
+std::vector<std::pair<std::string, uint32_t>> Logger::GetComponentMasks() const {
+    std::lock_guard<std::mutex> lock(m_componentMutex);
+    std::vector<std::pair<std::string, uint32_t>> result;
+    result.reserve(m_componentCount);
+    for (size_t i = 0; i < m_componentCount; ++i) {
+        result.emplace_back(m_components[i].m_name, m_components[i].GetMask());
+    }
+    return result;
+}
+
 void Logger::LogWithData(Level level, const std::string& component, const std::string& message,
                          const std::string& key1, const std::string& value1) {
     std::string fullMsg = message + " | " + key1 + "=" + value1;
@@ -175,7 +244,7 @@ ScopedTimer::ScopedTimer(const std::string& name) : m_name(name) {
 ScopedTimer::~ScopedTimer() {
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::microseconds>(end - m_start);
-    LOG_DEBUG("Performance", m_name + " took " + std::to_string(duration.count()) + " us");
+    LOG_DEBUG("Performance", "{} took {} us", m_name, duration.count());
 }
 
 } // namespace Mouse2VR
\ No newline at end of file
@@ -6,28 +6,42 @@
 #include <algorithm>
 
 #include "core/Mouse2VRCore.h"
+#include "common/Clock.h"
 #include "common/Logger.h"
 
 // Include complete type definitions for std::unique_ptr destructors
 #include "core/ConfigManager.h"
 #include "core/PathUtils.h"
+#include "core/IInputSource.h"
+#include "core/IControllerSink.h"
+#include "core/FrameClock.h"
+#include "core/InputProcessor.h"
+#include "core/OutputFanout.h"
+#include "core/OutputThrottle.h"
+#include "core/SessionRecorder.h"
+#include "core/SharedStatePublisher.h"
+
+#ifdef _WIN32
 #include "core/RawInputHandler.h"
 #include "core/ViGEmController.h"
-#include "core/InputProcessor.h"
 
 // Windows multimedia for timeBeginPeriod
 #include <mmsystem.h>
 #pragma comment(lib, "winmm.lib")
+#endif
 
 #include <thread>
 #include <chrono>
+#include <iterator>
 
 namespace Mouse2VR {
 
 Mouse2VRCore::Mouse2VRCore() 
-    : m_isRunning(false)
+    : m_recorder(std::make_unique<SessionRecorder>())
+    , m_isRunning(false)
     , m_isInitialized(false)
-    , m_lastUpdate(std::chrono::steady_clock::now()) {
+    , m_clock(std::make_shared<SystemClock>())
+    , m_lastUpdateNs(m_clock->NowNs()) {
 }
 
 Mouse2VRCore::~Mouse2VRCore() {
@@ -35,43 +49,86 @@ Mouse2VRCore::~Mouse2VRCore() {
 }
 
 bool Mouse2VRCore::Initialize() {
+#ifdef _WIN32
     // Default initialization without window handle
-    return Initialize(nullptr);
+    return Initialize(static_cast<HWND>(nullptr));
+#else
+    LOG_ERROR("Core", "No default input source on this platform; pass one to Initialize()");
+    return false;
+#endif
 }
 
+#ifdef _WIN32
 bool Mouse2VRCore::Initialize(HWND hwnd) {
     if (m_isInitialized) {
         return true;
     }
     
+    auto rawInput = std::make_unique<RawInputHandler>();
+    
+    // Initialize RawInputHandler with window handle if provided
+    if (hwnd) {
+        if (!rawInput->Initialize(hwnd)) {
+            LOG_ERROR("Core", "Failed to initialize RawInputHandler");
+            return false;
+        }
+        LOG_INFO("Core", "RawInputHandler initialized with window handle");
+    }
+    
+    RawInputHandler* rawInputView = rawInput.get();
+    if (!Initialize(std::move(rawInput))) {
+        return false;
+    }
+    m_rawInputHandler = rawInputView;
+    return true;
+}
+#endif
+
+bool Mouse2VRCore::Initialize(std::unique_ptr<IInputSource> inputSource) {
+#ifdef _WIN32
+    return Initialize(std::move(inputSource), std::make_unique<ViGEmController>());
+#else
+    (void)inputSource;
+    LOG_ERROR("Core", "No default controller sink on this platform; pass one to Initialize()");
+    return false;
+#endif
+}
+
+bool Mouse2VRCore::Initialize(std::unique_ptr<IInputSource> inputSource,
+                              std::unique_ptr<IControllerSink> controller) {
+    if (m_isInitialized) {
+        return true;
+    }
+    
+    if (!inputSource || !controller) {
+        LOG_ERROR("Core", "No input source or controller sink provided");
+        return false;
+    }
+    
+#ifdef _WIN32
     // Enable high-resolution timers (1ms resolution)
     timeBeginPeriod(1);
+#endif
     
     LOG_INFO("Core", "Initializing Mouse2VR Core...");
     
     // Initialize actual components
-    m_inputHandler = std::make_unique<RawInputHandler>();
-    m_controller = std::make_unique<ViGEmController>();
+    m_inputSource = std::move(inputSource);
+    m_inputSource->SetWakeEvent(&m_inputEvent);
+    m_rawInputHandler = nullptr;
+    m_controller = std::move(controller);
     m_processor = std::make_unique<InputProcessor>();
     // Use exe-relative path for config
     std::string configPath = PathUtils::GetExecutablePath("config.json");
     m_config = std::make_unique<ConfigManager>(configPath);
+    LOG_INFO("Core", "Input source: {}", m_inputSource->GetName());
     
-    // Initialize RawInputHandler with window handle if provided
-    if (hwnd) {
-        if (!m_inputHandler->Initialize(hwnd)) {
-            LOG_ERROR("Core", "Failed to initialize RawInputHandler");
-            return false;
-        }
-        LOG_INFO("Core", "RawInputHandler initialized with window handle");
-    }
-    
-    // Initialize ViGEmController
+    // Initialize the controller sink
     if (!m_controller->Initialize()) {
-        LOG_ERROR("Core", "Failed to initialize ViGEmController");
+        LOG_ERROR("Core", "Failed to initialize controller sink: {}", m_controller->GetName());
         return false;
     }
-    LOG_INFO("Core", "Virtual Xbox 360 controller created");
+    LOG_INFO("Core", "Controller sink connected: {}", m_controller->GetName());
     
     // Load configuration and apply to processor
     if (m_config->Load()) {
@@ -87,12 +144,30 @@ bool Mouse2VRCore::Initialize(HWND hwnd) {
     procConfig.invertY = config.invertY;
     procConfig.lockX = config.lockX;
     procConfig.countsPerMeter = config.countsPerMeter;
+    procConfig.velocity = config.velocity;
+    procConfig.prediction = config.prediction;
+    procConfig.curve = config.curve;
     m_processor->SetConfig(procConfig);
     
     // Set update rate from config
     if (config.updateIntervalMs > 0) {
         m_updateRateHz = 1000 / config.updateIntervalMs;
     }
+    m_eventDriven = config.eventDriven;
+    m_coalesceWindowUs = config.coalesceWindowUs;
+    m_maxOutputRateHz = config.maxOutputRateHz;
+    m_adaptiveMode = config.adaptiveMode;
+    m_idleUpdateIntervalMs = config.idleUpdateIntervalMs;
+    m_idleTimeoutMs = config.idleTimeoutMs;
+    m_timerStrategy = config.timerStrategy;
+    SetFrameLead(config.frameClock.leadUs);
+    SetThreadPolicy(config.processingThread, config.inputThread, config.lockMemory);
+    if (config.frameClock.source == FrameClockSource::Udp && !m_frameClock) {
+        m_frameClock = std::make_unique<UdpFrameClock>(static_cast<uint16_t>(config.frameClock.port));
+    }
+    if (config.stateChannel.enabled && !m_statePublisher) {
+        m_statePublisher = std::make_unique<SharedStatePublisher>(config.stateChannel.name);
+    }
     
     // Register settings provider with logger
     Logger::Instance().SetSettingsProvider([this]() {
@@ -110,10 +185,34 @@ void Mouse2VRCore::Start() {
     }
     
     LOG_INFO("Core", "Starting Mouse2VR Core...");
+    
+    {
+        std::lock_guard<std::mutex> lock(m_threadPolicyMutex);
+        if (m_lockMemory && !m_memoryLocked) {
+            m_memoryLocked = LockProcessMemory();
+            if (!m_memoryLocked) {
+                LOG_WARNING("Core", "Could not lock process memory");
+            }
+        }
+        if (m_inputSource) {
+            m_inputSource->SetThreadPolicy(m_inputPolicy);
+        }
+    }
+    
+    if (m_inputSource && !m_inputSource->Start()) {
+        LOG_ERROR("Core", std::string("Failed to start input source: ") + m_inputSource->GetName());
+        return;
+    }
+    
+    if (m_outputs) {
+        m_outputs->Start();
+    }
+    
     m_isRunning = true;
+    m_clock->SetInterrupted(false);
     
     // Initialize rate tracking
-    m_rateTrackingStart = std::chrono::steady_clock::now();
+    m_rateTrackingStartNs = m_clock->NowNs();
     m_updateCount = 0;
     m_actualUpdateRate = 0;  // Reset the rate from any previous runs
     
@@ -131,16 +230,36 @@ void Mouse2VRCore::Stop() {
     
     LOG_INFO("Core", "Stopping Mouse2VR Core...");
     m_isRunning = false;
+    m_inputEvent.Signal();  // Wake the event-driven loop so it sees the flag
+    m_clock->SetInterrupted(true);  // And release any wait on a simulated clock
     
     // Wait for processing thread to finish
     if (m_processingThread && m_processingThread->joinable()) {
         m_processingThread->join();
         m_processingThread.reset();
     }
+    
+    if (m_inputSource) {
+        m_inputSource->Stop();
+    }
+    
+    // Last state, marked stopped so readers know it is no longer live
+    ControllerState state;
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        state = m_currentState;
+    }
+    PublishState(state, false);
+    
+    if (m_outputs) {
+        m_outputs->Stop();
+    }
 }
 
 void Mouse2VRCore::Shutdown() {
     Stop();
+    StopRecording();
+    FlushConfig();  // Settings changed just before exit still reach the disk
     m_isInitialized = false;
     
     // Ensure thread is cleaned up
@@ -149,8 +268,10 @@ void Mouse2VRCore::Shutdown() {
         m_processingThread.reset();
     }
     
+#ifdef _WIN32
     // Restore default timer resolution
     timeEndPeriod(1);
+#endif
     
     LOG_INFO("Core", "Mouse2VR Core shut down");
 }
@@ -164,15 +285,15 @@ ControllerState Mouse2VRCore::GetCurrentState() const {
 void Mouse2VRCore::SetSensitivity(double sensitivity) {
     LOG_INFO("Core", "Setting sensitivity to: " + std::to_string(sensitivity));
     if (m_processor) {
-        ProcessingConfig config = m_processor->GetConfig();
-        config.sensitivity = static_cast<float>(sensitivity);
-        m_processor->SetConfig(config);
+        m_processor->ModifyConfig([&](ProcessingConfig& config) {
+            config.sensitivity = static_cast<float>(sensitivity);
+        });
     }
     if (m_config) {
         auto cfg = m_config->GetConfig();
         cfg.sensitivity = static_cast<float>(sensitivity);
         m_config->SetConfig(cfg);
-        m_config->Save();
+        m_config->RequestSave();
     }
 }
 
@@ -191,12 +312,62 @@ void Mouse2VRCore::SetUpdateRate(int hz) {
     m_updateRateHz = hz;
     LOG_INFO("Core", "Update rate set to: " + std::to_string(m_updateRateHz.load()) + " Hz (interval: " + std::to_string(1000/hz) + " ms)");
     
-    // Also save to config
+    // Also save to config (in the background)
     if (m_config) {
         auto cfg = m_config->GetConfig();
         cfg.updateIntervalMs = 1000 / hz;  // Convert Hz to milliseconds
         m_config->SetConfig(cfg);
-        m_config->Save();
+        m_config->RequestSave();
+    }
+}
+
+void Mouse2VRCore::SetEventDriven(bool enabled) {
+    LOG_INFO("Core", "Setting event-driven mode to: {}", enabled);
+    m_eventDriven = enabled;
+    m_inputEvent.Signal();  // Let the processing loop switch schedulers now
+    
+    if (m_config) {
+        auto cfg = m_config->GetConfig();
+        cfg.eventDriven = enabled;
+        m_config->SetConfig(cfg);
+        m_config->RequestSave();
+    }
+}
+
+void Mouse2VRCore::SetCoalescing(int coalesceWindowUs, int maxOutputRateHz) {
+    coalesceWindowUs = std::clamp(coalesceWindowUs, 0, 100000);
+    maxOutputRateHz = std::clamp(maxOutputRateHz, 10, 8000);
+    LOG_INFO("Core", "Coalescing window {} us, max output rate {} Hz", coalesceWindowUs, maxOutputRateHz);
+    m_coalesceWindowUs = coalesceWindowUs;
+    m_maxOutputRateHz = maxOutputRateHz;
+    
+    if (m_config) {
+        auto cfg = m_config->GetConfig();
+        cfg.coalesceWindowUs = coalesceWindowUs;
+        cfg.maxOutputRateHz = maxOutputRateHz;
+        m_config->SetConfig(cfg);
+        m_config->RequestSave();
+    }
+}
+
+void Mouse2VRCore::SetAdaptiveMode(bool enabled, int idleUpdateIntervalMs, int idleTimeoutMs) {
+    idleUpdateIntervalMs = std::clamp(idleUpdateIntervalMs, 0, 1000);
+    idleTimeoutMs = std::clamp(idleTimeoutMs, 0, 60000);
+    LOG_INFO("Core", "Adaptive mode {}: idle interval {} ms{}, idle after {} ms",
+             enabled ? "on" : "off", idleUpdateIntervalMs,
+             idleUpdateIntervalMs == 0 ? " (park)" : "", idleTimeoutMs);
+    m_adaptiveMode = enabled;
+    m_idleUpdateIntervalMs = idleUpdateIntervalMs;
+    m_idleTimeoutMs = idleTimeoutMs;
+    m_inputEvent.Signal();  // A parked loop re-evaluates the new settings
+    
+    if (m_config) {
+        auto cfg = m_config->GetConfig();
+        cfg.adaptiveMode = enabled;
+        cfg.idleUpdateIntervalMs = idleUpdateIntervalMs;
+        cfg.idleTimeoutMs = idleTimeoutMs;
+        m_config->SetConfig(cfg);
+        m_config->RequestSave();
     }
 }
 
@@ -207,48 +378,112 @@ int Mouse2VRCore::GetUpdateRate() const {
 void Mouse2VRCore::SetInvertY(bool invert) {
     LOG_INFO("Core", "Setting invert Y to: " + std::string(invert ? "true" : "false"));
     if (m_processor) {
-        ProcessingConfig config = m_processor->GetConfig();
-        config.invertY = invert;
-        m_processor->SetConfig(config);
+        m_processor->ModifyConfig([&](ProcessingConfig& config) {
+            config.invertY = invert;
+        });
     }
     if (m_config) {
         auto cfg = m_config->GetConfig();
         cfg.invertY = invert;
         m_config->SetConfig(cfg);
-        m_config->Save();
+        m_config->RequestSave();
     }
 }
 
 void Mouse2VRCore::SetLockX(bool lock) {
     LOG_INFO("Core", "Setting lock X to: " + std::string(lock ? "true" : "false"));
     if (m_processor) {
-        ProcessingConfig config = m_processor->GetConfig();
-        config.lockX = lock;
-        m_processor->SetConfig(config);
+        m_processor->ModifyConfig([&](ProcessingConfig& config) {
+            config.lockX = lock;
+        });
     }
     if (m_config) {
         auto cfg = m_config->GetConfig();
         cfg.lockX = lock;
         m_config->SetConfig(cfg);
-        m_config->Save();
+        m_config->RequestSave();
     }
 }
 
 void Mouse2VRCore::SetCountsPerMeter(float countsPerMeter) {
     LOG_INFO("Core", "Setting counts per meter to: " + std::to_string(countsPerMeter));
     if (m_processor) {
-        ProcessingConfig config = m_processor->GetConfig();
-        config.countsPerMeter = countsPerMeter;
-        m_processor->SetConfig(config);
+        m_processor->ModifyConfig([&](ProcessingConfig& config) {
+            config.countsPerMeter = countsPerMeter;
+        });
     }
     if (m_config) {
         auto cfg = m_config->GetConfig();
         cfg.countsPerMeter = countsPerMeter;
         m_config->SetConfig(cfg);
-        m_config->Save();
+        m_config->RequestSave();
     }
 }
 
+void Mouse2VRCore::ApplySettings(const SettingsChange& requested) {
+    if (requested.Empty()) {
+        return;
+    }
+    SettingsChange change = requested;
+    if (change.updateRateHz) change.updateRateHz = std::clamp(*change.updateRateHz, 10, 200);
+    if (change.coalesceWindowUs) change.coalesceWindowUs = std::clamp(*change.coalesceWindowUs, 0, 100000);
+    if (change.maxOutputRateHz) change.maxOutputRateHz = std::clamp(*change.maxOutputRateHz, 10, 8000);
+    if (change.idleUpdateIntervalMs) change.idleUpdateIntervalMs = std::clamp(*change.idleUpdateIntervalMs, 0, 1000);
+    if (change.idleTimeoutMs) change.idleTimeoutMs = std::clamp(*change.idleTimeoutMs, 0, 60000);
+    
+    if (m_processor && change.ChangesProcessing()) {
+        m_processor->ModifyConfig([&](ProcessingConfig& config) {
+            change.ApplyTo(config);
+        });
+    }
+    
+    if (change.updateRateHz) m_updateRateHz = *change.updateRateHz;
+    if (change.coalesceWindowUs) m_coalesceWindowUs = *change.coalesceWindowUs;
+    if (change.maxOutputRateHz) m_maxOutputRateHz = *change.maxOutputRateHz;
+    if (change.eventDriven) m_eventDriven = *change.eventDriven;
+    if (change.adaptiveMode) m_adaptiveMode = *change.adaptiveMode;
+    if (change.idleUpdateIntervalMs) m_idleUpdateIntervalMs = *change.idleUpdateIntervalMs;
+    if (change.idleTimeoutMs) m_idleTimeoutMs = *change.idleTimeoutMs;
+    if (change.eventDriven || change.adaptiveMode || change.idleUpdateIntervalMs || change.idleTimeoutMs) {
+        m_inputEvent.Signal();  // Let the processing loop re-evaluate its scheduler
+    }
+    
+    if (m_config) {
+        auto cfg = m_config->GetConfig();
+        change.ApplyTo(cfg);
+        m_config->SetConfig(cfg);
+        m_config->RequestSave();
+    }
+    LOG_INFO("Core", "Applied settings: {}", GetCurrentSettingsSnapshot());
+}
+
+ConfigSaveStats Mouse2VRCore::GetConfigSaveStats() const {
+    return m_config ? m_config->GetSaveStats() : ConfigSaveStats{};
+}
+
+bool Mouse2VRCore::FlushConfig() {
+    return m_config ? m_config->Flush() : true;
+}
+
+uint64_t Mouse2VRCore::GetProcessorConfigVersion() const {
+    return m_processor ? m_processor->GetConfigVersion() : 0;
+}
+
+bool Mouse2VRCore::StartRecording(const std::string& path) {
+    if (!m_processor) {
+        return false;
+    }
+    return m_recorder->Start(path, m_processor->GetConfig(), m_updateRateHz.load());
+}
+
+void Mouse2VRCore::StopRecording() {
+    m_recorder->Stop();
+}
+
+bool Mouse2VRCore::IsRecording() const {
+    return m_recorder->IsRecording();
+}
+
 double Mouse2VRCore::GetCurrentSpeed() const {
     std::lock_guard<std::mutex> lock(m_stateMutex);
     return m_currentState.speed;
@@ -262,6 +497,199 @@ int Mouse2VRCore::GetActualUpdateRate() const {
     return m_actualUpdateRate.load();
 }
 
+SchedulerStats Mouse2VRCore::GetSchedulerStats() const {
+    SchedulerStats stats;
+    stats.lateness = m_tickLateness.GetStats();
+    stats.tickTime = m_tickTime.GetStats();
+    stats.ticks = m_schedulerTicks.load(std::memory_order_relaxed);
+    stats.missedFrames = m_missedFrames.load(std::memory_order_relaxed);
+    stats.targetHz = m_updateRateHz.load();
+    stats.achievedHz = m_actualUpdateRate.load();
+    return stats;
+}
+
+void Mouse2VRCore::ResetSchedulerStats() {
+    m_tickLateness.Reset();
+    m_tickTime.Reset();
+    m_schedulerTicks = 0;
+    m_missedFrames = 0;
+}
+
+bool Mouse2VRCore::SetFrameClock(std::unique_ptr<IFrameClock> frameClock) {
+    if (m_isRunning) {
+        LOG_ERROR("Core", "Frame clock can only be changed while stopped");
+        return false;
+    }
+    m_frameClock = std::move(frameClock);
+    m_phaseLocked = false;
+    LOG_INFO("Core", "Frame clock: {}", m_frameClock ? m_frameClock->GetName() : "none");
+    return true;
+}
+
+size_t Mouse2VRCore::TakeTelemetry(TelemetryBatch& batch) {
+    batch.Clear();
+    m_telemetry.Drain(batch);
+    batch.actualHz = m_actualUpdateRate.load();
+    return batch.samples.size();
+}
+
+bool Mouse2VRCore::AddOutputSink(std::unique_ptr<IControllerSink> sink, int rateHz) {
+    if (m_isRunning) {
+        LOG_ERROR("Core", "Output sinks can only be added while stopped");
+        return false;
+    }
+    if (!m_outputs) {
+        m_outputs = std::make_unique<OutputFanout>();
+    }
+    return m_outputs->AddSink(std::move(sink), rateHz);
+}
+
+std::vector<OutputSinkStats> Mouse2VRCore::GetOutputSinkStats() const {
+    return m_outputs ? m_outputs->GetStats() : std::vector<OutputSinkStats>{};
+}
+
+bool Mouse2VRCore::SetStatePublisher(std::unique_ptr<SharedStatePublisher> publisher) {
+    if (m_isRunning) {
+        LOG_ERROR("Core", "State channel can only be changed while stopped");
+        return false;
+    }
+    m_statePublisher = std::move(publisher);
+    return true;
+}
+
+void Mouse2VRCore::PublishState(const ControllerState& state, bool running) {
+    if (running && m_telemetryEnabled.load(std::memory_order_relaxed)) {
+        m_telemetry.Record(TelemetrySample{m_clock->NowNs(), static_cast<float>(state.speed),
+                                           static_cast<float>(state.stickY)});
+    }
+    if (!m_statePublisher) {
+        return;
+    }
+    SharedStateSnapshot snapshot;
+    snapshot.speed = state.speed;
+    snapshot.beltSpeed = state.beltSpeed;
+    snapshot.stickX = state.stickX;
+    snapshot.stickY = state.stickY;
+    snapshot.monotonicNs = m_clock->NowNs();
+    snapshot.unixTimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    snapshot.updateRate = m_updateRateHz.load();
+    snapshot.running = running;
+    m_statePublisher->Publish(snapshot);
+}
+
+bool Mouse2VRCore::SetClock(std::shared_ptr<IClock> clock) {
+    if (m_isRunning) {
+        LOG_ERROR("Core", "Clock can only be changed while stopped");
+        return false;
+    }
+    m_clock = clock ? std::move(clock) : std::make_shared<SystemClock>();
+    // Timestamps from the old clock mean nothing on the new one
+    m_lastUpdateNs = m_clock->NowNs();
+    m_activityMarkNs = m_lastUpdateNs;
+    return true;
+}
+
+void Mouse2VRCore::SetFrameLead(int leadUs) {
+    m_frameLeadUs = std::clamp(leadUs, 0, 100000);
+}
+
+PhaseStats Mouse2VRCore::GetPhaseStats() const {
+    PhaseStats stats;
+    stats.absError = m_phaseError.GetStats();
+    if (stats.absError.count > 0) {
+        stats.meanErrorNs = static_cast<double>(m_phaseErrorSumNs.load(std::memory_order_relaxed)) /
+                            static_cast<double>(stats.absError.count);
+    }
+    stats.locked = m_phaseLocked.load();
+    stats.framePeriodNs = m_framePeriodNs.load(std::memory_order_relaxed);
+    stats.stepNs = m_phaseStepNs.load(std::memory_order_relaxed);
+    stats.leadNs = static_cast<int64_t>(m_frameLeadUs.load()) * 1000;
+    stats.lockedTicks = m_lockedTicks.load(std::memory_order_relaxed);
+    stats.unlockedTicks = m_unlockedTicks.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void Mouse2VRCore::ResetPhaseStats() {
+    m_phaseError.Reset();
+    m_phaseErrorSumNs = 0;
+    m_lockedTicks = 0;
+    m_unlockedTicks = 0;
+}
+
+void Mouse2VRCore::SetThreadPolicy(const ThreadPolicyConfig& processing, const ThreadPolicyConfig& input,
+                                   bool lockMemory) {
+    std::lock_guard<std::mutex> lock(m_threadPolicyMutex);
+    m_processingPolicy = processing;
+    m_inputPolicy = input;
+    m_lockMemory = lockMemory;
+}
+
+ThreadPolicyReport Mouse2VRCore::GetThreadPolicyReport() const {
+    ThreadPolicyReport report;
+    {
+        std::lock_guard<std::mutex> lock(m_threadPolicyMutex);
+        report.processing = m_processingPolicyApplied;
+        report.memoryLocked = m_memoryLocked;
+    }
+    if (m_inputSource) {
+        report.input = m_inputSource->GetAppliedThreadPolicy();
+    }
+    return report;
+}
+
+ActivityStats Mouse2VRCore::GetActivityStats() const {
+    ActivityStats stats = ReadActivity();
+    std::lock_guard<std::mutex> lock(m_activityBaselineMutex);
+    for (int i = 0; i < 2; ++i) {
+        stats.cpuNs[i] -= m_activityBaseline.cpuNs[i];
+        stats.wallNs[i] -= m_activityBaseline.wallNs[i];
+        stats.ticks[i] -= m_activityBaseline.ticks[i];
+    }
+    stats.idleTransitions -= m_activityBaseline.idleTransitions;
+    stats.wakeTransitions -= m_activityBaseline.wakeTransitions;
+    return stats;
+}
+
+void Mouse2VRCore::ResetActivityStats() {
+    // The processing thread owns the totals; readers count from here on
+    ActivityStats stats = ReadActivity();
+    std::lock_guard<std::mutex> lock(m_activityBaselineMutex);
+    m_activityBaseline = stats;
+}
+
+ActivityStats Mouse2VRCore::ReadActivity() const {
+    const PublishedActivity& published = m_publishedActivity;
+    for (;;) {
+        uint64_t before = published.lock.load(std::memory_order_acquire);
+        if (before & 1) {
+            std::this_thread::yield();  // The processing thread is mid-write
+            continue;
+        }
+        ActivityStats stats;
+        bool live = published.live.load(std::memory_order_relaxed);
+        int64_t markNs = published.markNs.load(std::memory_order_relaxed);
+        stats.state = published.state.load(std::memory_order_relaxed);
+        stats.parked = published.parked.load(std::memory_order_relaxed);
+        for (int i = 0; i < 2; ++i) {
+            stats.cpuNs[i] = published.cpuNs[i].load(std::memory_order_relaxed);
+            stats.wallNs[i] = published.wallNs[i].load(std::memory_order_relaxed);
+            stats.ticks[i] = published.ticks[i].load(std::memory_order_relaxed);
+        }
+        stats.idleTransitions = published.idleTransitions.load(std::memory_order_relaxed);
+        stats.wakeTransitions = published.wakeTransitions.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (published.lock.load(std::memory_order_relaxed) != before) {
+            continue;
+        }
+        if (live) {
+            // Wall time since the last rollup, which matters while parked
+            stats.wallNs[static_cast<int>(stats.state)] += std::max<int64_t>(0, m_clock->NowNs() - markNs);
+        }
+        return stats;
+    }
+}
+
 void Mouse2VRCore::StartMovementTest() {
     if (m_isTestRunning) {
         LOG_WARNING("Core", "Test already running");
@@ -272,7 +700,7 @@ void Mouse2VRCore::StartMovementTest() {
     LOG_INFO("Core", "Move the treadmill to generate test data");
     
     m_isTestRunning = true;
-    m_testStartTime = std::chrono::steady_clock::now();
+    m_testStartNs = m_clock->NowNs();
     m_testUpdateCount = 0;
     m_testTotalDistance = 0.0f;
     m_testPeakSpeed = 0.0f;
@@ -291,109 +719,445 @@ void Mouse2VRCore::StartMovementTest() {
 }
 
 void Mouse2VRCore::ProcessingLoop() {
-    LOG_INFO("Core", "[VR Scheduler] Starting with target rate: " + std::to_string(m_updateRateHz.load()) + " Hz");
-    
+#ifdef _WIN32
     // === VR-Safe Startup: Enable precise sleeps only while running ===
     timeBeginPeriod(1);
+#endif
+    
+    ApplyProcessingThreadPolicy();
+    
+    // Time spent before this thread started belongs to no state
+    m_activity.Reset();
+    m_activityStats.state = ActivityState::Active;
+    m_activityStats.parked = false;
+    m_activityMarkNs = m_clock->NowNs();
+    m_activityMarkCpuNs = ThreadCpuTimeNs();
+    PublishActivity(true);
+    
+    // Each scheduler returns when stopped or when the mode is switched
+    while (m_isRunning) {
+        if (m_eventDriven) {
+            EventDrivenLoop();
+        } else {
+            FixedRateLoop();
+        }
+    }
+    AccountActivity(m_clock->NowNs());
+    PublishActivity(false);
+    m_processor->ReleaseSnapshot();
+    
+#ifdef _WIN32
+    // === VR-Safe shutdown: disable high-res timing ===
+    timeEndPeriod(1);
+#endif
     
-    // === High-precision timing with QueryPerformanceCounter ===
-    LARGE_INTEGER frequency, lastTick, now;
-    QueryPerformanceFrequency(&frequency);
-    QueryPerformanceCounter(&lastTick);
+    LOG_INFO("Core", "[VR Scheduler] Stopped");
+}
+
+void Mouse2VRCore::FixedRateLoop() {
+    LOG_INFO("Core", "[VR Scheduler] Starting with target rate: " + std::to_string(m_updateRateHz.load()) + " Hz");
+    
+    // === High-precision timing on the core's clock (steady_clock / QueryPerformanceCounter) ===
+    IClock& clock = *m_clock;
+    int64_t lastTickNs = clock.NowNs();
     
     // === Scheduler state ===
     uint64_t tickCount = 0;
-    double accumulatedError = 0.0;
-    int missedFrames = 0;
-    LARGE_INTEGER schedulerStartTime = lastTick;
+    uint64_t loggedMissedFrames = m_missedFrames.load();
+    int64_t schedulerStartNs = lastTickNs;
     
-    while (m_isRunning) {
+    bool parked = false;
+    int64_t phaseDeadlineNs = 0;  // Last phase-locked deadline, 0 while free-running
+    
+    while (m_isRunning && !m_eventDriven) {
         // === Dynamic rate updates from config/UI ===
+        ApplyTimerStrategy();
         double targetHz = static_cast<double>(m_updateRateHz.load());
-        double targetInterval = 1.0 / targetHz;
+        int64_t intervalNs = static_cast<int64_t>(1e9 / targetHz);
         
         // === Process treadmill inputs → stick deflection → game speed ===
-        UpdateController();
-        tickCount++;
+        // A parked scheduler only publishes once input has arrived
+        int64_t tickStartNs = clock.NowNs();
+        int64_t publishedNs = 0;
+        MouseDelta delta;
+        size_t drained = DrainInput(delta);
+        bool publish = !parked || drained > 0;
+        if (publish) {
+            if (parked) {
+                // The parked time is not this tick's window
+                m_lastUpdateNs = clock.NowNs() - intervalNs;
+            }
+            ProcessAndPublish(delta);
+            publishedNs = clock.NowNs();
+            m_tickTime.Record(publishedNs - tickStartNs);
+            m_schedulerTicks.fetch_add(1, std::memory_order_relaxed);
+            (phaseDeadlineNs > 0 ? m_lockedTicks : m_unlockedTicks).fetch_add(1, std::memory_order_relaxed);
+            tickCount++;
+        }
+        UpdateActivity(drained > 0, publish);
+        
+        if (ShouldPark()) {
+            // === Parked: block until input, a stop or a settings change ===
+            if (!parked) {
+                PublishCentered();
+                m_actualUpdateRate = 0;
+                parked = true;
+            }
+            SetParked(true);
+            m_processor->ReleaseSnapshot();
+            clock.WaitForWake(m_inputEvent, IClock::kNoDeadline);
+            SetParked(false);
+            lastTickNs = clock.NowNs();
+            continue;
+        }
+        parked = false;
+        
+        FrameTiming frame = m_frameClock ? m_frameClock->GetTiming() : FrameTiming{};
+        if (m_adaptiveMode && m_activity.IsIdle()) {
+            // === Idle: keep-alive updates at the idle rate; the first
+            // input cuts the wait short and the next tick runs at full rate ===
+            clock.WaitForWake(m_inputEvent, clock.NowNs() + IdleInterval().count());
+            lastTickNs = clock.NowNs();
+            phaseDeadlineNs = 0;
+            m_phaseLocked = false;
+            continue;
+        }
+        
+        if (frame.IsValid()) {
+            // === Phase-locked: the next grid point leadUs before a vsync ===
+            PhaseGrid grid = PhaseGrid::Create(frame, static_cast<int64_t>(m_frameLeadUs.load()) * 1000,
+                                               static_cast<int>(targetHz));
+            if (publish && phaseDeadlineNs > 0) {
+                int64_t error = grid.ErrorAt(publishedNs);
+                m_phaseError.Record(std::abs(error));
+                m_phaseErrorSumNs.fetch_add(error, std::memory_order_relaxed);
+            }
+            
+            // Never two updates for one grid point, even if the clock moved
+            int64_t nowNs = clock.NowNs();
+            int64_t earliest = phaseDeadlineNs > 0 ? std::max(nowNs, phaseDeadlineNs + grid.stepNs / 2) : nowNs;
+            int64_t deadlineNs = grid.NextAfter(earliest);
+            if (phaseDeadlineNs > 0) {
+                // Grid points that went by while this tick ran
+                int64_t skipped = (deadlineNs - phaseDeadlineNs + grid.stepNs / 2) / grid.stepNs - 1;
+                if (skipped > 0) {
+                    m_missedFrames.fetch_add(static_cast<uint64_t>(skipped), std::memory_order_relaxed);
+                }
+            }
+            m_tickLateness.Record(clock.WaitUntil(deadlineNs, m_timer));
+            
+            phaseDeadlineNs = deadlineNs;
+            lastTickNs = deadlineNs;
+            m_phaseLocked = true;
+            m_framePeriodNs = frame.periodNs;
+            m_phaseStepNs = grid.stepNs;
+            continue;
+        }
+        phaseDeadlineNs = 0;
+        m_phaseLocked = false;
         
         // === Calculate next frame time ===
-        lastTick.QuadPart += static_cast<LONGLONG>(targetInterval * frequency.QuadPart);
+        lastTickNs += intervalNs;
         
-        // === VR-Safe timing: sleep most, spin-wait last 2ms ===
-        QueryPerformanceCounter(&now);
-        double remaining = (lastTick.QuadPart - now.QuadPart) / static_cast<double>(frequency.QuadPart);
+        // === VR-Safe timing: sleep until the deadline timer's spin tail ===
+        int64_t nowNs = clock.NowNs();
+        int64_t remainingNs = lastTickNs - nowNs;
         
         // === Handle late frames (VR-safe: skip instead of blocking) ===
-        if (remaining < 0) {
-            missedFrames++;
-            accumulatedError += -remaining;
+        if (remainingNs < 0) {
+            m_missedFrames.fetch_add(1, std::memory_order_relaxed);
+            m_tickLateness.Record(-remainingNs);
             
             // Reset schedule to prevent death spiral
-            lastTick = now;
+            lastTickNs = nowNs;
             
             // Only log significant delays (>5ms) to avoid spam
-            if (-remaining > 0.005) {
-                LOG_DEBUG("Core", "[VR Scheduler] Skipped frame (late by " + 
-                         std::to_string(-remaining * 1000.0) + " ms)");
+            if (-remainingNs > 5000000) {
+                LOG_DEBUG("Core", "[VR Scheduler] Skipped frame (late by {:.6f} ms)", -remainingNs / 1e6);
             }
         }
         else {
-            // === Sleep phase: leave CPU for VR compositor ===
-            while (remaining > 0.002) { // More than 2ms left
-                std::this_thread::sleep_for(std::chrono::milliseconds(1));
-                QueryPerformanceCounter(&now);
-                remaining = (lastTick.QuadPart - now.QuadPart) / static_cast<double>(frequency.QuadPart);
-            }
-            
-            // === Spin-wait phase: precise timing for last 2ms ===
-            while (remaining > 0) {
-                QueryPerformanceCounter(&now);
-                remaining = (lastTick.QuadPart - now.QuadPart) / static_cast<double>(frequency.QuadPart);
-            }
+            // === Kernel sleep to just before the deadline, leaving the CPU
+            // to the VR compositor, then a short spin for precision ===
+            m_tickLateness.Record(clock.WaitUntil(lastTickNs, m_timer));
         }
         
         // === Comprehensive logging every second ===
-        if (tickCount % static_cast<uint64_t>(targetHz) == 0) {
-            QueryPerformanceCounter(&now);
-            double totalElapsed = (now.QuadPart - schedulerStartTime.QuadPart) / static_cast<double>(frequency.QuadPart);
+        if (publish && tickCount % static_cast<uint64_t>(targetHz) == 0) {
+            double totalElapsed = (clock.NowNs() - schedulerStartNs) / 1e9;
             double achievedHz = tickCount / totalElapsed;
             
-            // Calculate drift in milliseconds
-            double driftMs = accumulatedError * 1000.0;
-            
             // Update actual rate for UI display
             m_actualUpdateRate = static_cast<int>(achievedHz + 0.5);
             
-            // Log scheduler performance
-            LOG_INFO("Core", "[VR Scheduler] Target=" + std::to_string(static_cast<int>(targetHz)) + 
-                    " Hz, Achieved=" + std::to_string(achievedHz) + 
-                    " Hz, Drift=" + (driftMs >= 0 ? "+" : "") + std::to_string(driftMs) + 
-                    " ms, Missed=" + std::to_string(missedFrames) + " frames");
-            
-            // Reset per-second tracking
-            accumulatedError = 0.0;
-            missedFrames = 0;
+            // Log scheduler performance from the same snapshot the UI reads
+            SchedulerStats stats = GetSchedulerStats();
+            LatencyStats latency = m_latency.GetStats();
+            uint64_t missed = stats.missedFrames - std::min(loggedMissedFrames, stats.missedFrames);
+            LOG_INFO("Core", "[VR Scheduler] Target={} Hz, Achieved={:.2f} Hz, Missed={} frames, "
+                             "Lateness p50={:.3f} ms p99={:.3f} ms max={:.3f} ms, Tick p99={:.3f} ms, "
+                             "Latency p50={:.3f} ms p99={:.3f} ms",
+                     static_cast<int>(targetHz), achievedHz, missed,
+                     stats.lateness.p50Ns / 1e6, stats.lateness.p99Ns / 1e6, stats.lateness.maxNs / 1e6,
+                     stats.tickTime.p99Ns / 1e6, latency.p50Ns / 1e6, latency.p99Ns / 1e6);
+            loggedMissedFrames = stats.missedFrames;
         }
     }
+}
+
+void Mouse2VRCore::EventDrivenLoop() {
+    LOG_INFO("Core", "[Event Scheduler] Starting: coalesce={} us, max rate={} Hz, idle rate={} Hz",
+             m_coalesceWindowUs.load(), m_maxOutputRateHz.load(), m_updateRateHz.load());
     
-    // === VR-Safe shutdown: disable high-res timing ===
-    timeEndPeriod(1);
+    IClock& clock = *m_clock;
+    OutputThrottle throttle;
+    uint64_t outputCount = 0;
+    uint64_t wakeCount = 0;
+    int64_t statsStartNs = clock.NowNs();
     
-    LOG_INFO("Core", "[VR Scheduler] Stopped");
+    bool parked = false;
+    
+    while (m_isRunning && m_eventDriven) {
+        // === Dynamic settings from config/UI ===
+        ApplyTimerStrategy();
+        throttle.Configure(static_cast<int64_t>(m_coalesceWindowUs.load()) * 1000,
+                           m_maxOutputRateHz.load());
+        bool park = ShouldPark();
+        if (park && !parked) {
+            PublishCentered();
+            m_actualUpdateRate = 0;
+        }
+        parked = park;
+        
+        // === Block until input arrives; time out to publish idle updates
+        // so the stick returns to center when the treadmill stops. Parked,
+        // only input, a stop or a settings change wakes the loop ===
+        bool signaled = true;
+        if (parked) {
+            SetParked(true);
+            m_processor->ReleaseSnapshot();
+            clock.WaitForWake(m_inputEvent, IClock::kNoDeadline);
+            SetParked(false);
+        } else {
+            signaled = clock.WaitForWake(m_inputEvent, clock.NowNs() + IdleInterval().count());
+        }
+        if (!m_isRunning || !m_eventDriven) {
+            break;
+        }
+        
+        if (signaled) {
+            wakeCount++;
+            // Lone events go out now; bursts are held so following reports
+            // are summed into the same update
+            m_tickLateness.Record(clock.WaitUntil(throttle.OnInput(clock.NowNs()), m_timer));
+        }
+        
+        int64_t tickStartNs = clock.NowNs();
+        MouseDelta delta;
+        size_t drained = DrainInput(delta);
+        if (signaled && drained == 0) {
+            // Samples already went out with the previous update
+            continue;
+        }
+        
+        if (parked) {
+            // The parked time is not this update's window
+            m_lastUpdateNs = clock.NowNs() - 1000000000LL / std::max(1, m_updateRateHz.load());
+        }
+        ProcessAndPublish(delta);
+        int64_t nowNs = clock.NowNs();
+        m_tickTime.Record(nowNs - tickStartNs);
+        m_schedulerTicks.fetch_add(1, std::memory_order_relaxed);
+        UpdateActivity(drained > 0, true);
+        throttle.OnOutput(nowNs);
+        outputCount++;
+        
+        // === Once per second: publish achieved rate ===
+        int64_t statsElapsedNs = nowNs - statsStartNs;
+        if (statsElapsedNs >= 1000000000LL) {
+            double achievedHz = outputCount * 1e9 / static_cast<double>(statsElapsedNs);
+            m_actualUpdateRate = static_cast<int>(achievedHz + 0.5);
+            LOG_DEBUG("Core", "[Event Scheduler] Outputs={:.1f} Hz, Wakes={}", achievedHz, wakeCount);
+            outputCount = 0;
+            wakeCount = 0;
+            statsStartNs = nowNs;
+        }
+    }
+}
+
+void Mouse2VRCore::ApplyProcessingThreadPolicy() {
+    std::lock_guard<std::mutex> lock(m_threadPolicyMutex);
+    if (m_processingPolicy.IsDefault()) {
+        m_processingPolicyApplied = QueryThreadPolicy();
+        return;
+    }
+    
+    m_processingPolicyApplied = ApplyThreadPolicy(m_processingPolicy);
+    const AppliedThreadPolicy& applied = m_processingPolicyApplied;
+    LOG_INFO("Core", "[VR Scheduler] Thread policy: scheduler={} rt={} priority={} affinity=0x{:x}",
+             ThreadSchedulerToString(applied.scheduler), applied.realtimePriority,
+             ThreadPriorityToString(applied.priority), applied.affinityMask);
+    if (!applied.failures.empty()) {
+        LOG_WARNING("Core", "[VR Scheduler] Thread policy not fully applied: {}", applied.failures);
+    }
+}
+
+void Mouse2VRCore::ApplyTimerStrategy() {
+    TimerStrategy strategy = m_timerStrategy.load();
+    if (strategy != m_timer.GetStrategy()) {
+        m_timer.SetStrategy(strategy);
+        LOG_INFO("Core", "[VR Scheduler] Timer strategy: {} (spin tail {} us)",
+                 TimerStrategyToString(strategy), m_timer.GetSpinTailNs() / 1000);
+    }
+}
+
+bool Mouse2VRCore::ShouldPark() const {
+    return m_adaptiveMode && m_idleUpdateIntervalMs <= 0 && m_activity.IsIdle();
+}
+
+std::chrono::nanoseconds Mouse2VRCore::IdleInterval() const {
+    // Without input the schedulers publish keep-alive updates at the full
+    // rate, or at the idle rate once adaptive mode has seen the input stop
+    int idleMs = m_idleUpdateIntervalMs;
+    if (m_adaptiveMode && idleMs > 0 && m_activity.IsIdle()) {
+        return std::chrono::milliseconds(idleMs);
+    }
+    return std::chrono::nanoseconds(1000000000LL / std::max(1, m_updateRateHz.load()));
+}
+
+void Mouse2VRCore::AccountActivity(int64_t nowNs) {
+    int64_t cpuNs = ThreadCpuTimeNs();
+    int state = static_cast<int>(m_activityStats.state);
+    m_activityStats.wallNs[state] += nowNs - m_activityMarkNs;
+    m_activityStats.cpuNs[state] += cpuNs - m_activityMarkCpuNs;
+    m_activityMarkNs = nowNs;
+    m_activityMarkCpuNs = cpuNs;
+}
+
+void Mouse2VRCore::UpdateActivity(bool hasInput, bool published) {
+    m_activity.Configure(static_cast<int64_t>(m_idleTimeoutMs.load()) * 1000000);
+    int64_t nowNs = m_clock->NowNs();
+    bool changed = m_activity.Update(hasInput, nowNs);
+    if (changed || nowNs - m_activityMarkNs >= kActivityRollupNs) {
+        // Time up to now was spent in the previous state
+        AccountActivity(nowNs);
+    }
+    
+    // This tick's update counts toward the state it leaves us in
+    ActivityState state = m_activity.GetState();
+    m_activityStats.state = state;
+    if (published) {
+        m_activityStats.ticks[static_cast<int>(state)]++;
+    }
+    if (changed) {
+        if (state == ActivityState::Idle) {
+            m_activityStats.idleTransitions++;
+        } else {
+            m_activityStats.wakeTransitions++;
+        }
+    }
+    PublishActivity(true);
+    if (changed) {
+        LOG_DEBUG("Core", "[Adaptive] Input {}", state == ActivityState::Idle ? "stopped, idling" : "resumed");
+    }
+}
+
+void Mouse2VRCore::SetParked(bool parked) {
+    if (parked) {
+        // Readers extend the wall time while blocked; the CPU time is final
+        AccountActivity(m_clock->NowNs());
+    }
+    m_activityStats.parked = parked;
+    PublishActivity(true);
+}
+
+void Mouse2VRCore::PublishActivity(bool live) {
+    PublishedActivity& published = m_publishedActivity;
+    uint64_t lock = published.lock.load(std::memory_order_relaxed);
+    published.lock.store(lock + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    published.live.store(live, std::memory_order_relaxed);
+    published.markNs.store(m_activityMarkNs, std::memory_order_relaxed);
+    published.state.store(m_activityStats.state, std::memory_order_relaxed);
+    published.parked.store(m_activityStats.parked, std::memory_order_relaxed);
+    for (int i = 0; i < 2; ++i) {
+        published.cpuNs[i].store(m_activityStats.cpuNs[i], std::memory_order_relaxed);
+        published.wallNs[i].store(m_activityStats.wallNs[i], std::memory_order_relaxed);
+        published.ticks[i].store(m_activityStats.ticks[i], std::memory_order_relaxed);
+    }
+    published.idleTransitions.store(m_activityStats.idleTransitions, std::memory_order_relaxed);
+    published.wakeTransitions.store(m_activityStats.wakeTransitions, std::memory_order_relaxed);
+    published.lock.store(lock + 2, std::memory_order_release);
+}
+
+void Mouse2VRCore::PublishCentered() {
+    if (!m_controller) {
+        return;
+    }
+    // The filters may still hold a residual speed; a parked pad must rest
+    // exactly at center
+    m_controller->SetSpeed(0.0f);
+    m_controller->SetLeftStick(0.0f, 0.0f);
+    m_controller->Update();
+    if (m_outputs) {
+        m_outputs->Publish(0.0f, 0.0f, 0.0f);
+    }
+    
+    ControllerState state;
+    {
+        std::lock_guard<std::mutex> lock(m_stateMutex);
+        m_currentState.speed = 0.0;
+        m_currentState.beltSpeed = 0.0;
+        m_currentState.stickX = 0.0;
+        m_currentState.stickY = 0.0;
+        state = m_currentState;
+    }
+    PublishState(state, true);
 }
 
 void Mouse2VRCore::UpdateController() {
-    if (!m_inputHandler || !m_processor || !m_controller) {
+    if (!m_inputSource) {
         return;
     }
     
-    // === Get mouse deltas ===
-    MouseDelta delta = m_inputHandler->GetAndResetDeltas();
+    MouseDelta delta;
+    DrainInput(delta);
+    ProcessAndPublish(delta);
+}
+
+size_t Mouse2VRCore::DrainInput(MouseDelta& delta) {
+    if (!m_inputSource) {
+        return 0;
+    }
+    
+    // === Drain timestamped samples and sum them into this tick's delta ===
+    InputSample samples[256];
+    size_t total = 0;
+    size_t drained;
+    do {
+        drained = m_inputSource->DrainSamples(samples, std::size(samples));
+        for (size_t i = 0; i < drained; ++i) {
+            delta.x += samples[i].dx;
+            delta.y += samples[i].dy;
+            if (m_tickArrivalCount < kMaxTrackedArrivals) {
+                m_tickArrivalNs[m_tickArrivalCount++] = samples[i].timestampNs;
+            }
+        }
+        m_recorder->RecordSamples(samples, drained, 0);
+        total += drained;
+    } while (drained == std::size(samples));
+    return total;
+}
+
+void Mouse2VRCore::ProcessAndPublish(const MouseDelta& delta) {
+    if (!m_processor || !m_controller) {
+        return;
+    }
     
     // === Calculate elapsed time for velocity calculations ===
-    auto now = std::chrono::steady_clock::now();
-    auto elapsed = std::chrono::duration<float>(now - m_lastUpdate).count();
-    m_lastUpdate = now;
+    int64_t nowNs = m_clock->NowNs();
+    float elapsed = static_cast<float>((nowNs - m_lastUpdateNs) / 1e9);
+    m_lastUpdateNs = nowNs;
     
     // Skip if no time has passed (prevent division by zero)
     if (elapsed <= 0.0f) {
@@ -403,11 +1167,29 @@ void Mouse2VRCore::UpdateController() {
     // === Process input (treadmill → stick deflection) ===
     float stickX, stickY;
     m_processor->ProcessDelta(delta, elapsed, stickX, stickY);
+    m_recorder->RecordTick(nowNs, delta, elapsed);
     
     // === Update virtual controller (Y-axis only for treadmill) ===
+    m_controller->SetSpeed(m_processor->GetSpeedMetersPerSecond());
     m_controller->SetLeftStick(0.0f, stickY);
     m_controller->Update();
     
+    // === Motion-to-output latency for every sample in this report, on the
+    // time base of the arrival stamps (the steady clock even when the
+    // schedulers run on an injected clock) ===
+    if (m_tickArrivalCount > 0) {
+        int64_t submittedNs = m_inputSource->NowNs();
+        for (size_t i = 0; i < m_tickArrivalCount; ++i) {
+            m_latency.Record(submittedNs - m_tickArrivalNs[i]);
+        }
+        m_tickArrivalCount = 0;
+    }
+    
+    // === Secondary sinks, off the processing thread ===
+    if (m_outputs) {
+        m_outputs->Publish(0.0f, stickY, m_processor->GetSpeedMetersPerSecond());
+    }
+    
     // === Extended diagnostic logging (if enabled) ===
     static bool enableDetailedLogging = false; // Can be toggled via config
     static int logCounter = 0;
@@ -417,24 +1199,25 @@ void Mouse2VRCore::UpdateController() {
         float physicalSpeed = (delta.y / elapsed) / dpi * 0.0254f; // m/s
         float gameSpeed = stickY * 6.1f * config.sensitivity / 100.0f; // m/s in game
         
-        LOG_DEBUG("Core", "[VR Detail] DeltaY=" + std::to_string(delta.y) + 
-                 " counts, Physical=" + std::to_string(physicalSpeed) + 
-                 " m/s, Game=" + std::to_string(gameSpeed) + 
-                 " m/s, Stick=" + std::to_string(stickY * 100) + "%");
+        LOG_DEBUG("Core", "[VR Detail] DeltaY={} counts, Physical={:.6f} m/s, Game={:.6f} m/s, Stick={:.6f}%",
+                  delta.y, physicalSpeed, gameSpeed, stickY * 100);
     }
     
-    // 5. Update state for UI
+    // 5. Update state for UI and the shared-memory channel
+    ControllerState state;
     {
         std::lock_guard<std::mutex> lock(m_stateMutex);
         m_currentState.speed = m_processor->GetSpeedMetersPerSecond();
+        m_currentState.beltSpeed = m_processor->GetRealWorldSpeed();
         m_currentState.stickX = stickX;
         m_currentState.stickY = stickY;
+        state = m_currentState;
     }
+    PublishState(state, true);
     
     // Test mode logging
     if (m_isTestRunning) {
-        auto testNow = std::chrono::steady_clock::now();
-        float testElapsed = std::chrono::duration<float>(testNow - m_testStartTime).count();
+        float testElapsed = static_cast<float>((m_clock->NowNs() - m_testStartNs) / 1e9);
         
         if (testElapsed >= m_testDuration) {
             // End test
@@ -471,21 +1254,18 @@ void Mouse2VRCore::UpdateController() {
             
             // Only log when there's movement
             if (delta.y != 0) {
-                LOG_INFO("Core", "[TEST] t=" + std::to_string(testElapsed) + "s" +
-                                " | raw_mickeys=" + std::to_string(delta.y) +
-                                " | treadmill_speed=" + std::to_string(currentSpeed) + "m/s" +
-                                " | sensitivity=" + std::to_string(config.sensitivity) +
-                                " | game_speed=" + std::to_string(std::abs(gameSpeed)) + "m/s" +
-                                " | deflection=" + std::to_string(std::abs(stickY) * 100.0f) + "%");
+                LOG_INFO("Core", "[TEST] t={:.6f}s | raw_mickeys={} | treadmill_speed={:.6f}m/s | "
+                                 "sensitivity={:.6f} | game_speed={:.6f}m/s | deflection={:.6f}%",
+                         testElapsed, delta.y, currentSpeed, config.sensitivity,
+                         std::abs(gameSpeed), std::abs(stickY) * 100.0f);
             }
         }
     }
     // Regular debug logging (when not testing)
     else if (delta.y != 0 || delta.x != 0) {
-        LOG_DEBUG("Core", "UpdateController: deltaY=" + std::to_string(delta.y) + 
-                          " -> stickY=" + std::to_string(stickY) +
-                          " (speed=" + std::to_string(m_processor->GetSpeedMetersPerSecond()) + " m/s)" +
-                          " [" + (stickY > 0 ? "FORWARD" : stickY < 0 ? "BACKWARD" : "STOPPED") + "]");
+        LOG_DEBUG("Core", "UpdateController: deltaY={} -> stickY={:.6f} (speed={:.6f} m/s) [{}]",
+                  delta.y, stickY, m_processor->GetSpeedMetersPerSecond(),
+                  stickY > 0 ? "FORWARD" : stickY < 0 ? "BACKWARD" : "STOPPED");
     }
 }
 
@@ -510,19 +1290,39 @@ void Mouse2VRCore::UpdateSettings(const AppConfig& newConfig) {
         
         // Apply settings to processor
         if (m_processor) {
-            auto procConfig = m_processor->GetConfig();
-            procConfig.countsPerMeter = newConfig.countsPerMeter;
-            procConfig.sensitivity = newConfig.sensitivity;
-            procConfig.invertY = newConfig.invertY;
-            procConfig.lockX = newConfig.lockX;
-            procConfig.lockY = newConfig.lockY;
-            m_processor->SetConfig(procConfig);
+            m_processor->ModifyConfig([&](ProcessingConfig& procConfig) {
+                procConfig.countsPerMeter = newConfig.countsPerMeter;
+                procConfig.sensitivity = newConfig.sensitivity;
+                procConfig.invertY = newConfig.invertY;
+                procConfig.lockX = newConfig.lockX;
+                procConfig.lockY = newConfig.lockY;
+                procConfig.velocity = newConfig.velocity;
+                procConfig.prediction = newConfig.prediction;
+                procConfig.curve = newConfig.curve;
+            });
         }
         
         // Apply update rate (convert ms to Hz)
         if (newConfig.updateIntervalMs > 0) {
             m_updateRateHz = 1000 / newConfig.updateIntervalMs;
         }
+        m_coalesceWindowUs = newConfig.coalesceWindowUs;
+        m_maxOutputRateHz = newConfig.maxOutputRateHz;
+        m_timerStrategy = newConfig.timerStrategy;
+        SetFrameLead(newConfig.frameClock.leadUs);  // The source is only read at startup
+        SetThreadPolicy(newConfig.processingThread, newConfig.inputThread, newConfig.lockMemory);
+        if (m_eventDriven != newConfig.eventDriven) {
+            m_eventDriven = newConfig.eventDriven;
+            m_inputEvent.Signal();
+        }
+        if (m_adaptiveMode != newConfig.adaptiveMode ||
+            m_idleUpdateIntervalMs != newConfig.idleUpdateIntervalMs ||
+            m_idleTimeoutMs != newConfig.idleTimeoutMs) {
+            m_adaptiveMode = newConfig.adaptiveMode;
+            m_idleUpdateIntervalMs = newConfig.idleUpdateIntervalMs;
+            m_idleTimeoutMs = newConfig.idleTimeoutMs;
+            m_inputEvent.Signal();  // A parked loop re-evaluates the new settings
+        }
     }
 }
 
@@ -0,0 +1,173 @@
+#include "core/OutputFanout.h"
+#include "core/InputSampleQueue.h"
+#include "common/Logger.h"
+#include <chrono>
+
+namespace Mouse2VR {
+
+OutputFanout::~OutputFanout() {
+    Stop();
+}
+
+bool OutputFanout::AddSink(std::unique_ptr<IControllerSink> sink, int rateHz) {
+    if (!sink || IsRunning()) {
+        return false;
+    }
+    if (!sink->Initialize()) {
+        LOG_ERROR("Outputs", "Failed to initialize output sink: {}", sink->GetName());
+        return false;
+    }
+    auto worker = std::make_unique<Worker>();
+    worker->sink = std::move(sink);
+    worker->rateHz = rateHz > 0 ? rateHz : 0;
+    LOG_INFO("Outputs", "Output sink added: {} ({})", worker->sink->GetName(),
+             worker->rateHz > 0 ? std::to_string(worker->rateHz) + " Hz" : std::string("every update"));
+    m_workers.push_back(std::move(worker));
+    return true;
+}
+
+void OutputFanout::Start() {
+    if (m_running.exchange(true)) {
+        return;
+    }
+    uint64_t published = m_sequence.load(std::memory_order_relaxed);
+    for (auto& worker : m_workers) {
+        Worker* w = worker.get();
+        w->startSequence = published;
+        w->lastSequence = 0;  // Results from an earlier run do not carry over
+        w->thread = std::thread([this, w] { RunWorker(*w); });
+    }
+}
+
+void OutputFanout::Stop() {
+    if (!m_running.exchange(false)) {
+        return;
+    }
+    for (auto& worker : m_workers) {
+        worker->wake.Signal();
+    }
+    for (auto& worker : m_workers) {
+        if (worker->thread.joinable()) {
+            worker->thread.join();
+        }
+    }
+}
+
+void OutputFanout::Publish(float stickX, float stickY, float speed) {
+    uint64_t lock = m_lock.load(std::memory_order_relaxed);
+    m_lock.store(lock + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    m_publishedNs.store(InputSampleQueue::NowNs(), std::memory_order_relaxed);
+    m_stickX.store(stickX, std::memory_order_relaxed);
+    m_stickY.store(stickY, std::memory_order_relaxed);
+    m_speed.store(speed, std::memory_order_relaxed);
+    m_lock.store(lock + 2, std::memory_order_release);
+
+    for (auto& worker : m_workers) {
+        if (worker->rateHz == 0) {
+            worker->wake.Signal();
+        }
+    }
+}
+
+OutputSample OutputFanout::ReadLatest() const {
+    for (;;) {
+        uint64_t before = m_lock.load(std::memory_order_acquire);
+        if (before & 1) {
+            std::this_thread::yield();  // The publisher is mid-write
+            continue;
+        }
+        OutputSample sample;
+        sample.sequence = m_sequence.load(std::memory_order_relaxed);
+        sample.publishedNs = m_publishedNs.load(std::memory_order_relaxed);
+        sample.stickX = m_stickX.load(std::memory_order_relaxed);
+        sample.stickY = m_stickY.load(std::memory_order_relaxed);
+        sample.speed = m_speed.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (m_lock.load(std::memory_order_relaxed) == before) {
+            return sample;
+        }
+    }
+}
+
+void OutputFanout::RunWorker(Worker& worker) {
+    const int64_t periodNs = worker.rateHz > 0 ? 1000000000LL / worker.rateHz : 0;
+    int64_t nextNs = InputSampleQueue::NowNs();
+    while (m_running.load(std::memory_order_relaxed)) {
+        if (periodNs > 0) {
+            // Only Stop() signals a paced worker, so the wait is its timer
+            nextNs += periodNs;
+            int64_t nowNs = InputSampleQueue::NowNs();
+            if (nextNs > nowNs) {
+                worker.wake.WaitFor(std::chrono::nanoseconds(nextNs - nowNs));
+            } else {
+                nextNs = nowNs;  // A slow Update() overran its period; do not burst to catch up
+            }
+        } else {
+            worker.wake.Wait();
+        }
+        if (!m_running.load(std::memory_order_relaxed)) {
+            break;
+        }
+        Deliver(worker);
+    }
+}
+
+void OutputFanout::Deliver(Worker& worker) {
+    OutputSample sample = ReadLatest();
+    if (sample.sequence == 0) {
+        return;  // Nothing published yet
+    }
+    if (sample.sequence == worker.lastSequence) {
+        if (worker.rateHz == 0) {
+            return;  // Spurious wake
+        }
+        worker.repeated.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        // The first delivery may already be behind results published since Start
+        uint64_t previous = worker.lastSequence != 0 ? worker.lastSequence : worker.startSequence;
+        if (sample.sequence > previous + 1) {
+            worker.skipped.fetch_add(sample.sequence - previous - 1, std::memory_order_relaxed);
+        }
+    }
+    worker.lastSequence = sample.sequence;
+
+    int64_t startNs = InputSampleQueue::NowNs();
+    worker.sink->SetSpeed(sample.speed);
+    worker.sink->SetLeftStick(sample.stickX, sample.stickY);
+    worker.sink->Update();
+    int64_t doneNs = InputSampleQueue::NowNs();
+    worker.updateTime.Record(doneNs - startNs);
+    worker.age.Record(doneNs - sample.publishedNs);
+    worker.delivered.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::vector<OutputSinkStats> OutputFanout::GetStats() const {
+    std::vector<OutputSinkStats> stats;
+    stats.reserve(m_workers.size());
+    for (const auto& worker : m_workers) {
+        OutputSinkStats s;
+        s.name = worker->sink->GetName();
+        s.rateHz = worker->rateHz;
+        s.delivered = worker->delivered.load(std::memory_order_relaxed);
+        s.repeated = worker->repeated.load(std::memory_order_relaxed);
+        s.skipped = worker->skipped.load(std::memory_order_relaxed);
+        s.age = worker->age.GetStats();
+        s.updateTime = worker->updateTime.GetStats();
+        stats.push_back(std::move(s));
+    }
+    return stats;
+}
+
+void OutputFanout::ResetStats() {
+    for (auto& worker : m_workers) {
+        worker->delivered = 0;
+        worker->repeated = 0;
+        worker->skipped = 0;
+        worker->age.Reset();
+        worker->updateTime.Reset();
+    }
+}
+
+} // namespace Mouse2VR
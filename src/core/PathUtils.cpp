@@ -1,11 +1,17 @@
 #include "core/PathUtils.h"
-#include <Windows.h>
 #include <filesystem>
 #include <iostream>
 #include <algorithm>
+#include <system_error>
+
+#ifdef _WIN32
+#include <Windows.h>
+#endif
 
 namespace Mouse2VR {
 
+#ifdef _WIN32
+
 std::string PathUtils::GetExecutableDirectory() {
     char buffer[MAX_PATH];
     DWORD result = GetModuleFileNameA(NULL, buffer, MAX_PATH);
@@ -32,6 +38,26 @@ std::wstring PathUtils::GetExecutableDirectoryW() {
     return exePath.parent_path().wstring();
 }
 
+#else
+
+std::string PathUtils::GetExecutableDirectory() {
+    std::error_code ec;
+    std::filesystem::path exePath = std::filesystem::read_symlink("/proc/self/exe", ec);
+    
+    if (ec) {
+        std::cerr << "Failed to get executable path\n";
+        return "";
+    }
+    
+    return exePath.parent_path().string();
+}
+
+std::wstring PathUtils::GetExecutableDirectoryW() {
+    return std::filesystem::path(GetExecutableDirectory()).wstring();
+}
+
+#endif
+
 std::string PathUtils::GetExecutablePath(const std::string& relativePath) {
     std::string exeDir = GetExecutableDirectory();
     if (exeDir.empty()) {
@@ -60,32 +60,60 @@ void RawInputHandler::Shutdown() {
 }
 
 MouseDelta RawInputHandler::GetAndResetDeltas() {
-    std::lock_guard<std::mutex> lock(m_deltaMutex);
-    MouseDelta result = m_accumulatedDeltas;
-    m_accumulatedDeltas.reset();
-    return result;
+    std::lock_guard<TimedMutex> lock(m_drainMutex);
+    return m_samples.DrainAggregate();
 }
 
 MouseDelta RawInputHandler::GetDeltas() const {
-    std::lock_guard<std::mutex> lock(m_deltaMutex);
-    return m_accumulatedDeltas;
+    std::lock_guard<TimedMutex> lock(m_drainMutex);
+    return m_samples.PeekAggregate();
+}
+
+size_t RawInputHandler::DrainSamples(InputSample* out, size_t maxCount) {
+    std::lock_guard<TimedMutex> lock(m_drainMutex);
+    return m_samples.Drain(out, maxCount);
+}
+
+void RawInputHandler::SetThreadPolicy(const ThreadPolicyConfig& policy) {
+    std::lock_guard<std::mutex> lock(m_policyMutex);
+    m_threadPolicy = policy;
+    m_policyPending = true;
+}
+
+AppliedThreadPolicy RawInputHandler::GetAppliedThreadPolicy() const {
+    std::lock_guard<std::mutex> lock(m_policyMutex);
+    return m_appliedPolicy;
+}
+
+void RawInputHandler::ApplyPendingThreadPolicy() {
+    // WM_INPUT arrives on whichever thread owns the window, so the policy
+    // can only be applied from here
+    if (!m_policyPending.exchange(false)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_policyMutex);
+    m_appliedPolicy = m_threadPolicy.IsDefault() ? QueryThreadPolicy() : ApplyThreadPolicy(m_threadPolicy);
+    if (!m_appliedPolicy.failures.empty()) {
+        LOG_WARNING("RawInput", "Input thread policy not fully applied: {}", m_appliedPolicy.failures);
+    }
 }
 
 void RawInputHandler::ProcessRawInputDirect(const RAWINPUT* raw) {
+    ApplyPendingThreadPolicy();
     if (raw && raw->header.dwType == RIM_TYPEMOUSE) {
-        std::lock_guard<std::mutex> lock(m_deltaMutex);
-        m_accumulatedDeltas.x += raw->data.mouse.lLastX;
-        m_accumulatedDeltas.y += raw->data.mouse.lLastY;
+        m_samples.Push(raw->data.mouse.lLastX, raw->data.mouse.lLastY);
         
         // Debug logging for raw input
         if (raw->data.mouse.lLastY != 0) {
-            LOG_DEBUG("RawInput", "Raw mouse Y: " + std::to_string(raw->data.mouse.lLastY) + 
-                      " (accumulated: " + std::to_string(m_accumulatedDeltas.y) + ")");
+            LOG_DEBUG("RawInput", "Raw mouse Y: {} (queued: {})",
+                      raw->data.mouse.lLastY, m_samples.SizeApprox());
         }
     }
 }
 
 void RawInputHandler::ProcessRawInput(LPARAM lParam) {
+    ApplyPendingThreadPolicy();
+    
     UINT dwSize = 0;
     GetRawInputData((HRAWINPUT)lParam, RID_INPUT, nullptr, &dwSize, sizeof(RAWINPUTHEADER));
     
@@ -102,14 +130,12 @@ void RawInputHandler::ProcessRawInput(LPARAM lParam) {
     RAWINPUT* raw = reinterpret_cast<RAWINPUT*>(lpb.data());
     
     if (raw->header.dwType == RIM_TYPEMOUSE) {
-        std::lock_guard<std::mutex> lock(m_deltaMutex);
-        m_accumulatedDeltas.x += raw->data.mouse.lLastX;
-        m_accumulatedDeltas.y += raw->data.mouse.lLastY;
+        m_samples.Push(raw->data.mouse.lLastX, raw->data.mouse.lLastY);
         
         // Debug logging for raw input
         if (raw->data.mouse.lLastY != 0) {
-            LOG_DEBUG("RawInput", "Raw mouse Y: " + std::to_string(raw->data.mouse.lLastY) + 
-                      " (accumulated: " + std::to_string(m_accumulatedDeltas.y) + ")");
+            LOG_DEBUG("RawInput", "Raw mouse Y: {} (queued: {})",
+                      raw->data.mouse.lLastY, m_samples.SizeApprox());
         }
     }
 }
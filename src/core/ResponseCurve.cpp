@@ -0,0 +1,125 @@
+#include "core/ResponseCurve.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Mouse2VR {
+
+const char* ResponseCurveTypeToString(ResponseCurveType type) {
+    switch (type) {
+        case ResponseCurveType::Piecewise: return "piecewise";
+        case ResponseCurveType::Spline: return "spline";
+        case ResponseCurveType::Gamma: return "gamma";
+        case ResponseCurveType::Linear:
+        default: return "linear";
+    }
+}
+
+ResponseCurveType ResponseCurveTypeFromString(const std::string& name) {
+    if (name == "piecewise") return ResponseCurveType::Piecewise;
+    if (name == "spline") return ResponseCurveType::Spline;
+    if (name == "gamma") return ResponseCurveType::Gamma;
+    return ResponseCurveType::Linear;
+}
+
+void ResponseCurve::Compile(const ResponseCurveConfig& config) {
+    m_config = config;
+    m_config.inputMax = std::isfinite(config.inputMax) && config.inputMax > 0.0f ? config.inputMax : 1.0f;
+    m_config.gamma = std::isfinite(config.gamma) ? std::clamp(config.gamma, 0.05f, 20.0f) : 1.0f;
+    
+    // === Normalize control points: sorted, finite, non-negative, with origin ===
+    m_points.clear();
+    for (const CurvePoint& p : config.points) {
+        if (std::isfinite(p.input) && std::isfinite(p.output) && p.input >= 0.0f) {
+            m_points.push_back({p.input, std::max(0.0f, p.output)});
+        }
+    }
+    std::sort(m_points.begin(), m_points.end(),
+              [](const CurvePoint& a, const CurvePoint& b) { return a.input < b.input; });
+    m_points.erase(std::unique(m_points.begin(), m_points.end(),
+                               [](const CurvePoint& a, const CurvePoint& b) { return a.input == b.input; }),
+                   m_points.end());
+    if (m_points.empty() || m_points.front().input > 0.0f) {
+        m_points.insert(m_points.begin(), CurvePoint{0.0f, 0.0f});
+    }
+    
+    // A point-based curve needs a segment; without one fall back to linear
+    bool pointBased = m_config.type == ResponseCurveType::Piecewise || m_config.type == ResponseCurveType::Spline;
+    m_identity = m_config.type == ResponseCurveType::Linear || (pointBased && m_points.size() < 2);
+    if (m_identity) {
+        return;
+    }
+    
+    // === Monotone cubic tangents (Fritsch-Carlson) ===
+    m_tangents.assign(m_points.size(), 0.0f);
+    if (m_config.type == ResponseCurveType::Spline) {
+        size_t n = m_points.size();
+        std::vector<float> slopes(n - 1);
+        for (size_t i = 0; i + 1 < n; ++i) {
+            slopes[i] = (m_points[i + 1].output - m_points[i].output) /
+                        (m_points[i + 1].input - m_points[i].input);
+        }
+        m_tangents[0] = slopes[0];
+        m_tangents[n - 1] = slopes[n - 2];
+        for (size_t i = 1; i + 1 < n; ++i) {
+            m_tangents[i] = slopes[i - 1] * slopes[i] <= 0.0f ? 0.0f : 0.5f * (slopes[i - 1] + slopes[i]);
+        }
+        for (size_t i = 0; i + 1 < n; ++i) {
+            if (slopes[i] == 0.0f) {
+                m_tangents[i] = 0.0f;
+                m_tangents[i + 1] = 0.0f;
+                continue;
+            }
+            float a = m_tangents[i] / slopes[i];
+            float b = m_tangents[i + 1] / slopes[i];
+            float h = a * a + b * b;
+            if (h > 9.0f) {
+                float tau = 3.0f / std::sqrt(h);
+                m_tangents[i] = tau * a * slopes[i];
+                m_tangents[i + 1] = tau * b * slopes[i];
+            }
+        }
+    }
+    
+    // === Sample into the table ===
+    m_indexScale = static_cast<float>(kTableSize) / m_config.inputMax;
+    for (size_t i = 0; i <= kTableSize; ++i) {
+        float input = m_config.inputMax * static_cast<float>(i) / static_cast<float>(kTableSize);
+        m_table[i] = EvaluateExact(input);
+    }
+}
+
+float ResponseCurve::EvaluateExact(float input) const {
+    if (m_identity) {
+        return input;
+    }
+    input = std::clamp(input, 0.0f, m_config.inputMax);
+    
+    if (m_config.type == ResponseCurveType::Gamma) {
+        return std::pow(input / m_config.inputMax, m_config.gamma);
+    }
+    
+    // Segment containing the input; beyond the last point the output holds
+    if (input >= m_points.back().input) {
+        return m_points.back().output;
+    }
+    size_t i = static_cast<size_t>(std::upper_bound(m_points.begin(), m_points.end(), input,
+        [](float value, const CurvePoint& p) { return value < p.input; }) - m_points.begin()) - 1;
+    const CurvePoint& p0 = m_points[i];
+    const CurvePoint& p1 = m_points[i + 1];
+    float h = p1.input - p0.input;
+    float t = (input - p0.input) / h;
+    
+    if (m_config.type == ResponseCurveType::Piecewise) {
+        return p0.output + (p1.output - p0.output) * t;
+    }
+    
+    // Cubic Hermite segment
+    float t2 = t * t;
+    float t3 = t2 * t;
+    return (2.0f * t3 - 3.0f * t2 + 1.0f) * p0.output +
+           (t3 - 2.0f * t2 + t) * h * m_tangents[i] +
+           (-2.0f * t3 + 3.0f * t2) * p1.output +
+           (t3 - t2) * h * m_tangents[i + 1];
+}
+
+} // namespace Mouse2VR
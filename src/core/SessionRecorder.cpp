@@ -0,0 +1,136 @@
+#include "core/SessionRecorder.h"
+#include "common/Logger.h"
+#include <chrono>
+
+namespace Mouse2VR {
+
+namespace {
+constexpr size_t kWriteBatch = 1024;
+constexpr auto kWriterIdleSleep = std::chrono::milliseconds(20);
+}
+
+SessionRecorder::SessionRecorder()
+    : m_ring(std::make_unique<SpscRing<SessionRecord, kRingCapacity>>()) {
+}
+
+SessionRecorder::~SessionRecorder() {
+    Stop();
+}
+
+bool SessionRecorder::Start(const std::string& path, const ProcessingConfig& config, int updateRateHz) {
+    std::lock_guard<std::mutex> lock(m_controlMutex);
+    if (m_recording) {
+        return false;
+    }
+
+    m_file = std::fopen(path.c_str(), "wb");
+    if (!m_file) {
+        LOG_ERROR("Recorder", "Failed to open session file: " + path);
+        return false;
+    }
+
+    m_path = path;
+    m_header = SessionHeader::Create(config, updateRateHz, InputSampleQueue::NowNs());
+    if (std::fwrite(&m_header, sizeof(m_header), 1, m_file) != 1) {
+        LOG_ERROR("Recorder", "Failed to write session header: " + path);
+        std::fclose(m_file);
+        m_file = nullptr;
+        return false;
+    }
+
+    // Discard anything a previous session left behind
+    SessionRecord discard[64];
+    while (m_ring->PopBatch(discard, 64) > 0) {
+    }
+
+    m_writtenCount = 0;
+    m_droppedCount = 0;
+    m_writerRunning = true;
+    m_writerThread = std::thread(&SessionRecorder::WriterLoop, this);
+    m_recording.store(true, std::memory_order_release);
+
+    LOG_INFO("Recorder", "Recording session to " + path);
+    return true;
+}
+
+void SessionRecorder::Stop() {
+    std::lock_guard<std::mutex> lock(m_controlMutex);
+    if (!m_file) {
+        return;
+    }
+
+    m_recording.store(false, std::memory_order_release);
+    m_writerRunning = false;
+    if (m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+    FlushRing();
+
+    // Finalize the header so readers don't have to trust the file size
+    m_header.recordCount = m_writtenCount.load();
+    std::fseek(m_file, 0, SEEK_SET);
+    std::fwrite(&m_header, sizeof(m_header), 1, m_file);
+    std::fclose(m_file);
+    m_file = nullptr;
+
+    LOG_INFO("Recorder", "Session closed: " + std::to_string(m_header.recordCount) + " records, " +
+             std::to_string(m_droppedCount.load()) + " dropped");
+}
+
+void SessionRecorder::RecordSamples(const InputSample* samples, size_t count, uint16_t deviceId) {
+    if (!IsRecording()) {
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        SessionRecord record;
+        record.timestampNs = samples[i].timestampNs;
+        record.dx = samples[i].dx;
+        record.dy = samples[i].dy;
+        record.deviceId = deviceId;
+        record.kind = SessionRecordKind::Sample;
+        Push(record);
+    }
+}
+
+void SessionRecorder::RecordTick(int64_t timestampNs, const MouseDelta& delta, float deltaTime) {
+    if (!IsRecording()) {
+        return;
+    }
+
+    SessionRecord record;
+    record.timestampNs = timestampNs;
+    record.dx = static_cast<int32_t>(delta.x);
+    record.dy = static_cast<int32_t>(delta.y);
+    record.kind = SessionRecordKind::Tick;
+    record.tickSeconds = deltaTime;
+    Push(record);
+}
+
+void SessionRecorder::Push(const SessionRecord& record) {
+    if (!m_ring->TryPush(record)) {
+        m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SessionRecorder::WriterLoop() {
+    while (m_writerRunning) {
+        if (FlushRing() == 0) {
+            std::this_thread::sleep_for(kWriterIdleSleep);
+        }
+    }
+}
+
+size_t SessionRecorder::FlushRing() {
+    SessionRecord batch[kWriteBatch];
+    size_t total = 0;
+    size_t count;
+    while ((count = m_ring->PopBatch(batch, kWriteBatch)) > 0) {
+        size_t written = std::fwrite(batch, sizeof(SessionRecord), count, m_file);
+        m_writtenCount.fetch_add(written, std::memory_order_relaxed);
+        total += count;
+    }
+    return total;
+}
+
+} // namespace Mouse2VR
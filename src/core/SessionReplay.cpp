@@ -0,0 +1,242 @@
+#include "core/SessionReplay.h"
+#include "common/Logger.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <span>
+
+#ifdef _WIN32
+#include "common/WindowsHeaders.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Mouse2VR {
+
+namespace {
+constexpr size_t kReplayBatch = 256;
+}
+
+// === MappedSession ===
+
+MappedSession::~MappedSession() {
+    Close();
+}
+
+bool MappedSession::Open(const std::string& path) {
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR("Replay", "Failed to open session file: " + path);
+        return false;
+    }
+
+    LARGE_INTEGER fileSize = {};
+    GetFileSizeEx(file, &fileSize);
+    if (fileSize.QuadPart < static_cast<LONGLONG>(sizeof(SessionHeader))) {
+        LOG_ERROR("Replay", "Session file too small: " + path);
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        LOG_ERROR("Replay", "Failed to map session file: " + path);
+        if (mapping) CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_fileHandle = file;
+    m_mappingHandle = mapping;
+    m_data = static_cast<const unsigned char*>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LOG_ERROR("Replay", "Failed to open session file: " + path);
+        return false;
+    }
+
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(SessionHeader))) {
+        LOG_ERROR("Replay", "Session file too small: " + path);
+        close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping keeps the file alive
+    if (view == MAP_FAILED) {
+        LOG_ERROR("Replay", "Failed to map session file: " + path);
+        return false;
+    }
+    madvise(view, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+
+    m_data = static_cast<const unsigned char*>(view);
+    m_size = static_cast<size_t>(st.st_size);
+#endif
+
+    if (!GetHeader().IsValid()) {
+        LOG_ERROR("Replay", "Not a Mouse2VR session file: " + path);
+        Close();
+        return false;
+    }
+
+    // A session that was not closed cleanly has recordCount 0; trust the size
+    size_t available = (m_size - sizeof(SessionHeader)) / sizeof(SessionRecord);
+    size_t declared = static_cast<size_t>(GetHeader().recordCount);
+    m_recordCount = declared > 0 ? std::min(declared, available) : available;
+    m_records = reinterpret_cast<const SessionRecord*>(m_data + sizeof(SessionHeader));
+    return true;
+}
+
+void MappedSession::Close() {
+    if (!m_data) {
+        return;
+    }
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_data);
+    CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    CloseHandle(static_cast<HANDLE>(m_fileHandle));
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+#else
+    munmap(const_cast<unsigned char*>(m_data), m_size);
+#endif
+
+    m_data = nullptr;
+    m_size = 0;
+    m_records = nullptr;
+    m_recordCount = 0;
+}
+
+// === ReplayStatsSink ===
+
+void ReplayStatsSink::OnTick(int64_t timestampNs, float stickX, float stickY, float speed) {
+    tickCount++;
+    lastTimestampNs = timestampNs;
+    lastStickX = stickX;
+    lastStickY = stickY;
+    peakSpeed = std::max(peakSpeed, speed);
+    stickYSum += stickY;
+    speedSum += speed;
+}
+
+// === ReplayEngine ===
+
+ReplayResult ReplayEngine::Run(const MappedSession& session, IReplaySink& sink,
+                               const ReplayOptions& options) {
+    InputProcessor processor;
+    processor.SetConfig(session.GetHeader().ToProcessingConfig());
+    return Run(session, processor, sink, options);
+}
+
+ReplayResult ReplayEngine::Run(const MappedSession& session, InputProcessor& processor,
+                               IReplaySink& sink, const ReplayOptions& options) {
+    ReplayResult result;
+    if (!session.IsOpen()) {
+        return result;
+    }
+
+    const auto wallStart = std::chrono::steady_clock::now();
+    const SessionRecord* records = session.GetRecords();
+    const size_t count = session.GetRecordCount();
+
+    // Ticks are collected and run through ProcessBatch, which produces the
+    // same values as per-tick ProcessDelta calls
+    std::array<int64_t, kReplayBatch> batchTimestamps;
+    std::array<MouseDelta, kReplayBatch> batchDeltas;
+    std::array<float, kReplayBatch> batchSeconds;
+    std::array<float, kReplayBatch> batchX, batchY, batchSpeed;
+    size_t batchCount = 0;
+
+    auto flushTicks = [&]() {
+        processor.ProcessBatch(std::span(batchDeltas).first(batchCount), std::span(batchSeconds).first(batchCount),
+                               batchX, batchY, batchSpeed);
+        for (size_t i = 0; i < batchCount; ++i) {
+            sink.OnTick(batchTimestamps[i], batchX[i], batchY[i], batchSpeed[i]);
+        }
+        result.ticks += batchCount;
+        batchCount = 0;
+    };
+
+    auto emitTick = [&](int64_t timestampNs, const MouseDelta& delta, float deltaTime) {
+        batchTimestamps[batchCount] = timestampNs;
+        batchDeltas[batchCount] = delta;
+        batchSeconds[batchCount] = deltaTime;
+        if (++batchCount == kReplayBatch) {
+            flushTicks();
+        }
+    };
+
+    bool hasTicks = false;
+    for (size_t i = 0; i < count && !hasTicks; ++i) {
+        hasTicks = records[i].kind == SessionRecordKind::Tick;
+    }
+
+    int tickRateHz = options.tickRateHz;
+    if (tickRateHz <= 0 && !hasTicks) {
+        tickRateHz = session.GetHeader().updateRateHz > 0
+            ? static_cast<int>(session.GetHeader().updateRateHz) : 60;
+    }
+
+    if (tickRateHz <= 0) {
+        // === Exact reproduction: replay the recorded ProcessDelta calls ===
+        for (size_t i = 0; i < count; ++i) {
+            const SessionRecord& r = records[i];
+            if (r.kind == SessionRecordKind::Tick) {
+                emitTick(r.timestampNs, MouseDelta{r.dx, r.dy}, r.tickSeconds);
+            } else {
+                result.samples++;
+            }
+        }
+    } else {
+        // === Resample raw samples onto a fixed tick grid ===
+        const int64_t intervalNs = 1000000000LL / tickRateHz;
+        const float intervalSeconds = 1.0f / static_cast<float>(tickRateHz);
+        MouseDelta pending;
+        int64_t boundaryNs = 0;
+        bool started = false;
+
+        for (size_t i = 0; i < count; ++i) {
+            const SessionRecord& r = records[i];
+            if (r.kind != SessionRecordKind::Sample) {
+                continue;
+            }
+            if (!started) {
+                boundaryNs = r.timestampNs + intervalNs;
+                started = true;
+            }
+            while (r.timestampNs >= boundaryNs) {
+                emitTick(boundaryNs, pending, intervalSeconds);
+                pending.reset();
+                boundaryNs += intervalNs;
+            }
+            pending.x += r.dx;
+            pending.y += r.dy;
+            result.samples++;
+        }
+        if (started) {
+            emitTick(boundaryNs, pending, intervalSeconds);
+        }
+    }
+
+    flushTicks();
+
+    if (count > 0) {
+        result.sessionSeconds = (records[count - 1].timestampNs - records[0].timestampNs) / 1e9;
+    }
+    result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    return result;
+}
+
+} // namespace Mouse2VR
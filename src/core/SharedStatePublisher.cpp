@@ -0,0 +1,111 @@
+#include "core/SharedStatePublisher.h"
+#include "common/Logger.h"
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+namespace Mouse2VR {
+
+SharedStatePublisher::SharedStatePublisher(std::string name)
+    : m_name(std::move(name)) {
+    std::string object = SharedStateObjectName(m_name);
+    void* view = nullptr;
+#ifdef _WIN32
+    HANDLE mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0,
+                                       sizeof(SharedStateLayout), object.c_str());
+    if (!mapping) {
+        LOG_ERROR("StateChannel", "Failed to create shared memory {}: {}", object, GetLastError());
+        return;
+    }
+    view = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, sizeof(SharedStateLayout));
+    if (!view) {
+        LOG_ERROR("StateChannel", "Failed to map shared memory {}: {}", object, GetLastError());
+        CloseHandle(mapping);
+        return;
+    }
+    m_mapping = mapping;
+#else
+    int fd = shm_open(object.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        LOG_ERROR("StateChannel", "Failed to create shared memory {}", object);
+        return;
+    }
+    if (ftruncate(fd, sizeof(SharedStateLayout)) != 0) {
+        LOG_ERROR("StateChannel", "Failed to size shared memory {}", object);
+        close(fd);
+        return;
+    }
+    view = mmap(nullptr, sizeof(SharedStateLayout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        LOG_ERROR("StateChannel", "Failed to map shared memory {}", object);
+        return;
+    }
+#endif
+    m_layout = static_cast<SharedStateLayout*>(view);
+
+    // A reused segment keeps its sequence, so readers still mapping the old
+    // contents see it move and retry
+    uint64_t sequence = m_layout->magic.load(std::memory_order_relaxed) == SharedStateLayout::kMagic
+        ? m_layout->sequence.load(std::memory_order_relaxed) : 0;
+    if (sequence & 1) {
+        sequence++;  // The previous publisher died mid-write
+    }
+    m_layout->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_layout->version = SharedStateLayout::kVersion;
+    m_layout->size = sizeof(SharedStateLayout);
+    m_layout->tick.store(0, std::memory_order_relaxed);
+    m_layout->running.store(0, std::memory_order_relaxed);
+    m_layout->sequence.store(sequence + 2, std::memory_order_release);
+    m_layout->magic.store(SharedStateLayout::kMagic, std::memory_order_release);
+    LOG_INFO("StateChannel", "Publishing state to shared memory {}", object);
+}
+
+SharedStatePublisher::~SharedStatePublisher() {
+#ifdef _WIN32
+    if (m_layout) {
+        UnmapViewOfFile(m_layout);
+    }
+    if (m_mapping) {
+        CloseHandle(m_mapping);
+    }
+#else
+    if (m_layout) {
+        munmap(m_layout, sizeof(SharedStateLayout));
+    }
+#endif
+}
+
+void SharedStatePublisher::Publish(const SharedStateSnapshot& state) {
+    if (!m_layout) {
+        return;
+    }
+    uint64_t sequence = m_layout->sequence.load(std::memory_order_relaxed);
+    m_layout->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    m_layout->tick.store(++m_tick, std::memory_order_relaxed);
+    m_layout->monotonicNs.store(state.monotonicNs, std::memory_order_relaxed);
+    m_layout->unixTimeNs.store(state.unixTimeNs, std::memory_order_relaxed);
+    m_layout->speed.store(state.speed, std::memory_order_relaxed);
+    m_layout->beltSpeed.store(state.beltSpeed, std::memory_order_relaxed);
+    m_layout->stickX.store(state.stickX, std::memory_order_relaxed);
+    m_layout->stickY.store(state.stickY, std::memory_order_relaxed);
+    m_layout->updateRate.store(state.updateRate, std::memory_order_relaxed);
+    m_layout->running.store(state.running ? 1 : 0, std::memory_order_relaxed);
+
+    m_layout->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool SharedStatePublisher::Remove(const std::string& name) {
+#ifdef _WIN32
+    (void)name;  // Named mappings go away with their last handle
+    return true;
+#else
+    return shm_unlink(SharedStateObjectName(name).c_str()) == 0;
+#endif
+}
+
+} // namespace Mouse2VR
@@ -0,0 +1,83 @@
+#include "core/Telemetry.h"
+#include <cinttypes>
+#include <cstdio>
+
+namespace Mouse2VR {
+
+namespace {
+
+// Fixed-point decimal with trailing zeros trimmed ("1.25", "0", "-0.5")
+void AppendNumber(std::string& out, double value) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.4f", value);
+    if (length <= 0) {
+        out += '0';
+        return;
+    }
+    while (length > 1 && buffer[length - 1] == '0') {
+        length--;
+    }
+    if (buffer[length - 1] == '.') {
+        length--;
+    }
+    if (length == 2 && buffer[0] == '-' && buffer[1] == '0') {
+        length = 1;
+        buffer[0] = '0';
+    }
+    out.append(buffer, static_cast<size_t>(length));
+}
+
+void AppendInteger(std::string& out, int64_t value) {
+    char buffer[24];
+    int length = std::snprintf(buffer, sizeof(buffer), "%" PRId64, value);
+    out.append(buffer, static_cast<size_t>(length));
+}
+
+} // namespace
+
+void TelemetryBatch::AppendJson(std::string& out) const {
+    const int64_t t0 = samples.empty() ? 0 : samples.front().timestampNs;
+    out.reserve(out.size() + 96 + samples.size() * 24);
+
+    out += "{\"type\":\"telemetry\",\"t0\":";
+    AppendNumber(out, t0 / 1e6);
+    out += ",\"hz\":";
+    AppendInteger(out, actualHz);
+    out += ",\"dropped\":";
+    AppendInteger(out, static_cast<int64_t>(dropped));
+
+    out += ",\"t\":[";
+    for (size_t i = 0; i < samples.size(); ++i) {
+        if (i > 0) {
+            out += ',';
+        }
+        AppendInteger(out, (samples[i].timestampNs - t0) / 1000);
+    }
+    out += "],\"speed\":[";
+    for (size_t i = 0; i < samples.size(); ++i) {
+        if (i > 0) {
+            out += ',';
+        }
+        AppendNumber(out, samples[i].speed);
+    }
+    out += "],\"stickY\":[";
+    for (size_t i = 0; i < samples.size(); ++i) {
+        if (i > 0) {
+            out += ',';
+        }
+        AppendNumber(out, samples[i].stickY);
+    }
+    out += "]}";
+}
+
+size_t TelemetryBuffer::Drain(TelemetryBatch& batch) {
+    size_t count = m_ring.ConsumeAll([&batch](const TelemetrySample& sample) {
+        batch.samples.push_back(sample);
+    });
+    uint64_t dropped = m_dropped.load(std::memory_order_relaxed);
+    batch.dropped += dropped - m_reportedDropped;
+    m_reportedDropped = dropped;
+    return count;
+}
+
+} // namespace Mouse2VR
@@ -0,0 +1,211 @@
+#include "common/ThreadPolicy.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#if defined(_WIN32)
+#include "common/WindowsHeaders.h"
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Mouse2VR {
+
+namespace {
+
+void AddFailure(std::string& failures, const std::string& message) {
+    if (!failures.empty()) {
+        failures += "; ";
+    }
+    failures += message;
+}
+
+#if defined(_WIN32)
+int WindowsPriorityFor(ThreadPriority priority) {
+    switch (priority) {
+        case ThreadPriority::AboveNormal: return THREAD_PRIORITY_ABOVE_NORMAL;
+        case ThreadPriority::High: return THREAD_PRIORITY_HIGHEST;
+        case ThreadPriority::TimeCritical: return THREAD_PRIORITY_TIME_CRITICAL;
+        default: return THREAD_PRIORITY_NORMAL;
+    }
+}
+
+ThreadPriority PriorityForWindows(int priority) {
+    if (priority >= THREAD_PRIORITY_TIME_CRITICAL) return ThreadPriority::TimeCritical;
+    if (priority >= THREAD_PRIORITY_HIGHEST) return ThreadPriority::High;
+    if (priority >= THREAD_PRIORITY_ABOVE_NORMAL) return ThreadPriority::AboveNormal;
+    return ThreadPriority::Normal;
+}
+#else
+int NiceFor(ThreadPriority priority) {
+    switch (priority) {
+        case ThreadPriority::AboveNormal: return -5;
+        case ThreadPriority::High: return -10;
+        case ThreadPriority::TimeCritical: return -20;
+        default: return 0;
+    }
+}
+
+ThreadPriority PriorityForNice(int nice) {
+    if (nice <= -20) return ThreadPriority::TimeCritical;
+    if (nice <= -10) return ThreadPriority::High;
+    if (nice <= -5) return ThreadPriority::AboveNormal;
+    return ThreadPriority::Normal;
+}
+
+// Nice values are per thread on Linux, addressed by kernel thread id
+id_t CurrentThreadId() {
+    return static_cast<id_t>(syscall(SYS_gettid));
+}
+#endif
+
+} // namespace
+
+const char* ThreadPriorityToString(ThreadPriority priority) {
+    switch (priority) {
+        case ThreadPriority::Normal: return "normal";
+        case ThreadPriority::AboveNormal: return "above-normal";
+        case ThreadPriority::High: return "high";
+        case ThreadPriority::TimeCritical: return "time-critical";
+    }
+    return "normal";
+}
+
+ThreadPriority ThreadPriorityFromString(const std::string& name) {
+    if (name == "above-normal") return ThreadPriority::AboveNormal;
+    if (name == "high") return ThreadPriority::High;
+    if (name == "time-critical") return ThreadPriority::TimeCritical;
+    return ThreadPriority::Normal;
+}
+
+const char* ThreadSchedulerToString(ThreadScheduler scheduler) {
+    switch (scheduler) {
+        case ThreadScheduler::Normal: return "normal";
+        case ThreadScheduler::Fifo: return "fifo";
+        case ThreadScheduler::RoundRobin: return "rr";
+    }
+    return "normal";
+}
+
+ThreadScheduler ThreadSchedulerFromString(const std::string& name) {
+    if (name == "fifo") return ThreadScheduler::Fifo;
+    if (name == "rr") return ThreadScheduler::RoundRobin;
+    return ThreadScheduler::Normal;
+}
+
+AppliedThreadPolicy ApplyThreadPolicy(const ThreadPolicyConfig& policy) {
+    std::string failures;
+
+#if defined(_WIN32)
+    HANDLE thread = GetCurrentThread();
+    if (policy.affinityMask != 0 &&
+        SetThreadAffinityMask(thread, static_cast<DWORD_PTR>(policy.affinityMask)) == 0) {
+        AddFailure(failures, "affinity: error " + std::to_string(GetLastError()));
+    }
+    if (policy.scheduler != ThreadScheduler::Normal) {
+        AddFailure(failures, "scheduler: real-time classes are Linux-only");
+    }
+    if (policy.priority != ThreadPriority::Normal &&
+        !SetThreadPriority(thread, WindowsPriorityFor(policy.priority))) {
+        AddFailure(failures, "priority: error " + std::to_string(GetLastError()));
+    }
+#else
+    if (policy.affinityMask != 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu) {
+            if ((policy.affinityMask >> cpu) & 1) {
+                CPU_SET(cpu, &set);
+            }
+        }
+        int err = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+        if (err != 0) {
+            AddFailure(failures, std::string("affinity: ") + std::strerror(err));
+        }
+    }
+    if (policy.scheduler != ThreadScheduler::Normal) {
+        int schedPolicy = policy.scheduler == ThreadScheduler::Fifo ? SCHED_FIFO : SCHED_RR;
+        sched_param param = {};
+        param.sched_priority = std::clamp(policy.realtimePriority,
+                                          sched_get_priority_min(schedPolicy), sched_get_priority_max(schedPolicy));
+        int err = pthread_setschedparam(pthread_self(), schedPolicy, &param);
+        if (err != 0) {
+            AddFailure(failures, std::string("scheduler: ") + std::strerror(err));
+        }
+    } else if (policy.priority != ThreadPriority::Normal) {
+        if (setpriority(PRIO_PROCESS, CurrentThreadId(), NiceFor(policy.priority)) != 0) {
+            AddFailure(failures, std::string("priority: ") + std::strerror(errno));
+        }
+    }
+#endif
+
+    AppliedThreadPolicy result = QueryThreadPolicy();
+    result.applied = true;
+    result.failures = failures;
+    return result;
+}
+
+AppliedThreadPolicy QueryThreadPolicy() {
+    AppliedThreadPolicy result;
+
+#if defined(_WIN32)
+    HANDLE thread = GetCurrentThread();
+    int priority = GetThreadPriority(thread);
+    if (priority != THREAD_PRIORITY_ERROR_RETURN) {
+        result.priority = PriorityForWindows(priority);
+    }
+    // Windows only reports a thread's affinity when it is changed, so set
+    // it to the process mask and straight back
+    DWORD_PTR processMask = 0;
+    DWORD_PTR systemMask = 0;
+    if (GetProcessAffinityMask(GetCurrentProcess(), &processMask, &systemMask)) {
+        DWORD_PTR current = SetThreadAffinityMask(thread, processMask);
+        if (current != 0) {
+            SetThreadAffinityMask(thread, current);
+            result.affinityMask = static_cast<uint64_t>(current);
+        }
+    }
+#else
+    int schedPolicy = SCHED_OTHER;
+    sched_param param = {};
+    if (pthread_getschedparam(pthread_self(), &schedPolicy, &param) == 0) {
+        result.scheduler = schedPolicy == SCHED_FIFO ? ThreadScheduler::Fifo
+                         : schedPolicy == SCHED_RR ? ThreadScheduler::RoundRobin
+                         : ThreadScheduler::Normal;
+        result.realtimePriority = param.sched_priority;
+    }
+    errno = 0;
+    int nice = getpriority(PRIO_PROCESS, CurrentThreadId());
+    if (errno == 0) {
+        result.priority = PriorityForNice(nice);
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                result.affinityMask |= uint64_t{1} << cpu;
+            }
+        }
+    }
+#endif
+
+    return result;
+}
+
+bool LockProcessMemory() {
+#if defined(_WIN32)
+    // No mlockall: pin a minimum working set large enough for the process
+    return SetProcessWorkingSetSizeEx(GetCurrentProcess(), 64 * 1024 * 1024, 512 * 1024 * 1024,
+                                      QUOTA_LIMITS_HARDWS_MIN_ENABLE | QUOTA_LIMITS_HARDWS_MAX_DISABLE) != 0;
+#else
+    return mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+#endif
+}
+
+} // namespace Mouse2VR
@@ -0,0 +1,196 @@
+#include "common/UdpSocket.h"
+
+#ifdef _WIN32
+#include "common/WindowsHeaders.h"
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace Mouse2VR {
+
+namespace {
+
+#ifdef _WIN32
+using NativeSocket = SOCKET;
+
+struct WinsockInit {
+    WinsockInit() { WSADATA data; ok = WSAStartup(MAKEWORD(2, 2), &data) == 0; }
+    ~WinsockInit() { if (ok) WSACleanup(); }
+    bool ok = false;
+};
+
+bool EnsureWinsock() {
+    static WinsockInit init;
+    return init.ok;
+}
+#else
+using NativeSocket = int;
+#endif
+
+NativeSocket Native(intptr_t s) { return static_cast<NativeSocket>(s); }
+
+sockaddr_in MakeAddress(uint32_t address, uint16_t port) {
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(address);
+    return addr;
+}
+
+} // namespace
+
+UdpSocket::UdpSocket() {
+#ifdef _WIN32
+    if (!EnsureWinsock()) {
+        return;
+    }
+    SOCKET s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    m_socket = s == INVALID_SOCKET ? kInvalidSocket : static_cast<intptr_t>(s);
+#else
+    int s = socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, IPPROTO_UDP);
+    m_socket = s < 0 ? kInvalidSocket : s;
+#endif
+}
+
+UdpSocket::~UdpSocket() {
+    if (!IsOpen()) {
+        return;
+    }
+#ifdef _WIN32
+    closesocket(Native(m_socket));
+#else
+    close(Native(m_socket));
+#endif
+}
+
+bool UdpSocket::ParseAddress(const std::string& host, uint32_t& address) {
+    in_addr parsed = {};
+    if (inet_pton(AF_INET, host.c_str(), &parsed) != 1) {
+        return false;
+    }
+    address = ntohl(parsed.s_addr);
+    return true;
+}
+
+bool UdpSocket::Bind(const std::string& host, uint16_t port) {
+    uint32_t address = 0;
+    if (!IsOpen() || !ParseAddress(host, address)) {
+        return false;
+    }
+    sockaddr_in addr = MakeAddress(address, port);
+    return bind(Native(m_socket), reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == 0;
+}
+
+bool UdpSocket::Connect(const std::string& host, uint16_t port) {
+    uint32_t address = 0;
+    if (!IsOpen() || !ParseAddress(host, address)) {
+        return false;
+    }
+    sockaddr_in addr = MakeAddress(address, port);
+    return connect(Native(m_socket), reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) == 0;
+}
+
+uint16_t UdpSocket::GetLocalPort() const {
+    if (!IsOpen()) {
+        return 0;
+    }
+    sockaddr_in addr = {};
+#ifdef _WIN32
+    int addrLen = sizeof(addr);
+#else
+    socklen_t addrLen = sizeof(addr);
+#endif
+    if (getsockname(Native(m_socket), reinterpret_cast<sockaddr*>(&addr), &addrLen) != 0) {
+        return 0;
+    }
+    return ntohs(addr.sin_port);
+}
+
+bool UdpSocket::SetNonBlocking() {
+    if (!IsOpen()) {
+        return false;
+    }
+#ifdef _WIN32
+    u_long nonBlocking = 1;
+    return ioctlsocket(Native(m_socket), FIONBIO, &nonBlocking) == 0;
+#else
+    int flags = fcntl(Native(m_socket), F_GETFL);
+    return flags >= 0 && fcntl(Native(m_socket), F_SETFL, flags | O_NONBLOCK) == 0;
+#endif
+}
+
+void UdpSocket::SetReceiveBufferSize(int bytes) {
+    if (IsOpen()) {
+        setsockopt(Native(m_socket), SOL_SOCKET, SO_RCVBUF, reinterpret_cast<const char*>(&bytes), sizeof(bytes));
+    }
+}
+
+bool UdpSocket::Send(const void* data, size_t size) {
+    if (!IsOpen()) {
+        return false;
+    }
+#ifdef _WIN32
+    int sent = send(Native(m_socket), static_cast<const char*>(data), static_cast<int>(size), 0);
+#else
+    ssize_t sent = send(Native(m_socket), data, size, 0);
+#endif
+    return sent == static_cast<decltype(sent)>(size);
+}
+
+bool UdpSocket::SendTo(const void* data, size_t size, uint32_t address, uint16_t port) {
+    if (!IsOpen()) {
+        return false;
+    }
+    sockaddr_in addr = MakeAddress(address, port);
+#ifdef _WIN32
+    int sent = sendto(Native(m_socket), static_cast<const char*>(data), static_cast<int>(size), 0,
+                      reinterpret_cast<const sockaddr*>(&addr), sizeof(addr));
+#else
+    ssize_t sent = sendto(Native(m_socket), data, size, 0, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr));
+#endif
+    return sent == static_cast<decltype(sent)>(size);
+}
+
+int UdpSocket::Receive(void* buffer, size_t capacity) {
+    if (!IsOpen()) {
+        return -1;
+    }
+#ifdef _WIN32
+    int received = recv(Native(m_socket), static_cast<char*>(buffer), static_cast<int>(capacity), 0);
+    if (received < 0 && WSAGetLastError() == WSAEMSGSIZE) {
+        return static_cast<int>(capacity);  // Truncated datagram
+    }
+    return received;
+#else
+    // MSG_TRUNC reports the full size, so oversized datagrams can be told apart
+    ssize_t received = recv(Native(m_socket), buffer, capacity, MSG_TRUNC);
+    return static_cast<int>(received);
+#endif
+}
+
+bool UdpSocket::WaitReadable(int timeoutMs) {
+    if (!IsOpen()) {
+        return false;
+    }
+#ifdef _WIN32
+    WSAPOLLFD pfd = {};
+    pfd.fd = Native(m_socket);
+    pfd.events = POLLRDNORM;
+    return WSAPoll(&pfd, 1, timeoutMs) > 0;
+#else
+    pollfd pfd = {};
+    pfd.fd = Native(m_socket);
+    pfd.events = POLLIN;
+    return poll(&pfd, 1, timeoutMs) > 0;
+#endif
+}
+
+} // namespace Mouse2VR
@@ -0,0 +1,252 @@
+#include "core/UdpStickStream.h"
+#include "core/InputSampleQueue.h"
+#include "common/Logger.h"
+#include <cstring>
+
+namespace Mouse2VR {
+
+namespace {
+
+void Put16(uint8_t* out, uint16_t value) {
+    out[0] = static_cast<uint8_t>(value);
+    out[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void Put32(uint8_t* out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+void Put64(uint8_t* out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+void PutFloat(uint8_t* out, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    Put32(out, bits);
+}
+
+uint16_t Get16(const uint8_t* in) {
+    return static_cast<uint16_t>(in[0] | (in[1] << 8));
+}
+
+uint32_t Get32(const uint8_t* in) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; ++i) {
+        value |= static_cast<uint32_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+uint64_t Get64(const uint8_t* in) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; ++i) {
+        value |= static_cast<uint64_t>(in[i]) << (8 * i);
+    }
+    return value;
+}
+
+float GetFloat(const uint8_t* in) {
+    uint32_t bits = Get32(in);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+// === StickStatePacket ===
+
+void StickStatePacket::Encode(uint8_t (&out)[kSize]) const {
+    Put32(out, kMagic);
+    Put16(out + 4, kVersion);
+    Put16(out + 6, 0);
+    Put32(out + 8, sequence);
+    Put64(out + 12, static_cast<uint64_t>(timestampNs));
+    PutFloat(out + 20, stickX);
+    PutFloat(out + 24, stickY);
+    PutFloat(out + 28, speed);
+}
+
+bool StickStatePacket::Decode(const uint8_t* data, size_t size, StickStatePacket& packet) {
+    if (size != kSize || Get32(data) != kMagic || Get16(data + 4) != kVersion) {
+        return false;
+    }
+    packet.sequence = Get32(data + 8);
+    packet.timestampNs = static_cast<int64_t>(Get64(data + 12));
+    packet.stickX = GetFloat(data + 20);
+    packet.stickY = GetFloat(data + 24);
+    packet.speed = GetFloat(data + 28);
+    return true;
+}
+
+// === UdpStickSink ===
+
+UdpStickSink::UdpStickSink(std::string host, uint16_t port, std::shared_ptr<IClock> clock)
+    : m_host(std::move(host)), m_port(port), m_clock(std::move(clock)) {}
+
+bool UdpStickSink::Initialize() {
+    if (!m_socket.IsOpen()) {
+        LOG_ERROR("UdpStickSink", "Failed to create UDP socket");
+        return false;
+    }
+    if (!m_socket.Connect(m_host, m_port)) {
+        LOG_ERROR("UdpStickSink", "Invalid destination {}:{}", m_host, m_port);
+        return false;
+    }
+    m_socket.SetNonBlocking();
+    m_connected = true;
+    LOG_INFO("UdpStickSink", "Streaming stick state to {}:{}", m_host, m_port);
+    return true;
+}
+
+void UdpStickSink::Shutdown() {
+    m_connected = false;
+}
+
+void UdpStickSink::SetLeftStick(float x, float y) {
+    m_x = x;
+    m_y = y;
+}
+
+void UdpStickSink::Update() {
+    if (!m_connected) {
+        return;
+    }
+    StickStatePacket packet;
+    packet.sequence = m_sequence++;
+    packet.timestampNs = m_clock ? m_clock->NowNs() : InputSampleQueue::NowNs();
+    packet.stickX = m_x;
+    packet.stickY = m_y;
+    packet.speed = m_speed;
+    packet.Encode(m_buffer);
+
+    // A refused or full send is counted and dropped; the next tick carries
+    // the newer state anyway
+    if (m_socket.Send(m_buffer, sizeof(m_buffer))) {
+        m_sent.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        m_failedSends.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+// === StickStateReceiver ===
+
+StickStateReceiver::StickStateReceiver(uint16_t port, const std::string& host) {
+    if (!m_socket.IsOpen()) {
+        LOG_ERROR("StickStream", "Failed to create UDP socket");
+        return;
+    }
+    if (!m_socket.Bind(host, port)) {
+        LOG_ERROR("StickStream", "Failed to bind {}:{}", host, port);
+        return;
+    }
+    m_socket.SetNonBlocking();
+    m_socket.SetReceiveBufferSize(1 << 20);
+    m_port = m_socket.GetLocalPort();
+    m_open = true;
+    LOG_INFO("StickStream", "Listening for stick state on {}:{}", host, m_port);
+}
+
+int StickStateReceiver::Poll() {
+    if (!IsOpen()) {
+        return 0;
+    }
+    // Larger than a packet so oversized datagrams are seen and rejected
+    uint8_t buffer[64];
+    int accepted = 0;
+    for (;;) {
+        int received = m_socket.Receive(buffer, sizeof(buffer));
+        if (received < 0) {
+            break;
+        }
+        if (OnPacket(buffer, static_cast<size_t>(received), InputSampleQueue::NowNs())) {
+            accepted++;
+        }
+    }
+    return accepted;
+}
+
+int StickStateReceiver::Wait(int timeoutMs) {
+    if (!IsOpen()) {
+        return 0;
+    }
+    m_socket.WaitReadable(timeoutMs);
+    return Poll();
+}
+
+bool StickStateReceiver::OnPacket(const uint8_t* data, size_t size, int64_t arrivalNs) {
+    StickStatePacket packet;
+    if (!StickStatePacket::Decode(data, size, packet)) {
+        m_stats.rejected++;
+        return false;
+    }
+    m_stats.received++;
+    m_transit.Record(arrivalNs - packet.timestampNs);
+
+    if (m_state.valid) {
+        int32_t ahead = static_cast<int32_t>(packet.sequence - m_state.sequence);
+        if (ahead == 0) {
+            m_stats.duplicates++;
+            return false;
+        }
+        if (ahead < 0) {
+            uint32_t age = static_cast<uint32_t>(-static_cast<int64_t>(ahead));
+            // Until the window has moved past the first packet it also covers
+            // sequence numbers that were never expected
+            bool beforeStart = m_state.sequence - m_firstSequence < static_cast<uint32_t>(kWindow) &&
+                               static_cast<int32_t>(packet.sequence - m_firstSequence) < 0;
+            if (age >= static_cast<uint32_t>(kWindow) || beforeStart) {
+                m_stats.stale++;
+                if (++m_staleRun < kResyncAfterStale) {
+                    return false;
+                }
+                // Several packets far behind in a row: the sender restarted
+                m_stats.resyncs++;
+                m_state.valid = false;
+            } else {
+                m_staleRun = 0;
+                uint64_t bit = uint64_t{1} << age;
+                if (m_window & bit) {
+                    m_stats.duplicates++;
+                } else {
+                    m_window |= bit;
+                    m_stats.reordered++;
+                    if (m_stats.lost > 0) {
+                        m_stats.lost--;
+                    }
+                }
+                return false;
+            }
+        } else {
+            m_stats.lost += static_cast<uint64_t>(ahead) - 1;
+            m_window = ahead >= kWindow ? 0 : m_window << ahead;
+        }
+    }
+    if (!m_state.valid) {
+        m_window = 0;
+        m_firstSequence = packet.sequence;
+    }
+    m_staleRun = 0;
+    m_window |= 1;
+
+    m_state.valid = true;
+    m_state.sequence = packet.sequence;
+    m_state.timestampNs = packet.timestampNs;
+    m_state.arrivalNs = arrivalNs;
+    m_state.stickX = packet.stickX;
+    m_state.stickY = packet.stickY;
+    m_state.speed = packet.speed;
+    return true;
+}
+
+void StickStateReceiver::ResetStats() {
+    m_stats = StickStreamStats{};
+    m_transit.Reset();
+}
+
+} // namespace Mouse2VR
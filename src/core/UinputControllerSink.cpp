@@ -0,0 +1,162 @@
+#include "core/UinputControllerSink.h"
+#include "common/Logger.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/uinput.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace Mouse2VR {
+
+namespace {
+
+constexpr uint16_t kAxisCodes[] = {ABS_X, ABS_Y, ABS_RX, ABS_RY};
+
+} // namespace
+
+UinputControllerSink::UinputControllerSink(std::string devicePath)
+    : m_devicePath(std::move(devicePath)) {
+}
+
+UinputControllerSink::UinputControllerSink(int fd, std::string name)
+    : m_devicePath(std::move(name))
+    , m_fd(fd)
+    , m_ownsDevice(false) {
+}
+
+UinputControllerSink::~UinputControllerSink() {
+    Shutdown();
+}
+
+bool UinputControllerSink::Initialize() {
+    if (m_connected) {
+        return true;
+    }
+
+    if (m_ownsDevice && !CreateDevice()) {
+        CloseDevice();
+        return false;
+    }
+    if (m_fd < 0) {
+        return false;
+    }
+
+    std::fill(std::begin(m_axes), std::end(m_axes), 0);
+    m_sentAny = false;
+    m_connected = true;
+    LOG_INFO("Uinput", "Virtual gamepad ready on " + m_devicePath);
+    return true;
+}
+
+void UinputControllerSink::Shutdown() {
+    m_connected = false;
+    CloseDevice();
+}
+
+void UinputControllerSink::SetLeftStick(float x, float y) {
+    m_axes[LeftX] = FloatToAxis(x);
+    m_axes[LeftY] = FloatToAxis(-y);
+}
+
+void UinputControllerSink::SetRightStick(float x, float y) {
+    m_axes[RightX] = FloatToAxis(x);
+    m_axes[RightY] = FloatToAxis(-y);
+}
+
+void UinputControllerSink::Update() {
+    if (!m_connected) {
+        return;
+    }
+
+    // === Changed axes and the SYN_REPORT go out in one write() ===
+    size_t count = 0;
+    for (int axis = 0; axis < AxisCount; ++axis) {
+        if (m_sentAny && m_axes[axis] == m_sentAxes[axis]) {
+            continue;
+        }
+        input_event& ev = m_batch[count++];
+        ev.type = EV_ABS;
+        ev.code = kAxisCodes[axis];
+        ev.value = m_axes[axis];
+    }
+    if (count == 0) {
+        m_unchangedCount.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    input_event& syn = m_batch[count++];
+    syn.type = EV_SYN;
+    syn.code = SYN_REPORT;
+    syn.value = 0;
+
+    const size_t bytes = count * sizeof(input_event);
+    ssize_t written = write(m_fd, m_batch, bytes);
+    if (written != static_cast<ssize_t>(bytes)) {
+        // uinput takes whole reports or nothing; a full pipe may not
+        m_failedWrites.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    std::copy(std::begin(m_axes), std::end(m_axes), std::begin(m_sentAxes));
+    m_sentAny = true;
+    m_writeCount.fetch_add(1, std::memory_order_relaxed);
+    m_eventCount.fetch_add(count, std::memory_order_relaxed);
+}
+
+int32_t UinputControllerSink::FloatToAxis(float value) {
+    value = std::max(-1.0f, std::min(1.0f, value));
+    return static_cast<int32_t>(value * static_cast<float>(kAxisMax));
+}
+
+bool UinputControllerSink::CreateDevice() {
+    m_fd = open(m_devicePath.c_str(), O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+    if (m_fd < 0) {
+        LOG_ERROR("Uinput", "Failed to open " + m_devicePath + ": " + std::strerror(errno) +
+                  " (needs write access, e.g. the input group or a udev rule)");
+        return false;
+    }
+
+    // A single button makes udev tag the device as a joystick
+    if (ioctl(m_fd, UI_SET_EVBIT, EV_KEY) < 0 || ioctl(m_fd, UI_SET_KEYBIT, BTN_SOUTH) < 0 ||
+        ioctl(m_fd, UI_SET_EVBIT, EV_ABS) < 0) {
+        LOG_ERROR("Uinput", std::string("Failed to enable event types: ") + std::strerror(errno));
+        return false;
+    }
+    for (uint16_t code : kAxisCodes) {
+        uinput_abs_setup abs = {};
+        abs.code = code;
+        abs.absinfo.minimum = kAxisMin;
+        abs.absinfo.maximum = kAxisMax;
+        if (ioctl(m_fd, UI_SET_ABSBIT, code) < 0 || ioctl(m_fd, UI_ABS_SETUP, &abs) < 0) {
+            LOG_ERROR("Uinput", std::string("Failed to set up axis: ") + std::strerror(errno));
+            return false;
+        }
+    }
+
+    uinput_setup setup = {};
+    setup.id.bustype = BUS_VIRTUAL;
+    setup.id.vendor = 0x045e;   // Microsoft
+    setup.id.product = 0x028e;  // Xbox 360 controller
+    setup.id.version = 1;
+    std::strncpy(setup.name, "Mouse2VR Virtual Gamepad", UINPUT_MAX_NAME_SIZE - 1);
+    if (ioctl(m_fd, UI_DEV_SETUP, &setup) < 0 || ioctl(m_fd, UI_DEV_CREATE) < 0) {
+        LOG_ERROR("Uinput", std::string("Failed to create device: ") + std::strerror(errno));
+        return false;
+    }
+    m_created = true;
+    return true;
+}
+
+void UinputControllerSink::CloseDevice() {
+    if (m_fd < 0) {
+        return;
+    }
+    if (m_created) {
+        ioctl(m_fd, UI_DEV_DESTROY);
+        m_created = false;
+    }
+    close(m_fd);
+    m_fd = -1;
+}
+
+} // namespace Mouse2VR
@@ -0,0 +1,166 @@
+#include "core/VelocityEstimator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Mouse2VR {
+
+namespace {
+
+constexpr float kTwoPi = 6.28318530718f;
+
+// Smoothing factor for a first-order low-pass with the given cutoff
+float LowPassAlpha(float cutoffHz, float deltaTime) {
+    float tau = 1.0f / (kTwoPi * cutoffHz);
+    return 1.0f / (1.0f + tau / deltaTime);
+}
+
+} // namespace
+
+const char* VelocityFilterToString(VelocityFilter filter) {
+    switch (filter) {
+        case VelocityFilter::Ema: return "ema";
+        case VelocityFilter::OneEuro: return "oneEuro";
+        case VelocityFilter::AlphaBeta: return "alphaBeta";
+        case VelocityFilter::Median: return "median";
+        case VelocityFilter::None:
+        default: return "none";
+    }
+}
+
+VelocityFilter VelocityFilterFromString(const std::string& name) {
+    if (name == "ema") return VelocityFilter::Ema;
+    if (name == "oneEuro") return VelocityFilter::OneEuro;
+    if (name == "alphaBeta") return VelocityFilter::AlphaBeta;
+    if (name == "median") return VelocityFilter::Median;
+    return VelocityFilter::None;
+}
+
+bool VelocityEstimatorConfig::operator==(const VelocityEstimatorConfig& other) const {
+    return filter == other.filter &&
+           emaTimeConstant == other.emaTimeConstant &&
+           oneEuroMinCutoff == other.oneEuroMinCutoff &&
+           oneEuroBeta == other.oneEuroBeta &&
+           oneEuroDerivativeCutoff == other.oneEuroDerivativeCutoff &&
+           alphaBetaAlpha == other.alphaBetaAlpha &&
+           alphaBetaBeta == other.alphaBetaBeta &&
+           medianWindow == other.medianWindow;
+}
+
+void VelocityEstimator::Configure(const VelocityEstimatorConfig& config) {
+    VelocityEstimatorConfig sanitized = config;
+    sanitized.emaTimeConstant = std::max(0.0f, sanitized.emaTimeConstant);
+    sanitized.oneEuroMinCutoff = std::max(0.001f, sanitized.oneEuroMinCutoff);
+    sanitized.oneEuroBeta = std::max(0.0f, sanitized.oneEuroBeta);
+    sanitized.oneEuroDerivativeCutoff = std::max(0.001f, sanitized.oneEuroDerivativeCutoff);
+    sanitized.alphaBetaAlpha = std::clamp(sanitized.alphaBetaAlpha, 0.0f, 1.0f);
+    sanitized.alphaBetaBeta = std::clamp(sanitized.alphaBetaBeta, 0.0f, 2.0f);
+    sanitized.medianWindow = std::clamp(sanitized.medianWindow, 1, kMaxMedianWindow);
+    
+    // Retuning keeps the current estimate; switching filters starts over
+    bool restart = sanitized.filter != m_config.filter ||
+                   sanitized.medianWindow != m_config.medianWindow;
+    m_config = sanitized;
+    if (restart) {
+        Reset();
+    }
+}
+
+void VelocityEstimator::Reset() {
+    m_initialized = false;
+    m_velocity = 0.0f;
+    m_acceleration = 0.0f;
+    m_historyCount = 0;
+    m_historyNext = 0;
+}
+
+float VelocityEstimator::Update(float measured, float deltaTime) {
+    if (!(deltaTime > 0.0f) || !std::isfinite(measured)) {
+        return m_velocity;
+    }
+    
+    switch (m_config.filter) {
+        case VelocityFilter::Ema: m_velocity = UpdateEma(measured, deltaTime); break;
+        case VelocityFilter::OneEuro: m_velocity = UpdateOneEuro(measured, deltaTime); break;
+        case VelocityFilter::AlphaBeta: m_velocity = UpdateAlphaBeta(measured, deltaTime); break;
+        case VelocityFilter::Median: m_velocity = UpdateMedian(measured); break;
+        case VelocityFilter::None:
+        default: m_velocity = measured; break;
+    }
+    m_initialized = true;
+    return m_velocity;
+}
+
+float VelocityEstimator::UpdateEma(float measured, float deltaTime) {
+    if (!m_initialized) {
+        return measured;
+    }
+    // dt-aware factor so the time constant holds at any tick rate
+    float alpha = deltaTime / (m_config.emaTimeConstant + deltaTime);
+    return m_velocity + alpha * (measured - m_velocity);
+}
+
+float VelocityEstimator::UpdateOneEuro(float measured, float deltaTime) {
+    if (!m_initialized) {
+        m_acceleration = 0.0f;
+        return measured;
+    }
+    
+    // Smoothed derivative drives the cutoff: fast changes open the filter up
+    float rawDerivative = (measured - m_velocity) / deltaTime;
+    float derivativeAlpha = LowPassAlpha(m_config.oneEuroDerivativeCutoff, deltaTime);
+    m_acceleration += derivativeAlpha * (rawDerivative - m_acceleration);
+    
+    float cutoff = m_config.oneEuroMinCutoff + m_config.oneEuroBeta * std::abs(m_acceleration);
+    float alpha = LowPassAlpha(cutoff, deltaTime);
+    return m_velocity + alpha * (measured - m_velocity);
+}
+
+float VelocityEstimator::UpdateAlphaBeta(float measured, float deltaTime) {
+    if (!m_initialized) {
+        m_acceleration = 0.0f;
+        return measured;
+    }
+    
+    // Predict with the current acceleration, then correct by the residual
+    float predicted = m_velocity + m_acceleration * deltaTime;
+    float residual = measured - predicted;
+    m_acceleration += m_config.alphaBetaBeta * residual / deltaTime;
+    return predicted + m_config.alphaBetaAlpha * residual;
+}
+
+float VelocityEstimator::UpdateMedian(float measured) {
+    const int window = m_config.medianWindow;
+    
+    if (m_historyCount < window) {
+        // Filling: insert into the sorted prefix
+        int pos = m_historyCount;
+        while (pos > 0 && m_sorted[pos - 1] > measured) {
+            m_sorted[pos] = m_sorted[pos - 1];
+            --pos;
+        }
+        m_sorted[pos] = measured;
+        m_history[m_historyCount++] = measured;
+        m_historyNext = m_historyCount % window;
+    } else {
+        // Replace the oldest value in place, then bubble it into order
+        float oldest = m_history[m_historyNext];
+        m_history[m_historyNext] = measured;
+        m_historyNext = (m_historyNext + 1) % window;
+        
+        int pos = static_cast<int>(std::find(m_sorted.begin(), m_sorted.begin() + window, oldest) - m_sorted.begin());
+        m_sorted[pos] = measured;
+        while (pos > 0 && m_sorted[pos - 1] > m_sorted[pos]) {
+            std::swap(m_sorted[pos - 1], m_sorted[pos]);
+            --pos;
+        }
+        while (pos + 1 < window && m_sorted[pos + 1] < m_sorted[pos]) {
+            std::swap(m_sorted[pos + 1], m_sorted[pos]);
+            ++pos;
+        }
+    }
+    
+    int n = m_historyCount;
+    return (n % 2 == 1) ? m_sorted[n / 2] : 0.5f * (m_sorted[n / 2 - 1] + m_sorted[n / 2]);
+}
+
+} // namespace Mouse2VR
@@ -0,0 +1,69 @@
+#include "core/VelocityPredictor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Mouse2VR {
+
+void VelocityPredictor::Configure(const PredictionConfig& config) {
+    PredictionConfig sanitized = config;
+    sanitized.horizonMs = std::clamp(sanitized.horizonMs, 0.0f, 200.0f);
+    sanitized.accelerationTimeConstant = std::max(0.0f, sanitized.accelerationTimeConstant);
+    sanitized.maxLeadFraction = std::clamp(sanitized.maxLeadFraction, 0.0f, 1.0f);
+    sanitized.fastStopRatio = std::clamp(sanitized.fastStopRatio, 0.0f, 1.0f);
+    
+    if (sanitized.enabled != m_config.enabled) {
+        Reset();
+    }
+    m_config = sanitized;
+}
+
+void VelocityPredictor::Reset() {
+    m_initialized = false;
+    m_fastStop = false;
+    m_lastEstimate = 0.0f;
+    m_acceleration = 0.0f;
+}
+
+float VelocityPredictor::Update(float estimated, float measured, float deltaTime) {
+    if (!m_config.enabled || !(deltaTime > 0.0f)) {
+        return estimated;
+    }
+    
+    if (!m_initialized) {
+        m_initialized = true;
+        m_lastEstimate = estimated;
+        m_acceleration = 0.0f;
+        return estimated;
+    }
+    
+    // Smoothed derivative of the estimate
+    float rawAcceleration = (estimated - m_lastEstimate) / deltaTime;
+    float alpha = deltaTime / (m_config.accelerationTimeConstant + deltaTime);
+    m_acceleration += alpha * (rawAcceleration - m_acceleration);
+    m_lastEstimate = estimated;
+    
+    // === Fast stop: the belt halted (or reversed) faster than any filter
+    // can follow, so publish the raw value and forget the old momentum ===
+    float magnitude = std::abs(estimated);
+    bool reversed = measured * estimated < 0.0f;
+    if (magnitude > 0.0f && (reversed || std::abs(measured) < m_config.fastStopRatio * magnitude)) {
+        m_fastStop = true;
+        m_acceleration = 0.0f;
+        return measured;
+    }
+    m_fastStop = false;
+    
+    // === Project forward and clamp ===
+    float lead = m_acceleration * (m_config.horizonMs * 0.001f);
+    float maxLead = m_config.maxLeadFraction * magnitude;
+    lead = std::clamp(lead, -maxLead, maxLead);
+    
+    // maxLeadFraction <= 1 already keeps the sign, but make it explicit
+    float predicted = estimated + lead;
+    if (predicted * estimated < 0.0f) {
+        predicted = 0.0f;
+    }
+    return predicted;
+}
+
+} // namespace Mouse2VR
@@ -0,0 +1,145 @@
+#include "common/WakeEvent.h"
+#include "common/Logger.h"
+
+#if defined(_WIN32)
+#include "common/WindowsHeaders.h"
+#elif defined(__linux__)
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace Mouse2VR {
+
+#if defined(_WIN32)
+
+WakeEvent::WakeEvent() {
+    m_handle = CreateEventW(nullptr, FALSE, FALSE, nullptr);  // auto-reset
+    if (!m_handle) {
+        LOG_ERROR("WakeEvent", "CreateEvent failed: {}", GetLastError());
+    }
+}
+
+WakeEvent::~WakeEvent() {
+    if (m_handle) {
+        CloseHandle(static_cast<HANDLE>(m_handle));
+    }
+}
+
+void WakeEvent::Signal() {
+    if (m_pending.exchange(true, std::memory_order_acq_rel)) {
+        return;  // Consumer has not picked up the previous signal yet
+    }
+    m_kernelSignals.fetch_add(1, std::memory_order_relaxed);
+    SetEvent(static_cast<HANDLE>(m_handle));
+}
+
+bool WakeEvent::WaitImpl(long long timeoutNs) {
+    if (!m_pending.load(std::memory_order_acquire)) {
+        // Round up so a short timeout doesn't turn into a busy poll
+        DWORD timeoutMs = timeoutNs < 0 ? INFINITE
+            : static_cast<DWORD>((timeoutNs + 999999) / 1000000);
+        if (WaitForSingleObject(static_cast<HANDLE>(m_handle), timeoutMs) != WAIT_OBJECT_0) {
+            return false;
+        }
+    } else {
+        // Clear the kernel state left by the signal we are consuming
+        WaitForSingleObject(static_cast<HANDLE>(m_handle), 0);
+    }
+    m_pending.exchange(false, std::memory_order_acq_rel);
+    return true;
+}
+
+#elif defined(__linux__)
+
+WakeEvent::WakeEvent() {
+    m_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (m_fd < 0) {
+        LOG_ERROR("WakeEvent", "eventfd failed: {}", std::strerror(errno));
+    }
+}
+
+WakeEvent::~WakeEvent() {
+    if (m_fd >= 0) {
+        close(m_fd);
+    }
+}
+
+void WakeEvent::Signal() {
+    if (m_pending.exchange(true, std::memory_order_acq_rel)) {
+        return;  // Consumer has not picked up the previous signal yet
+    }
+    m_kernelSignals.fetch_add(1, std::memory_order_relaxed);
+    uint64_t one = 1;
+    ssize_t written = write(m_fd, &one, sizeof(one));
+    (void)written;
+}
+
+bool WakeEvent::WaitImpl(long long timeoutNs) {
+    if (!m_pending.load(std::memory_order_acquire)) {
+        pollfd pfd = {m_fd, POLLIN, 0};
+        timespec ts = {static_cast<time_t>(timeoutNs / 1000000000LL),
+                       static_cast<long>(timeoutNs % 1000000000LL)};
+        int ready = ppoll(&pfd, 1, timeoutNs < 0 ? nullptr : &ts, nullptr);
+        if (ready <= 0) {
+            return false;  // Timeout or EINTR
+        }
+    }
+    
+    // Reset the counter. If the producer set m_pending but has not written
+    // yet, the late write makes the next wait return early, which is allowed.
+    uint64_t value;
+    ssize_t bytes = read(m_fd, &value, sizeof(value));
+    (void)bytes;
+    
+    // Exchange (not store) so this synchronizes with the producer's exchange
+    // and everything pushed before the signal is visible to the caller
+    m_pending.exchange(false, std::memory_order_acq_rel);
+    return true;
+}
+
+#else
+
+WakeEvent::WakeEvent() = default;
+WakeEvent::~WakeEvent() = default;
+
+void WakeEvent::Signal() {
+    if (m_pending.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    m_kernelSignals.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_signaled = true;
+    }
+    m_cv.notify_one();
+}
+
+bool WakeEvent::WaitImpl(long long timeoutNs) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (timeoutNs < 0) {
+        m_cv.wait(lock, [this] { return m_signaled; });
+    } else if (!m_cv.wait_for(lock, std::chrono::nanoseconds(timeoutNs), [this] { return m_signaled; })) {
+        return false;
+    }
+    m_signaled = false;
+    m_pending.exchange(false, std::memory_order_acq_rel);
+    return true;
+}
+
+#endif
+
+void WakeEvent::Wait() {
+    while (!WaitImpl(-1)) {
+        // Retry after EINTR
+    }
+}
+
+bool WakeEvent::WaitFor(std::chrono::nanoseconds timeout) {
+    return WaitImpl(timeout.count() < 0 ? 0 : timeout.count());
+}
+
+} // namespace Mouse2VR
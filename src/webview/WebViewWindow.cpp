@@ -1,8 +1,9 @@
 #include "WebViewWindow.h"
-#include "Bridge.h"
+#include "core/BridgeProtocol.h"
 #include "core/Mouse2VRCore.h"
 #include "common/Logger.h"
 #include "core/PathUtils.h"
+#include <algorithm>
 #include <sstream>
 #include <filesystem>
 #include <Shlwapi.h>
@@ -29,6 +30,27 @@ std::wstring GetWebView2FixedRuntimePath() {
     return std::wstring(runtimePath);
 }
 
+// UTF-16 (WebView2 strings) <-> UTF-8 (bridge protocol)
+static std::string ToUtf8(const wchar_t* text) {
+    int size = WideCharToMultiByte(CP_UTF8, 0, text, -1, nullptr, 0, nullptr, nullptr);
+    if (size <= 1) {
+        return {};
+    }
+    std::string result(static_cast<size_t>(size - 1), '\0');
+    WideCharToMultiByte(CP_UTF8, 0, text, -1, result.data(), size, nullptr, nullptr);
+    return result;
+}
+
+static std::wstring FromUtf8(const std::string& text) {
+    if (text.empty()) {
+        return {};
+    }
+    int size = MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), nullptr, 0);
+    std::wstring result(static_cast<size_t>(size), L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, text.data(), static_cast<int>(text.size()), result.data(), size);
+    return result;
+}
+
 // Check if Fixed Runtime is available
 bool IsWebView2FixedRuntimeAvailable() {
     std::wstring runtimePath = GetWebView2FixedRuntimePath();
@@ -53,6 +75,9 @@ WebViewWindow::WebViewWindow()
 }
 
 WebViewWindow::~WebViewWindow() {
+    if (m_parentWindow) {
+        KillTimer(m_parentWindow, kTelemetryTimerId);
+    }
     if (m_controller) {
         m_controller->Close();
     }
@@ -274,92 +299,21 @@ void WebViewWindow::RegisterEventHandlers() {
         nullptr
     );
     
-    // Handle messages from JavaScript
+    // Handle messages from JavaScript: typed JSON requests, answered by one
+    // reply message each (see core/BridgeProtocol.h)
     m_webView->add_WebMessageReceived(
         Callback<ICoreWebView2WebMessageReceivedEventHandler>(
             [this](ICoreWebView2* sender, ICoreWebView2WebMessageReceivedEventArgs* args) -> HRESULT {
                 wil::unique_cotaskmem_string message;
-                args->TryGetWebMessageAsString(&message);
-                
-                // Parse and handle message
-                std::wstring msg(message.get());
-                LOG_DEBUG("WebView", "Received message from JS: " + std::string(msg.begin(), msg.end()));
-                
-                // Handle different message types
-                if (msg.find(L"setSensitivity:") == 0) {
-                    double value = std::stod(msg.substr(15));
-                    m_core->SetSensitivity(value);
-                    LOG_INFO("WebView", "Set sensitivity to: " + std::to_string(value));
-                } else if (msg.find(L"setUpdateRate:") == 0) {
-                    int value = std::stoi(msg.substr(14));
-                    m_core->SetUpdateRate(value);
-                    LOG_INFO("WebView", "Set update rate to: " + std::to_string(value) + " Hz");
-                } else if (msg.find(L"setInvertY:") == 0) {
-                    bool value = (msg.substr(11) == L"true");
-                    m_core->SetInvertY(value);
-                    LOG_INFO("WebView", "Set invert Y to: " + std::string(value ? "true" : "false"));
-                } else if (msg.find(L"setLockX:") == 0) {
-                    bool value = (msg.substr(9) == L"true");
-                    m_core->SetLockX(value);
-                    LOG_INFO("WebView", "Set lock X to: " + std::string(value ? "true" : "false"));
-                } else if (msg.find(L"setDPI:") == 0) {
-                    int dpi = std::stoi(msg.substr(7));
-                    // Calculate counts per meter: DPI * 39.3701 (inches per meter)
-                    float countsPerMeter = dpi * 39.3701f;
-                    m_core->SetCountsPerMeter(countsPerMeter);
-                    LOG_INFO("WebView", "Set DPI to: " + std::to_string(dpi) + " (counts/meter: " + std::to_string(countsPerMeter) + ")");
-                } else if (msg == L"startTest") {
-                    m_core->StartMovementTest();
-                    LOG_INFO("WebView", "Started 5-second movement test");
-                } else if (msg == L"getStatus") {
-                    bool isRunning = m_core->IsRunning();
-                    ExecuteScript(L"updateStatus(" + std::wstring(isRunning ? L"true" : L"false") + L")");
-                } else if (msg == L"getSpeed") {
-                    auto state = m_core->GetCurrentState();
-                    // Treadmill speed is the raw physical speed (m/s)
-                    double treadmillSpeed = state.stickY >= 0 ? state.speed : -state.speed;
-                    // Game speed based on stick deflection and HL2 max sprint speed (6.1 m/s)
-                    double gameSpeed = state.stickY * 6.1; // HL2 max sprint speed at full deflection
-                    // Get actual update rate from backend
-                    int actualHz = m_core->GetActualUpdateRate();
-                    // Send treadmill speed, game speed, stick Y position, and actual update rate
-                    std::wstring speedUpdate = L"updateSpeed(" + std::to_wstring(treadmillSpeed) + 
-                                              L", " + std::to_wstring(gameSpeed) +
-                                              L", " + std::to_wstring(state.stickY) +
-                                              L", " + std::to_wstring(actualHz) + L")";
-                    ExecuteScript(speedUpdate);
-                } else if (msg == L"start") {
-                    m_core->Start();
-                    LOG_INFO("WebView", "Started Mouse2VR core");
-                    // Update UI status
-                    ExecuteScript(L"updateStatus(true)");
-                } else if (msg == L"stop") {
-                    m_core->Stop();
-                    LOG_INFO("WebView", "Stopped Mouse2VR core");
-                    // Update UI status
-                    ExecuteScript(L"updateStatus(false)");
-                } else if (msg == L"getConfig") {
-                    // Get current configuration from core
-                    auto procConfig = m_core->GetProcessorConfig();
-                    int targetHz = m_core->GetTargetUpdateRate();
-                    bool isRunning = m_core->IsRunning();
-                    
-                    // Build config JSON string
-                    std::wstring configJson = L"{"
-                        L"\"dpi\":" + std::to_wstring(procConfig.dpi) + L","
-                        L"\"sensitivity\":" + std::to_wstring(procConfig.sensitivity) + L","
-                        L"\"updateRateHz\":" + std::to_wstring(targetHz) + L","
-                        L"\"uiRateHz\":5," // Default UI rate, TODO: store this properly
-                        L"\"invertY\":" + (procConfig.invertY ? L"true" : L"false") + L","
-                        L"\"lockX\":" + (procConfig.lockX ? L"true" : L"false") + L","
-                        L"\"runEnabled\":" + (isRunning ? L"true" : L"false") +
-                        L"}";
-                    
-                    // Send config to JavaScript
-                    ExecuteScript(L"if(window.applyConfigToUI) applyConfigToUI(" + configJson + L")");
-                    LOG_INFO("WebView", "Sent config to UI");
+                if (FAILED(args->get_WebMessageAsJson(&message)) || !m_bridge) {
+                    return S_OK;
                 }
                 
+                std::string request = ToUtf8(message.get());
+                LOG_DEBUG("WebView", "Received message from JS: " + request);
+                std::string reply = m_bridge->Handle(request);
+                m_webView->PostWebMessageAsJson(FromUtf8(reply).c_str());
+                
                 return S_OK;
             }
         ).Get(),
@@ -368,53 +322,151 @@ void WebViewWindow::RegisterEventHandlers() {
 }
 
 void WebViewWindow::InjectInitialScript() {
-    // Inject JavaScript API for communication
+    // Inject JavaScript API for communication. Every call is one typed
+    // request; the returned promise settles with the reply's result or
+    // error ({code, field, message}).
     std::wstring script = LR"JS(
-        window.mouse2vr = {
-            setSensitivity: function(value) {
-                window.chrome.webview.postMessage('setSensitivity:' + value);
-            },
-            setUpdateRate: function(value) {
-                window.chrome.webview.postMessage('setUpdateRate:' + value);
-            },
-            setInvertY: function(value) {
-                window.chrome.webview.postMessage('setInvertY:' + value);
-            },
-            setLockX: function(value) {
-                window.chrome.webview.postMessage('setLockX:' + value);
-            },
-            setDPI: function(value) {
-                window.chrome.webview.postMessage('setDPI:' + value);
-            },
-            startTest: function() {
-                window.chrome.webview.postMessage('startTest');
-            },
-            getStatus: function() {
-                window.chrome.webview.postMessage('getStatus');
-            },
-            start: function() {
-                window.chrome.webview.postMessage('start');
-            },
-            stop: function() {
-                window.chrome.webview.postMessage('stop');
-            },
-            getSpeed: function() {
-                window.chrome.webview.postMessage('getSpeed');
-            },
-            getConfig: function() {
-                window.chrome.webview.postMessage('getConfig');
+        (function() {
+            let nextId = 1;
+            const pending = new Map();
+            
+            function request(cmd, args) {
+                const id = nextId++;
+                return new Promise((resolve, reject) => {
+                    pending.set(id, { resolve: resolve, reject: reject });
+                    window.chrome.webview.postMessage({ id: id, cmd: cmd, args: args || {} });
+                });
             }
-        };
-        
-        console.log('Mouse2VR API injected');
+            
+            window.chrome.webview.addEventListener('message', (event) => {
+                const reply = event.data;
+                if (!reply || reply.id === undefined || !pending.has(reply.id)) {
+                    return;  // Not a reply (e.g. a telemetry push)
+                }
+                const call = pending.get(reply.id);
+                pending.delete(reply.id);
+                if (reply.ok) {
+                    call.resolve(reply.result);
+                } else {
+                    call.reject(reply.error);
+                }
+            });
+            
+            // Fire-and-forget calls from the page log failures instead of
+            // leaving unhandled rejections
+            function send(cmd, args) {
+                return request(cmd, args).catch((error) => {
+                    console.warn('mouse2vr ' + cmd + ': ' + error.code +
+                                 (error.field ? ' (' + error.field + ')' : '') + ': ' + error.message);
+                });
+            }
+            
+            function then(callbackName) {
+                return (result) => {
+                    if (result && window[callbackName]) {
+                        window[callbackName](result);
+                    }
+                    return result;
+                };
+            }
+            
+            window.mouse2vr = {
+                request: request,
+                // Several settings in one message, applied together or not at all
+                set: function(settings) {
+                    return send('set', settings);
+                },
+                setSensitivity: function(value) {
+                    return send('set', { sensitivity: Number(value) });
+                },
+                setUpdateRate: function(value) {
+                    return send('set', { updateRateHz: Number(value) });
+                },
+                setInvertY: function(value) {
+                    return send('set', { invertY: !!value });
+                },
+                setLockX: function(value) {
+                    return send('set', { lockX: !!value });
+                },
+                setDPI: function(value) {
+                    return send('set', { dpi: Number(value) });
+                },
+                startTest: function() {
+                    return send('startTest');
+                },
+                getStatus: function() {
+                    return send('getStatus').then((result) => {
+                        if (result && window.updateStatus) window.updateStatus(result.running);
+                        return result;
+                    });
+                },
+                start: function() {
+                    return send('start');
+                },
+                stop: function() {
+                    return send('stop');
+                },
+                getSpeed: function() {
+                    return send('getSpeed').then((result) => {
+                        if (result && window.updateSpeed) {
+                            window.updateSpeed(result.treadmillSpeed, result.gameSpeed, result.stickY, result.actualHz);
+                        }
+                        return result;
+                    });
+                },
+                setTelemetryRate: function(value) {
+                    return send('setTelemetryRate', { hz: Number(value) });
+                },
+                getConfig: function() {
+                    return send('getConfig').then(then('applyConfigToUI'));
+                },
+                getSchedulerStats: function() {
+                    return send('getSchedulerStats').then(then('updateSchedulerStats'));
+                },
+                getPhaseStats: function() {
+                    return send('getPhaseStats').then(then('updatePhaseStats'));
+                }
+            };
+            
+            console.log('Mouse2VR API injected');
+        })();
     )JS";
     
     ExecuteScript(script);
 }
 
+void WebViewWindow::SetTelemetryRate(int hz) {
+    if (!m_parentWindow || !m_core) {
+        return;
+    }
+    if (hz <= 0) {
+        KillTimer(m_parentWindow, kTelemetryTimerId);
+        m_core->SetTelemetryEnabled(false);
+        return;
+    }
+    hz = (std::min)(hz, 240);
+    m_core->SetTelemetryEnabled(true);
+    // Replaces the running timer, if any
+    SetTimer(m_parentWindow, kTelemetryTimerId, static_cast<UINT>(1000 / hz), nullptr);
+}
+
+void WebViewWindow::PushTelemetry() {
+    if (!m_webView || !m_core) {
+        return;
+    }
+    if (m_core->TakeTelemetry(m_telemetryBatch) == 0) {
+        return;  // Stopped or parked: nothing new to draw
+    }
+    m_telemetryJson.clear();
+    m_telemetryBatch.AppendJson(m_telemetryJson);
+    // The JSON is plain ASCII
+    m_telemetryMessage.assign(m_telemetryJson.begin(), m_telemetryJson.end());
+    m_webView->PostWebMessageAsJson(m_telemetryMessage.c_str());
+}
+
 void WebViewWindow::SetupJavaScriptBridge() {
-    // This will be expanded with the Bridge class implementation
-    // For now, we use simple message passing
+    m_bridge = std::make_unique<Mouse2VR::BridgeDispatcher>(*m_core);
+    m_bridge->SetTelemetryRateHandler([this](int hz) { SetTelemetryRate(hz); });
 }
 
 std::wstring WebViewWindow::GetFallbackHTML() {
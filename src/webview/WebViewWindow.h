@@ -5,10 +5,13 @@
 #include <WebView2.h>
 #include <string>
 #include <functional>
+#include <memory>
+#include "core/Telemetry.h"
 
 // Forward declarations
 namespace Mouse2VR {
     class Mouse2VRCore;
+    class BridgeDispatcher;
 }
 
 class WebViewWindow {
@@ -25,6 +28,13 @@ public:
     // Event handlers
     void OnDocumentReady(std::function<void()> callback) { m_onDocumentReady = callback; }
     
+    // Telemetry push: the parent window's timer (kTelemetryTimerId) fires
+    // once per UI frame and PushTelemetry() posts every tick since the
+    // previous frame as a single web message. hz <= 0 stops the push.
+    static constexpr UINT_PTR kTelemetryTimerId = 1;
+    void SetTelemetryRate(int hz);
+    void PushTelemetry();
+    
 private:
     HWND m_parentWindow;
     Mouse2VR::Mouse2VRCore* m_core;
@@ -35,6 +45,14 @@ private:
     
     std::function<void()> m_onDocumentReady;
     
+    // Decodes and answers the page's requests
+    std::unique_ptr<Mouse2VR::BridgeDispatcher> m_bridge;
+    
+    // Reused by every push
+    Mouse2VR::TelemetryBatch m_telemetryBatch;
+    std::string m_telemetryJson;
+    std::wstring m_telemetryMessage;
+    
     HRESULT CreateWebView2Environment();
     HRESULT OnCreateEnvironmentCompleted(HRESULT result, ICoreWebView2Environment* environment);
     HRESULT OnCreateWebViewControllerCompleted(HRESULT result, ICoreWebView2Controller* controller);
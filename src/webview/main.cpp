@@ -266,6 +266,13 @@ private:
                 PostQuitMessage(0);
                 return 0;
                 
+            case WM_TIMER:
+                if (wParam == WebViewWindow::kTelemetryTimerId && m_webView) {
+                    m_webView->PushTelemetry();
+                    return 0;
+                }
+                break;
+                
             case WM_TRAYICON:
                 return HandleTrayMessage(wParam, lParam);
                 
@@ -3,6 +3,7 @@
 let isRunning = false;
         let treadmillSpeedHistory = [];
         let gameSpeedHistory = [];
+        const speedHistoryLength = 500;  // Graph width in samples (one per backend tick)
         let lastUpdateTime = Date.now();
         let currentDPI = 1000;  // Default DPI
         let sensitivity = 1.0;  // Current sensitivity multiplier
@@ -188,10 +189,9 @@ function updateDPI(value) {
             const invertY = document.getElementById('invertY').checked;
             const lockX = document.getElementById('lockX').checked;
             
-            // Send settings to backend
+            // Send both settings to the backend as one change
             if (window.mouse2vr) {
-                window.mouse2vr.setInvertY(invertY);
-                window.mouse2vr.setLockX(lockX);
+                window.mouse2vr.set({ invertY: invertY, lockX: lockX });
             }
         }
         
@@ -280,26 +280,54 @@ function updateDPI(value) {
             canvas.height = canvas.offsetHeight;
             
             // Initialize with empty history
-            for (let i = 0; i < 50; i++) {
+            for (let i = 0; i < speedHistoryLength; i++) {
                 treadmillSpeedHistory.push(0);
                 gameSpeedHistory.push(0);
             }
         }
         
-        function addSpeedToHistory(treadmillSpeed, gameSpeed) {
+        function pushSpeedHistory(treadmillSpeed, gameSpeed) {
             treadmillSpeedHistory.push(treadmillSpeed);
             gameSpeedHistory.push(gameSpeed);
             
-            if (treadmillSpeedHistory.length > 50) {
+            if (treadmillSpeedHistory.length > speedHistoryLength) {
                 treadmillSpeedHistory.shift();
             }
-            if (gameSpeedHistory.length > 50) {
+            if (gameSpeedHistory.length > speedHistoryLength) {
                 gameSpeedHistory.shift();
             }
-            
+        }
+        
+        function addSpeedToHistory(treadmillSpeed, gameSpeed) {
+            pushSpeedHistory(treadmillSpeed, gameSpeed);
             drawSpeedGraph();
         }
         
+        // One batch per UI frame from the backend: every tick since the last
+        // frame (columns t/speed/stickY, see core/Telemetry.h). All ticks go
+        // into the graph; the readouts show the newest.
+        function applyTelemetry(batch) {
+            const count = batch.speed.length;
+            if (count === 0) return;
+            
+            // Treadmill speed takes its sign from the stick; game speed is
+            // HL2 max sprint (6.1 m/s) at full deflection
+            const treadmill = (i) => batch.stickY[i] >= 0 ? batch.speed[i] : -batch.speed[i];
+            for (let i = 0; i < count - 1; i++) {
+                pushSpeedHistory(treadmill(i), batch.stickY[i] * 6.1);
+            }
+            const last = count - 1;
+            updateSpeed(treadmill(last), batch.stickY[last] * 6.1, batch.stickY[last], batch.hz);
+        }
+        
+        if (window.chrome && window.chrome.webview) {
+            window.chrome.webview.addEventListener('message', (event) => {
+                if (event.data && event.data.type === 'telemetry') {
+                    applyTelemetry(event.data);
+                }
+            });
+        }
+        
         function drawSpeedGraph() {
             const canvas = document.getElementById('speedCanvas');
             if (!canvas) return;
@@ -390,26 +418,22 @@ function updateDPI(value) {
             ctx.fillText('Game Speed (HL2)', legendX + 25, legendY + 29);
         }
         
-        // Request speed updates periodically
-        let updateInterval = null;
+        // Ask the backend to push telemetry at the UI refresh rate; retried
+        // until the bridge API has been injected
+        let telemetryRetry = null;
         
         function startPolling(rateHz = 60) {
-            // Clear existing interval
-            if (updateInterval) {
-                clearInterval(updateInterval);
+            if (telemetryRetry) {
+                clearTimeout(telemetryRetry);
+                telemetryRetry = null;
+            }
+            if (window.mouse2vr && window.mouse2vr.setTelemetryRate) {
+                window.mouse2vr.setTelemetryRate(rateHz);
+            } else {
+                telemetryRetry = setTimeout(() => startPolling(rateHz), 100);
             }
-            
-            // Calculate interval from Hz (with minimum of 10ms)
-            const intervalMs = Math.max(10, Math.floor(1000 / rateHz));
-            
-            updateInterval = setInterval(() => {
-                if (window.mouse2vr && window.mouse2vr.getSpeed) {
-                    window.mouse2vr.getSpeed();
-                }
-            }, intervalMs);
         }
         
-        // Start with default polling rate (will be updated by config)
         startPolling(currentUIRefreshRate);
         
         // Initialize
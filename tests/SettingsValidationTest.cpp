@@ -6,6 +6,7 @@
 #include <numeric>
 #include <functional>
 
+#include "common/Clock.h"
 #include "core/Mouse2VRCore.h"
 #include "core/RawInputHandler.h"
 #include "core/InputProcessor.h"
@@ -57,12 +58,17 @@ protected:
             0, 0, 100, 100, nullptr, nullptr, hInstance, nullptr);
     }
     
-    // Helper: Inject mouse input over time period
+    // Helper: Inject mouse input over time period. A stopped core runs the
+    // injection on a simulated clock, so updates are exactly sleepTime apart
+    // and no real time passes; a running core gets real sleeps.
     void InjectMouseMovement(int totalDelta, int durationMs, bool xAxis = false) {
         const int updates = 50; // 50 updates over duration
         const int deltaPerUpdate = totalDelta / updates;
         const auto sleepTime = std::chrono::milliseconds(durationMs / updates);
         
+        auto clock = std::make_shared<SimulatedClock>();
+        const bool simulated = !core->IsRunning() && core->SetClock(clock);
+        
         for (int i = 0; i < updates; i++) {
             RAWINPUT raw = {};
             raw.header.dwType = RIM_TYPEMOUSE;
@@ -76,15 +82,28 @@ protected:
             }
             
             rawInput->ProcessRawInputDirect(&raw);
+            if (simulated) {
+                clock->AdvanceBy(std::chrono::nanoseconds(sleepTime).count());
+            }
             
             // Force an update and record metrics
             core->ForceUpdate();
-            metrics.RecordUpdate();
+            if (simulated) {
+                metrics.RecordUpdate(metrics.startTime + std::chrono::nanoseconds(clock->NowNs()));
+            } else {
+                metrics.RecordUpdate();
+            }
             
             auto state = core->GetCurrentState();
             metrics.RecordControllerState(static_cast<float>(state.stickX), static_cast<float>(state.stickY));
             
-            std::this_thread::sleep_for(sleepTime);
+            if (!simulated) {
+                std::this_thread::sleep_for(sleepTime);
+            }
+        }
+        
+        if (simulated) {
+            core->SetClock(nullptr);
         }
     }
     
@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include "core/BridgeProtocol.h"
+#include "core/IControllerSink.h"
+#include "core/IInputSource.h"
+#include "core/Mouse2VRCore.h"
+#include "core/PathUtils.h"
+#include <filesystem>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+
+using namespace Mouse2VR;
+
+namespace {
+
+class NullInputSource : public IInputSource {
+public:
+    bool Start() override { return true; }
+    void Stop() override {}
+    MouseDelta GetAndResetDeltas() override { return {}; }
+    size_t DrainSamples(InputSample*, size_t) override { return 0; }
+    void SetWakeEvent(WakeEvent*) override {}
+    uint64_t GetSampleCount() const override { return 0; }
+    uint64_t GetMergedSampleCount() const override { return 0; }
+    const char* GetName() const override { return "null"; }
+};
+
+class NullControllerSink : public IControllerSink {
+public:
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    void SetLeftStick(float, float) override {}
+    void Update() override {}
+    bool IsConnected() const override { return true; }
+    const char* GetName() const override { return "null"; }
+};
+
+SettingsChange Parse(const char* args, BridgeError& error, bool expectOk) {
+    SettingsChange change;
+    EXPECT_EQ(ParseSettingsChange(nlohmann::json::parse(args), change, error), expectOk) << args;
+    return change;
+}
+
+} // namespace
+
+TEST(BridgeProtocolTest, ErrorCodeNamesRoundTrip) {
+    for (BridgeErrorCode code : {BridgeErrorCode::ParseError, BridgeErrorCode::InvalidRequest,
+                                 BridgeErrorCode::UnknownCommand, BridgeErrorCode::UnknownSetting,
+                                 BridgeErrorCode::WrongType, BridgeErrorCode::OutOfRange,
+                                 BridgeErrorCode::Unavailable}) {
+        EXPECT_EQ(BridgeErrorCodeFromString(BridgeErrorCodeToString(code)), code);
+    }
+    EXPECT_EQ(BridgeErrorCodeFromString("bogus"), BridgeErrorCode::None);
+}
+
+TEST(BridgeProtocolTest, ParsesTypedSettings) {
+    BridgeError error;
+    SettingsChange change = Parse(R"({"sensitivity":1.5,"dpi":1600,"invertY":true,"updateRateHz":90.0})",
+                                  error, true);
+    ASSERT_TRUE(change.sensitivity);
+    EXPECT_FLOAT_EQ(*change.sensitivity, 1.5f);
+    ASSERT_TRUE(change.countsPerMeter);
+    EXPECT_NEAR(*change.countsPerMeter, 1600 * 39.3701f, 0.01f);
+    EXPECT_EQ(change.invertY, true);
+    EXPECT_EQ(change.updateRateHz, 90);
+    EXPECT_FALSE(change.lockX);
+    EXPECT_FALSE(change.eventDriven);
+    EXPECT_TRUE(change.ChangesProcessing());
+}
+
+TEST(BridgeProtocolTest, RejectsBadSettings) {
+    BridgeError error;
+    Parse(R"({"sensitivity":1.5,"warpDrive":true})", error, false);
+    EXPECT_EQ(error.code, BridgeErrorCode::UnknownSetting);
+    EXPECT_EQ(error.field, "warpDrive");
+
+    Parse(R"({"invertY":"yes"})", error, false);
+    EXPECT_EQ(error.code, BridgeErrorCode::WrongType);
+    EXPECT_EQ(error.field, "invertY");
+
+    Parse(R"({"dpi":"1600"})", error, false);
+    EXPECT_EQ(error.code, BridgeErrorCode::WrongType);
+
+    Parse(R"({"updateRateHz":90.5})", error, false);
+    EXPECT_EQ(error.code, BridgeErrorCode::WrongType);
+    EXPECT_EQ(error.field, "updateRateHz");
+
+    Parse(R"({"updateRateHz":1000})", error, false);
+    EXPECT_EQ(error.code, BridgeErrorCode::OutOfRange);
+    EXPECT_EQ(error.message, "updateRateHz must be between 10 and 200");
+
+    Parse(R"({"sensitivity":-1})", error, false);
+    EXPECT_EQ(error.code, BridgeErrorCode::OutOfRange);
+
+    Parse(R"({})", error, false);
+    EXPECT_EQ(error.code, BridgeErrorCode::InvalidRequest);
+}
+
+// Dispatcher against an initialized core. The core saves config.json next
+// to the test binary, which other tests would load, so it is removed again.
+class BridgeDispatcherTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        configPath = PathUtils::GetExecutablePath("config.json");
+        std::filesystem::remove(configPath);
+        core = std::make_unique<Mouse2VRCore>();
+        ASSERT_TRUE(core->Initialize(std::make_unique<NullInputSource>(), std::make_unique<NullControllerSink>()));
+        bridge = std::make_unique<BridgeDispatcher>(*core);
+    }
+
+    void TearDown() override {
+        bridge.reset();
+        core->Shutdown();
+        std::filesystem::remove(configPath);
+    }
+
+    nlohmann::json Call(const std::string& request) {
+        std::string reply = bridge->Handle(request);
+        nlohmann::json parsed = nlohmann::json::parse(reply, nullptr, false);
+        EXPECT_FALSE(parsed.is_discarded()) << reply;
+        return parsed;
+    }
+
+    std::string configPath;
+    std::unique_ptr<Mouse2VRCore> core;
+    std::unique_ptr<BridgeDispatcher> bridge;
+};
+
+TEST_F(BridgeDispatcherTest, MalformedRequestsGetStructuredErrors) {
+    struct Case {
+        const char* request;
+        const char* code;
+        const char* field;
+    };
+    const Case cases[] = {
+        {"setSensitivity:1.5", "parse_error", ""},
+        {"{\"id\":1,\"cmd\":", "parse_error", ""},
+        {"[1,2]", "invalid_request", ""},
+        {"{\"id\":2}", "invalid_request", "cmd"},
+        {"{\"id\":3,\"cmd\":7}", "invalid_request", "cmd"},
+        {"{\"id\":4,\"cmd\":\"warp\"}", "unknown_command", "cmd"},
+        {"{\"id\":5,\"cmd\":\"set\",\"args\":[1]}", "wrong_type", "args"},
+        {"{\"id\":6,\"cmd\":\"set\"}", "invalid_request", "args"},
+        {"{\"id\":7,\"cmd\":\"setTelemetryRate\",\"args\":{\"hz\":60}}", "unavailable", ""},
+    };
+    for (const Case& c : cases) {
+        nlohmann::json reply = Call(c.request);
+        EXPECT_EQ(reply["ok"], false) << c.request;
+        EXPECT_EQ(reply["error"]["code"], c.code) << c.request;
+        EXPECT_EQ(reply["error"]["field"], c.field) << c.request;
+        EXPECT_FALSE(reply["error"]["message"].get<std::string>().empty()) << c.request;
+    }
+    EXPECT_TRUE(Call("not json")["id"].is_null());
+    EXPECT_EQ(Call("{\"id\":4,\"cmd\":\"warp\"}")["id"], 4);
+    EXPECT_EQ(Call("{\"id\":\"abc\",\"cmd\":\"warp\"}")["id"], "abc");
+    EXPECT_EQ(core->GetConfigSaveStats().requests, 0u);
+}
+
+TEST_F(BridgeDispatcherTest, BatchedSetPublishesAndSavesOnce) {
+    uint64_t version = core->GetProcessorConfigVersion();
+    nlohmann::json reply = Call(
+        R"({"id":10,"cmd":"set","args":{"sensitivity":1.5,"dpi":1600,"invertY":true,"lockX":false,"updateRateHz":90}})");
+    ASSERT_EQ(reply["ok"], true) << reply.dump();
+    EXPECT_EQ(reply["id"], 10);
+
+    EXPECT_EQ(core->GetProcessorConfigVersion(), version + 1);
+    EXPECT_EQ(core->GetConfigSaveStats().requests, 1u);
+
+    // The reply carries the resulting config
+    const nlohmann::json& config = reply["result"];
+    EXPECT_EQ(config["sensitivity"], 1.5);
+    EXPECT_EQ(config["dpi"], 1600);
+    EXPECT_EQ(config["invertY"], true);
+    EXPECT_EQ(config["lockX"], false);
+    EXPECT_EQ(config["updateRateHz"], 90);
+    EXPECT_EQ(Call(R"({"cmd":"getConfig"})")["result"], config);
+
+    // The saved file has the whole change
+    ASSERT_TRUE(core->FlushConfig());
+    EXPECT_EQ(core->GetConfigSaveStats().writes, 1u);
+    ConfigManager saved(configPath);
+    ASSERT_TRUE(saved.Load());
+    EXPECT_FLOAT_EQ(saved.GetConfig().sensitivity, 1.5f);
+    EXPECT_TRUE(saved.GetConfig().invertY);
+    EXPECT_EQ(saved.GetConfig().updateIntervalMs, 1000 / 90);
+}
+
+TEST_F(BridgeDispatcherTest, InvalidFieldRejectsWholeBatch) {
+    uint64_t version = core->GetProcessorConfigVersion();
+    float sensitivity = core->GetProcessorConfig().sensitivity;
+    nlohmann::json reply = Call(R"({"id":11,"cmd":"set","args":{"sensitivity":2.0,"updateRateHz":5000}})");
+    EXPECT_EQ(reply["ok"], false);
+    EXPECT_EQ(reply["error"]["code"], "out_of_range");
+    EXPECT_EQ(reply["error"]["field"], "updateRateHz");
+
+    EXPECT_EQ(core->GetProcessorConfigVersion(), version);
+    EXPECT_EQ(core->GetConfigSaveStats().requests, 0u);
+    EXPECT_EQ(core->GetProcessorConfig().sensitivity, sensitivity);
+}
+
+TEST_F(BridgeDispatcherTest, StatusAndHostCommands) {
+    nlohmann::json status = Call(R"({"id":1,"cmd":"getStatus"})");
+    ASSERT_EQ(status["ok"], true);
+    EXPECT_EQ(status["result"]["running"], false);
+    EXPECT_TRUE(Call(R"({"id":2,"cmd":"getSchedulerStats"})")["result"].contains("achievedHz"));
+    EXPECT_TRUE(Call(R"({"id":3,"cmd":"getSpeed"})")["result"].contains("treadmillSpeed"));
+
+    int telemetryHz = -1;
+    bridge->SetTelemetryRateHandler([&](int hz) { telemetryHz = hz; });
+    EXPECT_EQ(Call(R"({"id":4,"cmd":"setTelemetryRate","args":{"hz":60}})")["ok"], true);
+    EXPECT_EQ(telemetryHz, 60);
+    nlohmann::json bad = Call(R"({"id":5,"cmd":"setTelemetryRate","args":{"hz":1000}})");
+    EXPECT_EQ(bad["error"]["code"], "out_of_range");
+    EXPECT_EQ(telemetryHz, 60);
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 #include "core/ConfigManager.h"
 #include <filesystem>
+#include <string>
 #include <thread>
 #include <vector>
 #include <chrono>
@@ -10,8 +11,10 @@ using namespace Mouse2VR;
 class ConfigManagerTest : public ::testing::Test {
 protected:
     void SetUp() override {
-        // Use a test config file
-        testConfigPath = "test_config.json";
+        // One file per test, so parallel test runs (ctest runs every case
+        // in its own process) do not share it
+        testConfigPath = std::string("test_config-") +
+                         ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".json";
         
         // Clean up any existing test file
         if (std::filesystem::exists(testConfigPath)) {
@@ -22,6 +25,8 @@ protected:
     }
     
     void TearDown() override {
+        config.reset();  // Flushes a pending background save
+        
         // Clean up test file
         if (std::filesystem::exists(testConfigPath)) {
             std::filesystem::remove(testConfigPath);
@@ -87,6 +92,132 @@ TEST_F(ConfigManagerTest, SaveAndLoadConfig) {
     EXPECT_FALSE(loaded.showDebugInfo);
 }
 
+TEST_F(ConfigManagerTest, SaveAndLoadEventDrivenSettings) {
+    AppConfig customConfig;
+    customConfig.eventDriven = true;
+    customConfig.coalesceWindowUs = 250;
+    customConfig.maxOutputRateHz = 500;
+    customConfig.adaptiveMode = true;
+    customConfig.idleUpdateIntervalMs = 0;
+    customConfig.idleTimeoutMs = 750;
+    
+    config->SetConfig(customConfig);
+    EXPECT_TRUE(config->Save());
+    
+    auto config2 = std::make_unique<ConfigManager>(testConfigPath);
+    EXPECT_TRUE(config2->Load());
+    
+    AppConfig loaded = config2->GetConfig();
+    EXPECT_TRUE(loaded.eventDriven);
+    EXPECT_EQ(loaded.coalesceWindowUs, 250);
+    EXPECT_EQ(loaded.maxOutputRateHz, 500);
+    EXPECT_TRUE(loaded.adaptiveMode);
+    EXPECT_EQ(loaded.idleUpdateIntervalMs, 0);
+    EXPECT_EQ(loaded.idleTimeoutMs, 750);
+}
+
+TEST_F(ConfigManagerTest, SaveAndLoadVelocityFilter) {
+    AppConfig customConfig;
+    customConfig.velocity.filter = VelocityFilter::AlphaBeta;
+    customConfig.velocity.alphaBetaAlpha = 0.3f;
+    customConfig.velocity.medianWindow = 7;
+    
+    config->SetConfig(customConfig);
+    EXPECT_TRUE(config->Save());
+    
+    auto config2 = std::make_unique<ConfigManager>(testConfigPath);
+    EXPECT_TRUE(config2->Load());
+    
+    AppConfig loaded = config2->GetConfig();
+    EXPECT_EQ(loaded.velocity, customConfig.velocity);
+    EXPECT_EQ(loaded.toProcessingConfig().velocity.filter, VelocityFilter::AlphaBeta);
+}
+
+TEST_F(ConfigManagerTest, SaveAndLoadPrediction) {
+    AppConfig customConfig;
+    customConfig.prediction.enabled = true;
+    customConfig.prediction.horizonMs = 35.0f;
+    customConfig.prediction.fastStopRatio = 0.1f;
+    
+    config->SetConfig(customConfig);
+    EXPECT_TRUE(config->Save());
+    
+    auto config2 = std::make_unique<ConfigManager>(testConfigPath);
+    EXPECT_TRUE(config2->Load());
+    
+    AppConfig loaded = config2->GetConfig();
+    EXPECT_EQ(loaded.prediction, customConfig.prediction);
+    EXPECT_TRUE(loaded.toProcessingConfig().prediction.enabled);
+}
+
+TEST_F(ConfigManagerTest, SaveAndLoadResponseCurve) {
+    AppConfig customConfig;
+    customConfig.curve.type = ResponseCurveType::Spline;
+    customConfig.curve.inputMax = 0.75f;
+    customConfig.curve.points = {{0.1f, 0.25f}, {0.5f, 1.0f}};
+    
+    config->SetConfig(customConfig);
+    EXPECT_TRUE(config->Save());
+    
+    auto config2 = std::make_unique<ConfigManager>(testConfigPath);
+    EXPECT_TRUE(config2->Load());
+    
+    AppConfig loaded = config2->GetConfig();
+    EXPECT_EQ(loaded.curve, customConfig.curve);
+    EXPECT_EQ(loaded.toProcessingConfig().curve.points.size(), 2u);
+}
+
+TEST_F(ConfigManagerTest, SaveAndLoadFrameClock) {
+    AppConfig customConfig;
+    customConfig.frameClock.source = FrameClockSource::Udp;
+    customConfig.frameClock.port = 50123;
+    customConfig.frameClock.leadUs = 3500;
+    
+    config->SetConfig(customConfig);
+    EXPECT_TRUE(config->Save());
+    
+    auto config2 = std::make_unique<ConfigManager>(testConfigPath);
+    EXPECT_TRUE(config2->Load());
+    
+    AppConfig loaded = config2->GetConfig();
+    EXPECT_EQ(loaded.frameClock, customConfig.frameClock);
+}
+
+TEST_F(ConfigManagerTest, SaveAndLoadStateChannel) {
+    AppConfig customConfig;
+    customConfig.stateChannel.enabled = true;
+    customConfig.stateChannel.name = "treadmill-overlay";
+    
+    config->SetConfig(customConfig);
+    EXPECT_TRUE(config->Save());
+    
+    auto config2 = std::make_unique<ConfigManager>(testConfigPath);
+    EXPECT_TRUE(config2->Load());
+    
+    AppConfig loaded = config2->GetConfig();
+    EXPECT_EQ(loaded.stateChannel, customConfig.stateChannel);
+}
+
+TEST_F(ConfigManagerTest, SaveAndLoadThreadPolicy) {
+    AppConfig customConfig;
+    customConfig.processingThread.scheduler = ThreadScheduler::Fifo;
+    customConfig.processingThread.realtimePriority = 40;
+    customConfig.processingThread.affinityMask = 0x0C;
+    customConfig.inputThread.priority = ThreadPriority::High;
+    customConfig.lockMemory = true;
+    
+    config->SetConfig(customConfig);
+    EXPECT_TRUE(config->Save());
+    
+    auto config2 = std::make_unique<ConfigManager>(testConfigPath);
+    EXPECT_TRUE(config2->Load());
+    
+    AppConfig loaded = config2->GetConfig();
+    EXPECT_EQ(loaded.processingThread, customConfig.processingThread);
+    EXPECT_EQ(loaded.inputThread, customConfig.inputThread);
+    EXPECT_TRUE(loaded.lockMemory);
+}
+
 TEST_F(ConfigManagerTest, LoadNonExistentFileReturnsFalse) {
     // Use a unique filename that definitely won't exist
     std::string nonExistentPath = "test_non_existent_" + std::to_string(std::chrono::system_clock::now().time_since_epoch().count()) + ".json";
@@ -116,6 +247,110 @@ TEST_F(ConfigManagerTest, CreateDefaultConfig) {
     EXPECT_TRUE(config2->Load());
 }
 
+TEST_F(ConfigManagerTest, SaveReplacesFileAtomically) {
+    AppConfig appConfig;
+    appConfig.sensitivity = 1.5f;
+    config->SetConfig(appConfig);
+    ASSERT_TRUE(config->Save());
+    appConfig.sensitivity = 2.5f;
+    config->SetConfig(appConfig);
+    ASSERT_TRUE(config->Save());
+    
+    // The temp file was renamed over the config
+    for (const auto& entry : std::filesystem::directory_iterator(".")) {
+        std::string name = entry.path().filename().string();
+        EXPECT_FALSE(name.rfind(testConfigPath, 0) == 0 && entry.path().extension() == ".tmp") << name;
+    }
+    ConfigManager loaded(testConfigPath);
+    ASSERT_TRUE(loaded.Load());
+    EXPECT_EQ(loaded.GetConfig().sensitivity, 2.5f);
+    
+    ConfigSaveStats stats = config->GetSaveStats();
+    EXPECT_EQ(stats.writes, 2u);
+    EXPECT_EQ(stats.failures, 0u);
+}
+
+TEST_F(ConfigManagerTest, SaveFailureIsCounted) {
+    ConfigManager unwritable("no_such_directory/config.json");
+    EXPECT_FALSE(unwritable.Save());
+    EXPECT_EQ(unwritable.GetSaveStats().failures, 1u);
+    EXPECT_EQ(unwritable.GetSaveStats().writes, 0u);
+}
+
+TEST_F(ConfigManagerTest, RequestSaveCoalescesBurst) {
+    config->SetSaveDelay(std::chrono::milliseconds(50), std::chrono::seconds(5));
+    AppConfig appConfig;
+    for (int i = 0; i < 20; ++i) {
+        appConfig.sensitivity = 1.0f + i * 0.1f;
+        config->SetConfig(appConfig);
+        config->RequestSave();
+    }
+    EXPECT_EQ(config->GetSaveStats().requests, 20u);
+    
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (config->GetSaveStats().writes == 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(150));
+    EXPECT_EQ(config->GetSaveStats().writes, 1u);
+    
+    ConfigManager loaded(testConfigPath);
+    ASSERT_TRUE(loaded.Load());
+    EXPECT_EQ(loaded.GetConfig().sensitivity, appConfig.sensitivity);
+}
+
+TEST_F(ConfigManagerTest, MaxDelayBoundsSteadyChanges) {
+    // Changes every 10 ms never leave a 50 ms pause; the 100 ms bound
+    // still writes while they continue
+    config->SetSaveDelay(std::chrono::milliseconds(50), std::chrono::milliseconds(100));
+    AppConfig appConfig;
+    for (int i = 0; i < 50; ++i) {
+        appConfig.sensitivity = 1.0f + i * 0.01f;
+        config->SetConfig(appConfig);
+        config->RequestSave();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ConfigSaveStats stats = config->GetSaveStats();
+    EXPECT_GE(stats.writes, 2u);
+    EXPECT_LT(stats.writes, 25u);
+}
+
+TEST_F(ConfigManagerTest, FlushWritesPendingSave) {
+    config->SetSaveDelay(std::chrono::seconds(10), std::chrono::seconds(10));
+    AppConfig appConfig;
+    appConfig.sensitivity = 3.0f;
+    config->SetConfig(appConfig);
+    config->RequestSave();
+    EXPECT_EQ(config->GetSaveStats().writes, 0u);
+    EXPECT_FALSE(std::filesystem::exists(testConfigPath));
+    
+    EXPECT_TRUE(config->Flush());
+    EXPECT_EQ(config->GetSaveStats().writes, 1u);
+    ConfigManager loaded(testConfigPath);
+    ASSERT_TRUE(loaded.Load());
+    EXPECT_EQ(loaded.GetConfig().sensitivity, 3.0f);
+    
+    // Nothing left to write; a direct Save() also covers pending requests
+    EXPECT_TRUE(config->Flush());
+    config->RequestSave();
+    EXPECT_TRUE(config->Save());
+    EXPECT_TRUE(config->Flush());
+    EXPECT_EQ(config->GetSaveStats().writes, 2u);
+}
+
+TEST_F(ConfigManagerTest, DestructorFlushesPendingSave) {
+    config->SetSaveDelay(std::chrono::seconds(10), std::chrono::seconds(10));
+    AppConfig appConfig;
+    appConfig.sensitivity = 3.5f;
+    config->SetConfig(appConfig);
+    config->RequestSave();
+    config.reset();
+    
+    ConfigManager loaded(testConfigPath);
+    ASSERT_TRUE(loaded.Load());
+    EXPECT_EQ(loaded.GetConfig().sensitivity, 3.5f);
+}
+
 TEST_F(ConfigManagerTest, ProcessingConfigConversion) {
     AppConfig appConfig;
     appConfig.sensitivity = 2.0f;
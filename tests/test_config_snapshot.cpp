@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+#include "core/InputProcessor.h"
+#include <atomic>
+#include <cmath>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+// Config variants whose outputs for a fixed delta are all distinct, so a
+// torn read (fields from two configs) would show up as an unknown value
+ProcessingConfig Variant(int index) {
+    ProcessingConfig config;
+    config.sensitivity = 1.0f + 0.25f * static_cast<float>(index % 4);
+    config.invertY = (index / 4) % 2 != 0;
+    config.countsPerMeter = (800.0f + 300.0f * static_cast<float>(index / 8)) * 39.3701f;
+    return config;
+}
+
+constexpr int kVariants = 16;
+const MouseDelta kDelta{0, 40};
+constexpr float kDeltaTime = 0.01f;
+
+std::set<float> ExpectedOutputs() {
+    std::set<float> outputs;
+    for (int i = 0; i < kVariants; ++i) {
+        InputProcessor processor;
+        processor.SetConfig(Variant(i));
+        float x, y;
+        processor.ProcessDelta(kDelta, kDeltaTime, x, y);
+        outputs.insert(y);
+    }
+    return outputs;
+}
+
+} // namespace
+
+TEST(ConfigSnapshotTest, PublishIncrementsVersionAndPrecomputesScales) {
+    InputProcessor processor;
+    uint64_t initial = processor.GetConfigVersion();
+    EXPECT_GE(initial, 1u);
+
+    ProcessingConfig config;
+    config.sensitivity = 2.0f;
+    config.deadzone = 0.2f;
+    processor.SetConfig(config);
+    EXPECT_EQ(processor.GetConfigVersion(), initial + 1);
+
+    auto snapshot = ProcessingSnapshot::Create(config, 7);
+    EXPECT_EQ(snapshot->version, 7u);
+    EXPECT_FLOAT_EQ(snapshot->dpi, config.countsPerMeter / 39.3701f);
+    EXPECT_FLOAT_EQ(snapshot->stickScale, 0.0254f / 6.1f / snapshot->dpi * 2.0f);
+    EXPECT_FLOAT_EQ(snapshot->gameSpeedScale, 2.0f / config.countsPerMeter);
+    EXPECT_FLOAT_EQ(snapshot->deadzoneScale, 1.25f);
+}
+
+TEST(ConfigSnapshotTest, ModifyConfigKeepsOtherFields) {
+    InputProcessor processor;
+    ProcessingConfig config;
+    config.invertY = true;
+    config.deadzone = 0.1f;
+    processor.SetConfig(config);
+    processor.ModifyConfig([](ProcessingConfig& c) { c.sensitivity = 3.0f; });
+
+    ProcessingConfig current = processor.GetConfig();
+    EXPECT_EQ(current.sensitivity, 3.0f);
+    EXPECT_TRUE(current.invertY);
+    EXPECT_EQ(current.deadzone, 0.1f);
+}
+
+TEST(ConfigSnapshotTest, ProcessingThreadReleasesOldSnapshots) {
+    InputProcessor processor;
+    float x, y;
+    for (int i = 0; i < 100; ++i) {
+        processor.SetConfig(Variant(i % kVariants));
+        processor.ProcessDelta(kDelta, kDeltaTime, x, y);
+    }
+    // Newest plus at most the one the processing thread last saw
+    EXPECT_LE(processor.GetLiveSnapshotCount(), 2u);
+}
+
+TEST(ConfigSnapshotTest, PublishesWithoutTicksDoNotAccumulate) {
+    // Never started: nothing reads snapshots
+    InputProcessor processor;
+    for (int i = 0; i < 1000; ++i) {
+        processor.SetConfig(Variant(i % kVariants));
+    }
+    EXPECT_EQ(processor.GetLiveSnapshotCount(), 1u);
+
+    // Ticked, then released (parked or stopped)
+    float x, y;
+    processor.ProcessDelta(kDelta, kDeltaTime, x, y);
+    processor.ReleaseSnapshot();
+    for (int i = 0; i < 1000; ++i) {
+        processor.ModifyConfig([i](ProcessingConfig& c) { c.sensitivity = 1.0f + (i % 10) * 0.1f; });
+    }
+    EXPECT_EQ(processor.GetLiveSnapshotCount(), 1u);
+
+    // The next tick picks up the newest config
+    processor.ProcessDelta(kDelta, kDeltaTime, x, y);
+    EXPECT_LE(processor.GetLiveSnapshotCount(), 2u);
+    EXPECT_FLOAT_EQ(processor.GetConfig().sensitivity, 1.9f);
+}
+
+TEST(ConfigSnapshotTest, CalibrationPublishesNewCountsPerMeter) {
+    InputProcessor processor;
+    processor.StartCalibration();
+    float x, y;
+    for (int i = 0; i < 10; ++i) {
+        processor.ProcessDelta(MouseDelta{0, 100}, 0.01f, x, y);
+    }
+    uint64_t before = processor.GetConfigVersion();
+    processor.EndCalibration(0.5f);
+    EXPECT_FALSE(processor.IsCalibrating());
+    EXPECT_EQ(processor.GetConfigVersion(), before + 1);
+    EXPECT_FLOAT_EQ(processor.GetConfig().countsPerMeter, 2000.0f);
+}
+
+// Run under ThreadSanitizer (MOUSE2VR_SANITIZER=thread) to check the
+// publication protocol; without it this still checks for torn configs
+TEST(ConfigSnapshotTest, ConcurrentPublishersNeverTearTheHotPath) {
+    const std::set<float> expected = ExpectedOutputs();
+    ASSERT_EQ(expected.size(), static_cast<size_t>(kVariants));
+
+    InputProcessor processor;
+    processor.SetConfig(Variant(0));
+
+    std::atomic<bool> running{true};
+    std::atomic<int> torn{0};
+    std::atomic<uint64_t> ticks{0};
+
+    std::thread processing([&] {
+        uint64_t lastVersion = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            float x, y;
+            processor.ProcessDelta(kDelta, kDeltaTime, x, y);
+            if (expected.count(y) == 0) {
+                torn.fetch_add(1);
+            }
+            // Also exercise the UI-side getters from this thread's point of view
+            uint64_t version = processor.GetConfigVersion();
+            if (version < lastVersion) {
+                torn.fetch_add(1);
+            }
+            lastVersion = version;
+            ticks.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    std::vector<std::thread> publishers;
+    for (int t = 0; t < 3; ++t) {
+        publishers.emplace_back([&, t] {
+            for (int i = 0; i < 2000; ++i) {
+                if (i % 2 == 0) {
+                    processor.SetConfig(Variant((i + t) % kVariants));
+                } else {
+                    ProcessingConfig target = Variant((i * 3 + t) % kVariants);
+                    processor.ModifyConfig([&](ProcessingConfig& config) { config = target; });
+                }
+                (void)processor.GetConfig();
+                (void)processor.GetSpeedMetersPerSecond();
+                (void)processor.GetStickDeflectionPercent();
+            }
+        });
+    }
+    for (auto& publisher : publishers) {
+        publisher.join();
+    }
+    // Let the processing thread observe the final snapshot
+    uint64_t seen = ticks.load();
+    while (ticks.load() < seen + 10) {
+        std::this_thread::yield();
+    }
+    running = false;
+    processing.join();
+
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_GT(ticks.load(), 0u);
+    EXPECT_EQ(processor.GetConfigVersion(), 1u + 1u + 3u * 2000u);
+
+    // Everything the processing thread moved past goes on the next publish
+    processor.SetConfig(Variant(0));
+    EXPECT_LE(processor.GetLiveSnapshotCount(), 2u);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "common/Clock.h"
+#include "core/RecordingControllerSink.h"
+#include <memory>
+#include <vector>
+
+#ifdef __linux__
+#include "core/UinputControllerSink.h"
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace Mouse2VR;
+
+TEST(RecordingControllerSinkTest, RecordsReportsAtClockTime) {
+    auto clock = std::make_shared<SimulatedClock>(1000);
+    RecordingControllerSink sink(4, clock);
+    ASSERT_TRUE(sink.Initialize());
+
+    sink.SetLeftStick(0.0f, 0.25f);
+    sink.Update();
+    clock->AdvanceBy(500);
+    sink.SetLeftStick(0.5f, -0.5f);
+    sink.Update();
+
+    std::vector<RecordedReport> expected = {{1000, 0.0f, 0.25f}, {1500, 0.5f, -0.5f}};
+    EXPECT_EQ(sink.GetReports(), expected);
+    EXPECT_EQ(sink.GetUpdateCount(), 2u);
+    EXPECT_FLOAT_EQ(sink.GetLastY(), -0.5f);
+}
+
+TEST(RecordingControllerSinkTest, CountsReportsBeyondCapacity) {
+    RecordingControllerSink sink(2);
+    for (int i = 0; i < 5; ++i) {
+        sink.SetLeftStick(0.0f, i * 0.1f);
+        sink.Update();
+    }
+    EXPECT_EQ(sink.GetUpdateCount(), 5u);
+    EXPECT_EQ(sink.GetDroppedCount(), 3u);
+    ASSERT_EQ(sink.GetReports().size(), 2u);
+    EXPECT_FLOAT_EQ(sink.GetReports()[1].stickY, 0.1f);
+
+    sink.Clear();
+    EXPECT_EQ(sink.GetUpdateCount(), 0u);
+    EXPECT_TRUE(sink.GetReports().empty());
+}
+
+#ifdef __linux__
+class UinputControllerSinkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(pipe2(fds, O_NONBLOCK), 0);
+        sink = std::make_unique<UinputControllerSink>(fds[1], "test-pipe");
+        ASSERT_TRUE(sink->Initialize());
+    }
+
+    void TearDown() override {
+        sink.reset();  // Closes the write end
+        close(fds[0]);
+    }
+
+    // Events from one read(), i.e. one write() by the sink
+    std::vector<input_event> ReadBatch() {
+        input_event events[16];
+        ssize_t n = read(fds[0], events, sizeof(events));
+        if (n <= 0) {
+            return {};
+        }
+        return std::vector<input_event>(events, events + n / sizeof(input_event));
+    }
+
+    int fds[2] = {-1, -1};
+    std::unique_ptr<UinputControllerSink> sink;
+};
+
+TEST_F(UinputControllerSinkTest, FirstReportSendsEveryAxisInOneWrite) {
+    sink->SetLeftStick(0.0f, 0.5f);
+    sink->Update();
+
+    std::vector<input_event> batch = ReadBatch();
+    ASSERT_EQ(batch.size(), 5u);
+    EXPECT_EQ(batch[0].type, EV_ABS);
+    EXPECT_EQ(batch[0].code, ABS_X);
+    EXPECT_EQ(batch[0].value, 0);
+    EXPECT_EQ(batch[1].code, ABS_Y);
+    EXPECT_EQ(batch[1].value, UinputControllerSink::FloatToAxis(-0.5f));  // Forward is up (negative)
+    EXPECT_EQ(batch[2].code, ABS_RX);
+    EXPECT_EQ(batch[3].code, ABS_RY);
+    EXPECT_EQ(batch[4].type, EV_SYN);
+    EXPECT_EQ(batch[4].code, SYN_REPORT);
+    EXPECT_EQ(sink->GetWriteCount(), 1u);
+    EXPECT_EQ(sink->GetEventCount(), 5u);
+}
+
+TEST_F(UinputControllerSinkTest, LaterReportsSendOnlyChangedAxes) {
+    sink->SetLeftStick(0.0f, 0.5f);
+    sink->Update();
+    ReadBatch();
+
+    sink->SetLeftStick(0.0f, 0.75f);
+    sink->Update();
+    std::vector<input_event> batch = ReadBatch();
+    ASSERT_EQ(batch.size(), 2u);
+    EXPECT_EQ(batch[0].code, ABS_Y);
+    EXPECT_EQ(batch[0].value, UinputControllerSink::FloatToAxis(-0.75f));
+    EXPECT_EQ(batch[1].type, EV_SYN);
+
+    // Unchanged: nothing is written
+    sink->Update();
+    EXPECT_TRUE(ReadBatch().empty());
+    EXPECT_EQ(sink->GetWriteCount(), 2u);
+    EXPECT_EQ(sink->GetUnchangedCount(), 1u);
+}
+
+TEST_F(UinputControllerSinkTest, AxisConversionClampsToRange) {
+    EXPECT_EQ(UinputControllerSink::FloatToAxis(0.0f), 0);
+    EXPECT_EQ(UinputControllerSink::FloatToAxis(1.0f), UinputControllerSink::kAxisMax);
+    EXPECT_EQ(UinputControllerSink::FloatToAxis(2.0f), UinputControllerSink::kAxisMax);
+    EXPECT_EQ(UinputControllerSink::FloatToAxis(-2.0f), -UinputControllerSink::kAxisMax);
+}
+
+TEST(UinputDeviceTest, CreatesVirtualGamepad) {
+    if (access("/dev/uinput", W_OK) != 0) {
+        GTEST_SKIP() << "/dev/uinput is not writable";
+    }
+    UinputControllerSink sink;
+    ASSERT_TRUE(sink.Initialize());
+    sink.SetLeftStick(0.0f, 1.0f);
+    sink.Update();
+    EXPECT_EQ(sink.GetWriteCount(), 1u);
+    EXPECT_EQ(sink.GetFailedWriteCount(), 0u);
+    sink.Shutdown();
+    EXPECT_FALSE(sink.IsConnected());
+}
+#endif
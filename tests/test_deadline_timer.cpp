@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include "common/DeadlineTimer.h"
+#include "core/ActivityTracker.h"
+#include "core/InputSampleQueue.h"
+#include <algorithm>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+const TimerStrategy kStrategies[] = {TimerStrategy::Precise, TimerStrategy::TimerFd, TimerStrategy::SleepSpin};
+
+} // namespace
+
+TEST(DeadlineTimerTest, StrategyNamesRoundTrip) {
+    for (TimerStrategy strategy : kStrategies) {
+        EXPECT_EQ(TimerStrategyFromString(TimerStrategyToString(strategy)), strategy);
+    }
+    EXPECT_EQ(TimerStrategyFromString("bogus"), TimerStrategy::Precise);
+}
+
+TEST(DeadlineTimerTest, NeverReturnsEarly) {
+    for (TimerStrategy strategy : kStrategies) {
+        SCOPED_TRACE(TimerStrategyToString(strategy));
+        DeadlineTimer timer(strategy);
+        for (int i = 0; i < 20; ++i) {
+            int64_t deadline = InputSampleQueue::NowNs() + 1000000 + i * 50000;
+            int64_t lateness = timer.WaitUntil(deadline);
+            EXPECT_GE(lateness, 0);
+            EXPECT_GE(InputSampleQueue::NowNs(), deadline);
+        }
+    }
+}
+
+TEST(DeadlineTimerTest, PastDeadlineReturnsImmediately) {
+    DeadlineTimer timer;
+    int64_t now = InputSampleQueue::NowNs();
+    int64_t lateness = timer.WaitUntil(now - 5000000);
+    EXPECT_GE(lateness, 5000000);
+    EXPECT_LT(InputSampleQueue::NowNs() - now, 1000000);
+}
+
+TEST(DeadlineTimerTest, StrategySwitchResetsSpinTail) {
+    DeadlineTimer timer(TimerStrategy::SleepSpin);
+    EXPECT_EQ(timer.GetSpinTailNs(), DeadlineTimer::DefaultSpinTailNs(TimerStrategy::SleepSpin));
+    timer.SetSpinTailNs(-5);
+    EXPECT_EQ(timer.GetSpinTailNs(), 0);
+    
+    timer.SetStrategy(TimerStrategy::TimerFd);
+    EXPECT_EQ(timer.GetStrategy(), TimerStrategy::TimerFd);
+    EXPECT_LT(timer.GetSpinTailNs(), DeadlineTimer::DefaultSpinTailNs(TimerStrategy::SleepSpin));
+}
+
+TEST(DeadlineTimerTest, KernelSleepSpinsLessThanSleepSpin) {
+    // 50 ticks at 200 Hz each; the kernel-sleep strategies only spin the
+    // short tail, the original scheduler spins the last 2 ms of every tick
+    auto cpuFor = [](TimerStrategy strategy) {
+        DeadlineTimer timer(strategy);
+        int64_t cpuStart = ThreadCpuTimeNs();
+        int64_t deadline = InputSampleQueue::NowNs();
+        for (int i = 0; i < 50; ++i) {
+            deadline += 5000000;
+            timer.WaitUntil(deadline);
+        }
+        return ThreadCpuTimeNs() - cpuStart;
+    };
+    int64_t sleepSpin = cpuFor(TimerStrategy::SleepSpin);
+    int64_t precise = cpuFor(TimerStrategy::Precise);
+    EXPECT_LT(precise * 2, sleepSpin);
+}
@@ -0,0 +1,200 @@
+#include <gtest/gtest.h>
+#include "core/EvdevInputSource.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace Mouse2VR;
+using namespace std::chrono_literals;
+
+namespace {
+
+input_event MakeEvent(uint16_t type, uint16_t code, int32_t value) {
+    input_event ev = {};
+    ev.type = type;
+    ev.code = code;
+    ev.value = value;
+    return ev;
+}
+
+// One mouse report: REL_X/REL_Y followed by SYN_REPORT
+void AppendReport(std::vector<input_event>& events, int32_t dx, int32_t dy) {
+    if (dx != 0) events.push_back(MakeEvent(EV_REL, REL_X, dx));
+    if (dy != 0) events.push_back(MakeEvent(EV_REL, REL_Y, dy));
+    events.push_back(MakeEvent(EV_SYN, SYN_REPORT, 0));
+}
+
+void WriteAll(int fd, const void* data, size_t size) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    while (size > 0) {
+        ssize_t n = write(fd, bytes, size);
+        ASSERT_GT(n, 0);
+        bytes += n;
+        size -= static_cast<size_t>(n);
+    }
+}
+
+template <typename Pred>
+bool WaitFor(Pred pred, std::chrono::milliseconds timeout = 2000ms) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!pred()) {
+        if (std::chrono::steady_clock::now() > deadline) return false;
+        std::this_thread::sleep_for(1ms);
+    }
+    return true;
+}
+
+} // namespace
+
+class EvdevInputSourceTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        ASSERT_EQ(pipe(fds), 0);
+        source = std::make_unique<EvdevInputSource>(fds[0], "test-pipe");
+    }
+
+    void TearDown() override {
+        source.reset();  // Closes the read end
+        if (fds[1] >= 0) close(fds[1]);
+    }
+
+    int fds[2] = {-1, -1};
+    std::unique_ptr<EvdevInputSource> source;
+};
+
+TEST_F(EvdevInputSourceTest, AccumulatesMotionUntilSynReport) {
+    ASSERT_TRUE(source->Start());
+
+    std::vector<input_event> events;
+    events.push_back(MakeEvent(EV_REL, REL_Y, 3));
+    events.push_back(MakeEvent(EV_REL, REL_Y, 4));
+    events.push_back(MakeEvent(EV_REL, REL_X, -1));
+    events.push_back(MakeEvent(EV_SYN, SYN_REPORT, 0));
+    WriteAll(fds[1], events.data(), events.size() * sizeof(input_event));
+
+    ASSERT_TRUE(WaitFor([&] { return source->GetSampleCount() == 1; }));
+
+    InputSample samples[4];
+    ASSERT_EQ(source->DrainSamples(samples, 4), 1u);
+    EXPECT_EQ(samples[0].dx, -1);
+    EXPECT_EQ(samples[0].dy, 7);
+    EXPECT_GT(samples[0].timestampNs, 0);
+}
+
+TEST_F(EvdevInputSourceTest, ReadsManyEventsPerRead) {
+    std::vector<input_event> events;
+    for (int i = 0; i < 20; ++i) {
+        AppendReport(events, 0, 1);
+    }
+    // Written before Start(): everything is pending in the pipe at once
+    WriteAll(fds[1], events.data(), events.size() * sizeof(input_event));
+
+    ASSERT_TRUE(source->Start());
+    ASSERT_TRUE(WaitFor([&] { return source->GetSampleCount() == 20; }));
+
+    EXPECT_EQ(source->GetEventCount(), 40u);
+    EXPECT_LT(source->GetReadCount(), 40u / EvdevInputSource::kReadBatch + 2);
+
+    MouseDelta total = source->GetAndResetDeltas();
+    EXPECT_EQ(total.y, 20);
+}
+
+TEST_F(EvdevInputSourceTest, HandlesEventSplitAcrossWrites) {
+    ASSERT_TRUE(source->Start());
+
+    std::vector<input_event> events;
+    AppendReport(events, 0, 5);
+    const auto* bytes = reinterpret_cast<const unsigned char*>(events.data());
+    const size_t total = events.size() * sizeof(input_event);
+    const size_t split = sizeof(input_event) / 2;
+
+    WriteAll(fds[1], bytes, split);
+    std::this_thread::sleep_for(10ms);
+    WriteAll(fds[1], bytes + split, total - split);
+
+    ASSERT_TRUE(WaitFor([&] { return source->GetSampleCount() == 1; }));
+    EXPECT_EQ(source->GetAndResetDeltas().y, 5);
+}
+
+TEST_F(EvdevInputSourceTest, SynDroppedDiscardsPartialReport) {
+    std::vector<input_event> events;
+    events.push_back(MakeEvent(EV_REL, REL_Y, 100));
+    events.push_back(MakeEvent(EV_SYN, SYN_DROPPED, 0));
+    events.push_back(MakeEvent(EV_REL, REL_Y, 50));   // Still part of the dropped report
+    events.push_back(MakeEvent(EV_SYN, SYN_REPORT, 0));
+    AppendReport(events, 0, 2);
+
+    source->ProcessEvents(events.data(), events.size());
+
+    EXPECT_EQ(source->GetDroppedReportCount(), 1u);
+    EXPECT_EQ(source->GetAndResetDeltas().y, 2);
+}
+
+TEST_F(EvdevInputSourceTest, IgnoresOtherEventTypes) {
+    std::vector<input_event> events;
+    events.push_back(MakeEvent(EV_KEY, BTN_LEFT, 1));
+    events.push_back(MakeEvent(EV_REL, REL_WHEEL, 1));
+    events.push_back(MakeEvent(EV_SYN, SYN_REPORT, 0));
+
+    source->ProcessEvents(events.data(), events.size());
+    EXPECT_EQ(source->GetSampleCount(), 0u);
+}
+
+TEST_F(EvdevInputSourceTest, StopInterruptsIdleWait) {
+    ASSERT_TRUE(source->Start());
+    EXPECT_TRUE(source->IsRunning());
+
+    auto start = std::chrono::steady_clock::now();
+    source->Stop();
+    EXPECT_FALSE(source->IsRunning());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, 500ms);
+}
+
+TEST_F(EvdevInputSourceTest, ClosedPipeEndsStream) {
+    ASSERT_TRUE(source->Start());
+
+    std::vector<input_event> events;
+    AppendReport(events, 0, 9);
+    WriteAll(fds[1], events.data(), events.size() * sizeof(input_event));
+    close(fds[1]);
+    fds[1] = -1;
+
+    ASSERT_TRUE(WaitFor([&] { return source->IsAtEndOfStream(); }));
+    EXPECT_EQ(source->GetAndResetDeltas().y, 9);
+}
+
+TEST(EvdevInputSourceFileTest, ReadsRecordedRegularFile) {
+    std::string path = (std::filesystem::temp_directory_path() /
+                        ("evdev_test_" + std::to_string(getpid()) + ".bin")).string();
+
+    std::vector<input_event> events;
+    for (int i = 0; i < 500; ++i) {
+        AppendReport(events, 1, 2);
+    }
+    FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    std::fwrite(events.data(), sizeof(input_event), events.size(), f);
+    std::fclose(f);
+
+    // Regular files can't be added to epoll; the source streams them instead
+    EvdevInputSource source(path);
+    ASSERT_TRUE(source.Start());
+    ASSERT_TRUE(WaitFor([&] { return source.IsAtEndOfStream(); }));
+    source.Stop();
+
+    MouseDelta total = source.GetAndResetDeltas();
+    EXPECT_EQ(total.x, 500);
+    EXPECT_EQ(total.y, 1000);
+
+    std::filesystem::remove(path);
+}
+
+TEST(EvdevInputSourceFileTest, MissingDeviceFailsToStart) {
+    EvdevInputSource source("/dev/input/does-not-exist");
+    EXPECT_FALSE(source.Start());
+    EXPECT_FALSE(source.IsRunning());
+}
@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include "common/WakeEvent.h"
+#include "core/ActivityTracker.h"
+#include "core/InputSampleQueue.h"
+#include "core/OutputThrottle.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Mouse2VR;
+using namespace std::chrono_literals;
+
+// === WakeEvent ===
+
+TEST(WakeEventTest, SignalBeforeWaitIsNotLost) {
+    WakeEvent event;
+    event.Signal();
+    EXPECT_TRUE(event.WaitFor(0ns));
+}
+
+TEST(WakeEventTest, WaitConsumesSignal) {
+    WakeEvent event;
+    event.Signal();
+    EXPECT_TRUE(event.WaitFor(10ms));
+    EXPECT_FALSE(event.WaitFor(1ms));
+}
+
+TEST(WakeEventTest, TimesOutWithoutSignal) {
+    WakeEvent event;
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(event.WaitFor(5ms));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 5ms);
+}
+
+TEST(WakeEventTest, RepeatedSignalsReachKernelOnce) {
+    WakeEvent event;
+    for (int i = 0; i < 1000; ++i) {
+        event.Signal();
+    }
+    EXPECT_EQ(event.GetKernelSignalCount(), 1u);
+    EXPECT_TRUE(event.WaitFor(0ns));
+    
+    event.Signal();
+    EXPECT_EQ(event.GetKernelSignalCount(), 2u);
+}
+
+TEST(WakeEventTest, WakesBlockedThreadPromptly) {
+    WakeEvent event;
+    std::atomic<int64_t> signaledAt{0};
+    std::vector<int64_t> latencies;
+    
+    for (int i = 0; i < 20; ++i) {
+        std::thread producer([&] {
+            std::this_thread::sleep_for(2ms);
+            signaledAt = InputSampleQueue::NowNs();
+            event.Signal();
+        });
+        ASSERT_TRUE(event.WaitFor(1s));
+        latencies.push_back(InputSampleQueue::NowNs() - signaledAt.load());
+        producer.join();
+    }
+    
+    // Typically tens of microseconds; the bound only guards against a
+    // regression to polling at the idle interval
+    std::sort(latencies.begin(), latencies.end());
+    EXPECT_LT(latencies[latencies.size() / 2], 5000000);
+}
+
+TEST(WakeEventTest, QueuePushSignalsAttachedEvent) {
+    WakeEvent event;
+    InputSampleQueue queue;
+    queue.Push(0, 1);
+    EXPECT_FALSE(event.WaitFor(0ns));
+    
+    queue.SetWakeEvent(&event);
+    queue.Push(0, 2);
+    EXPECT_TRUE(event.WaitFor(0ns));
+    EXPECT_EQ(queue.DrainAggregate().y, 3);
+    
+    queue.SetWakeEvent(nullptr);
+    queue.Push(0, 4);
+    EXPECT_FALSE(event.WaitFor(0ns));
+}
+
+TEST(WakeEventTest, NoSampleIsMissedAcrossWakes) {
+    WakeEvent event;
+    InputSampleQueue queue;
+    queue.SetWakeEvent(&event);
+    
+    constexpr int kSamples = 100000;
+    std::thread producer([&] {
+        for (int i = 0; i < kSamples; ++i) {
+            queue.Push(0, 1);
+        }
+    });
+    
+    // A wake must always find every sample pushed before the signal, so
+    // waiting only after a signal still collects the full total
+    long total = 0;
+    while (total < kSamples) {
+        ASSERT_TRUE(event.WaitFor(1s)) << "lost wake with " << total << " counts";
+        total += queue.DrainAggregate().y;
+    }
+    producer.join();
+    EXPECT_EQ(total + queue.DrainAggregate().y, kSamples);
+}
+
+// === OutputThrottle ===
+
+TEST(OutputThrottleTest, LoneEventIsForwardedImmediately) {
+    OutputThrottle throttle;
+    throttle.Configure(1000000, 1000);  // 1 ms window, 1 kHz cap
+    
+    EXPECT_EQ(throttle.OnInput(5000000), 5000000);
+    throttle.OnOutput(5000000);
+    
+    // Next event well after the window: also immediate
+    EXPECT_EQ(throttle.OnInput(50000000), 50000000);
+}
+
+TEST(OutputThrottleTest, BurstIsHeldUntilWindowElapses) {
+    OutputThrottle throttle;
+    throttle.Configure(2000000, 0);  // 2 ms window, no rate cap
+    
+    EXPECT_EQ(throttle.OnInput(0), 0);
+    throttle.OnOutput(0);
+    
+    // 8 kHz reports: everything inside the window joins one output at 2 ms
+    EXPECT_EQ(throttle.OnInput(125000), 2000000);
+    EXPECT_EQ(throttle.OnInput(250000), 2000000);
+    throttle.OnOutput(2000000);
+    EXPECT_EQ(throttle.OnInput(2125000), 4000000);
+}
+
+TEST(OutputThrottleTest, RateCapAppliesToLoneEvents) {
+    OutputThrottle throttle;
+    throttle.Configure(0, 500);  // No coalescing, 2 ms minimum spacing
+    
+    throttle.OnOutput(10000000);  // e.g. an idle update
+    EXPECT_EQ(throttle.OnInput(10500000), 12000000);
+    EXPECT_EQ(throttle.OnInput(20000000), 20000000);
+}
+
+TEST(OutputThrottleTest, ResetForgetsHistory) {
+    OutputThrottle throttle;
+    throttle.Configure(1000000, 100);
+    throttle.OnInput(0);
+    throttle.OnOutput(0);
+    throttle.Reset();
+    EXPECT_EQ(throttle.OnInput(100), 100);
+}
+
+// === ActivityTracker ===
+
+TEST(ActivityTrackerTest, IdlesOnlyAfterFullTimeout) {
+    ActivityTracker tracker;
+    tracker.Configure(500000000);  // 500 ms
+    
+    EXPECT_FALSE(tracker.Update(true, 0));
+    EXPECT_FALSE(tracker.Update(false, 250000000));
+    EXPECT_FALSE(tracker.Update(false, 499000000));
+    EXPECT_EQ(tracker.GetState(), ActivityState::Active);
+    
+    EXPECT_TRUE(tracker.Update(false, 500000000));
+    EXPECT_TRUE(tracker.IsIdle());
+    EXPECT_FALSE(tracker.Update(false, 600000000));
+}
+
+TEST(ActivityTrackerTest, FirstCountWakesImmediately) {
+    ActivityTracker tracker;
+    tracker.Configure(100000000);
+    tracker.Update(false, 0);
+    tracker.Update(false, 100000000);
+    ASSERT_TRUE(tracker.IsIdle());
+    
+    EXPECT_TRUE(tracker.Update(true, 100000001));
+    EXPECT_EQ(tracker.GetState(), ActivityState::Active);
+}
+
+TEST(ActivityTrackerTest, StrideGapsDoNotFlap) {
+    ActivityTracker tracker;
+    tracker.Configure(300000000);
+    
+    // Walking: 200 ms of counts then 150 ms of stance, repeated
+    int transitions = 0;
+    for (int64_t t = 0; t < 5000000000LL; t += 10000000) {
+        bool moving = (t % 350000000) < 200000000;
+        transitions += tracker.Update(moving, t) ? 1 : 0;
+    }
+    EXPECT_EQ(transitions, 0);
+    EXPECT_FALSE(tracker.IsIdle());
+}
+
+TEST(ActivityTrackerTest, ResetRestartsTimeout) {
+    ActivityTracker tracker;
+    tracker.Configure(100000000);
+    tracker.Update(false, 0);
+    tracker.Update(false, 200000000);
+    ASSERT_TRUE(tracker.IsIdle());
+    
+    tracker.Reset();
+    EXPECT_FALSE(tracker.IsIdle());
+    EXPECT_FALSE(tracker.Update(false, 10000000000LL));  // Timeout starts here
+    EXPECT_TRUE(tracker.Update(false, 10100000000LL));
+}
+
+TEST(ActivityTrackerTest, ThreadCpuTimeAdvancesWithWork) {
+    // Spin until this thread has been charged 5 ms; on a loaded machine
+    // that takes longer in wall time, so only a stalled clock times out
+    int64_t start = ThreadCpuTimeNs();
+    volatile double sink = 0.0;
+    auto timeout = std::chrono::steady_clock::now() + 10s;
+    while (ThreadCpuTimeNs() - start <= 5000000 && std::chrono::steady_clock::now() < timeout) {
+        for (int i = 0; i < 10000; ++i) {
+            sink = sink + 1.0;
+        }
+    }
+    EXPECT_GT(ThreadCpuTimeNs() - start, 5000000);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "core/FrameClock.h"
+#include "core/InputSampleQueue.h"
+#include <chrono>
+#include <thread>
+
+using namespace Mouse2VR;
+using namespace std::chrono_literals;
+
+namespace {
+
+constexpr int64_t kPeriod90Hz = 11111111;
+
+FrameTiming Timing(int64_t vsyncNs, int64_t periodNs) {
+    FrameTiming timing;
+    timing.vsyncNs = vsyncNs;
+    timing.periodNs = periodNs;
+    return timing;
+}
+
+} // namespace
+
+TEST(FrameClockTest, SourceNamesRoundTrip) {
+    EXPECT_EQ(FrameClockSourceFromString(FrameClockSourceToString(FrameClockSource::Udp)), FrameClockSource::Udp);
+    EXPECT_EQ(FrameClockSourceFromString(FrameClockSourceToString(FrameClockSource::None)), FrameClockSource::None);
+    EXPECT_EQ(FrameClockSourceFromString("bogus"), FrameClockSource::None);
+}
+
+TEST(FrameClockTest, GridPointsSitLeadBeforeVsync) {
+    int64_t vsync = 1000000000;
+    PhaseGrid grid = PhaseGrid::Create(Timing(vsync, kPeriod90Hz), 2000000, 90);
+    EXPECT_EQ(grid.stepNs, kPeriod90Hz);
+
+    int64_t next = grid.NextAfter(vsync);
+    EXPECT_EQ(next, vsync + kPeriod90Hz - 2000000);
+    EXPECT_EQ(grid.NextAfter(next), next + kPeriod90Hz);  // Strictly after
+    EXPECT_EQ(grid.ErrorAt(next), 0);
+}
+
+TEST(FrameClockTest, GridStepIsWholeTicksPerFrame) {
+    FrameTiming timing = Timing(0, kPeriod90Hz);
+    // 250 Hz against 90 Hz rounds to 3 updates per frame
+    EXPECT_EQ(PhaseGrid::Create(timing, 0, 250).stepNs, kPeriod90Hz / 3);
+    // 100 Hz is closest to one per frame
+    EXPECT_EQ(PhaseGrid::Create(timing, 0, 100).stepNs, kPeriod90Hz);
+    // 40 Hz is closest to one update every other frame
+    EXPECT_EQ(PhaseGrid::Create(timing, 0, 40).stepNs, kPeriod90Hz * 2);
+}
+
+TEST(FrameClockTest, GridAnchorIsStableAcrossVsyncs) {
+    PhaseGrid a = PhaseGrid::Create(Timing(5000000000, kPeriod90Hz), 1500000, 90);
+    PhaseGrid b = PhaseGrid::Create(Timing(5000000000 + 37 * kPeriod90Hz, kPeriod90Hz), 1500000, 90);
+    EXPECT_EQ(a.anchorNs, b.anchorNs);
+    EXPECT_EQ(a.NextAfter(7000000000), b.NextAfter(7000000000));
+}
+
+TEST(FrameClockTest, ErrorAtIsSignedToNearestPoint) {
+    PhaseGrid grid = PhaseGrid::Create(Timing(0, 10000000), 0, 100);
+    EXPECT_EQ(grid.ErrorAt(20300000), 300000);     // Late
+    EXPECT_EQ(grid.ErrorAt(19800000), -200000);    // Early
+    EXPECT_EQ(grid.ErrorAt(-100000), -100000);     // Negative times wrap correctly
+}
+
+TEST(FrameClockTest, SyntheticClockReportsLastVsync) {
+    SyntheticFrameClock clock(kPeriod90Hz, 1234567);
+    int64_t now = InputSampleQueue::NowNs();
+    FrameTiming timing = clock.GetTiming();
+    ASSERT_TRUE(timing.IsValid());
+    EXPECT_EQ(timing.periodNs, kPeriod90Hz);
+    EXPECT_LE(timing.vsyncNs, InputSampleQueue::NowNs());
+    EXPECT_GT(timing.vsyncNs, now - kPeriod90Hz);
+    EXPECT_EQ((timing.vsyncNs - 1234567) % kPeriod90Hz, 0);
+
+    clock.SetAvailable(false);
+    EXPECT_FALSE(clock.GetTiming().IsValid());
+}
+
+TEST(FrameClockTest, UdpLoopbackDeliversNewestTiming) {
+    UdpFrameClock clock(0);
+    ASSERT_TRUE(clock.IsOpen());
+    ASSERT_NE(clock.GetPort(), 0);
+    EXPECT_FALSE(clock.GetTiming().IsValid());
+
+    FrameClockSender sender(clock.GetPort());
+    ASSERT_TRUE(sender.IsOpen());
+    int64_t now = InputSampleQueue::NowNs();
+    EXPECT_TRUE(sender.Send(Timing(now - 3000000, kPeriod90Hz)));
+    EXPECT_TRUE(sender.Send(Timing(now, kPeriod90Hz)));
+
+    FrameTiming timing;
+    for (int i = 0; i < 100 && !timing.IsValid(); ++i) {
+        std::this_thread::sleep_for(1ms);
+        timing = clock.GetTiming();
+    }
+    ASSERT_TRUE(timing.IsValid());
+    std::this_thread::sleep_for(5ms);
+    timing = clock.GetTiming();
+    EXPECT_EQ(timing.vsyncNs, now);
+    EXPECT_EQ(timing.periodNs, kPeriod90Hz);
+    EXPECT_EQ(clock.GetPacketCount(), 2u);
+    EXPECT_EQ(clock.GetRejectedCount(), 0u);
+}
+
+TEST(FrameClockTest, UdpRejectsMalformedPackets) {
+    UdpFrameClock clock(0);
+    ASSERT_TRUE(clock.IsOpen());
+    FrameClockSender sender(clock.GetPort());
+
+    FrameTiming bad = Timing(InputSampleQueue::NowNs(), 0);  // Zero period
+    EXPECT_TRUE(sender.Send(bad));
+    std::this_thread::sleep_for(10ms);
+    EXPECT_FALSE(clock.GetTiming().IsValid());
+    EXPECT_EQ(clock.GetRejectedCount(), 1u);
+    EXPECT_EQ(clock.GetPacketCount(), 0u);
+}
+
+TEST(FrameClockTest, UdpTimingGoesStale) {
+    UdpFrameClock clock(0, 50000000);  // 50 ms
+    ASSERT_TRUE(clock.IsOpen());
+    FrameClockSender sender(clock.GetPort());
+    EXPECT_TRUE(sender.Send(Timing(InputSampleQueue::NowNs(), kPeriod90Hz)));
+
+    bool seen = false;
+    for (int i = 0; i < 30 && !seen; ++i) {
+        std::this_thread::sleep_for(1ms);
+        seen = clock.GetTiming().IsValid();
+    }
+    EXPECT_TRUE(seen);
+    std::this_thread::sleep_for(100ms);
+    EXPECT_FALSE(clock.GetTiming().IsValid());
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "common/LatencyHistogram.h"
+#include <cstdint>
+
+using namespace Mouse2VR;
+
+TEST(LatencyHistogramTest, EmptyHistogramReportsZeros) {
+    LatencyHistogram histogram;
+    LatencyStats stats = histogram.GetStats();
+    EXPECT_EQ(stats.count, 0u);
+    EXPECT_EQ(stats.p99Ns, 0);
+    EXPECT_EQ(stats.maxNs, 0);
+    EXPECT_EQ(histogram.GetPercentile(50.0), 0);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+    for (int64_t v = 0; v < 128; ++v) {
+        EXPECT_EQ(LatencyHistogram::BucketUpperBound(LatencyHistogram::BucketIndex(v)), v);
+    }
+}
+
+TEST(LatencyHistogramTest, BucketsAreMonotonicWithBoundedError) {
+    size_t lastIndex = 0;
+    for (int64_t v = 1; v < (int64_t{1} << 40); v = v + v / 7 + 1) {
+        size_t index = LatencyHistogram::BucketIndex(v);
+        ASSERT_GE(index, lastIndex);
+        ASSERT_LT(index, LatencyHistogram::kBucketCount);
+        
+        int64_t upper = LatencyHistogram::BucketUpperBound(index);
+        ASSERT_GE(upper, v);
+        ASSERT_LE(static_cast<double>(upper - v), static_cast<double>(v) / 64.0 + 1.0) << v;
+        lastIndex = index;
+    }
+}
+
+TEST(LatencyHistogramTest, HugeValuesAreClamped) {
+    EXPECT_EQ(LatencyHistogram::BucketIndex(INT64_MAX), LatencyHistogram::kBucketCount - 1);
+    EXPECT_EQ(LatencyHistogram::BucketIndex(-5), 0u);
+}
+
+TEST(LatencyHistogramTest, PercentilesOfUniformDistribution) {
+    LatencyHistogram histogram;
+    // 1..10000 microseconds
+    for (int64_t us = 1; us <= 10000; ++us) {
+        histogram.Record(us * 1000);
+    }
+    
+    LatencyStats stats = histogram.GetStats();
+    EXPECT_EQ(stats.count, 10000u);
+    EXPECT_EQ(stats.minNs, 1000);
+    EXPECT_EQ(stats.maxNs, 10000000);
+    EXPECT_NEAR(stats.meanNs, 5000500.0, 1.0);
+    EXPECT_NEAR(static_cast<double>(stats.p50Ns), 5000000.0, 5000000.0 / 64);
+    EXPECT_NEAR(static_cast<double>(stats.p90Ns), 9000000.0, 9000000.0 / 64);
+    EXPECT_NEAR(static_cast<double>(stats.p99Ns), 9900000.0, 9900000.0 / 64);
+    EXPECT_NEAR(static_cast<double>(stats.p999Ns), 9990000.0, 9990000.0 / 64);
+    EXPECT_LE(stats.p999Ns, stats.maxNs);
+}
+
+TEST(LatencyHistogramTest, TailIsVisible) {
+    LatencyHistogram histogram;
+    for (int i = 0; i < 9990; ++i) {
+        histogram.Record(100000);     // 100 us
+    }
+    for (int i = 0; i < 10; ++i) {
+        histogram.Record(50000000);   // 50 ms outliers
+    }
+    
+    LatencyStats stats = histogram.GetStats();
+    EXPECT_LE(stats.p99Ns, 100000 + 100000 / 64);
+    EXPECT_GE(stats.p999Ns, 100000);
+    EXPECT_EQ(histogram.GetPercentile(100.0), 50000000);
+    EXPECT_EQ(stats.maxNs, 50000000);
+}
+
+TEST(LatencyHistogramTest, ResetClearsEverything) {
+    LatencyHistogram histogram;
+    histogram.Record(12345);
+    histogram.Record(-10);  // Clock skew counts as zero
+    EXPECT_EQ(histogram.GetStats().minNs, 0);
+    
+    histogram.Reset();
+    EXPECT_EQ(histogram.GetCount(), 0u);
+    EXPECT_EQ(histogram.GetPercentile(99.0), 0);
+    
+    histogram.Record(777);
+    LatencyStats stats = histogram.GetStats();
+    EXPECT_EQ(stats.count, 1u);
+    EXPECT_EQ(stats.minNs, 777);
+    EXPECT_EQ(stats.maxNs, 777);
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+#include "common/Logger.h"
+#include <algorithm>
+
+using namespace Mouse2VR;
+
+class LoggerTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        Logger::Instance().SetComponentLevel("LoggerTest", Logger::INFO);
+    }
+    
+    int evaluations = 0;
+    
+    int Expensive() {
+        ++evaluations;
+        return 42;
+    }
+};
+
+TEST_F(LoggerTest, MaskFromLevelEnablesLevelAndAbove) {
+    EXPECT_EQ(Logger::MaskFromLevel(Logger::DEBUG), 0xFu);
+    EXPECT_EQ(Logger::MaskFromLevel(Logger::INFO), 0xEu);
+    EXPECT_EQ(Logger::MaskFromLevel(Logger::WARNING), 0xCu);
+    EXPECT_EQ(Logger::MaskFromLevel(Logger::ERROR_LEVEL), 0x8u);
+}
+
+TEST_F(LoggerTest, DisabledLevelDoesNotEvaluateArguments) {
+    Logger::Instance().SetComponentLevel("LoggerTest", Logger::WARNING);
+    
+    LOG_DEBUG("LoggerTest", "value={}", Expensive());
+    LOG_INFO("LoggerTest", "value={}", Expensive());
+    EXPECT_EQ(evaluations, 0);
+    
+    LOG_WARNING("LoggerTest", "value={}", Expensive());
+    EXPECT_EQ(evaluations, 1);
+}
+
+TEST_F(LoggerTest, LevelsCanBeToggledLive) {
+    // The same call site picks up runtime changes to its component
+    for (Logger::Level level : {Logger::ERROR_LEVEL, Logger::DEBUG, Logger::ERROR_LEVEL}) {
+        Logger::Instance().SetComponentLevel("LoggerTest", level);
+        LOG_DEBUG("LoggerTest", "toggle {}", Expensive());
+    }
+    EXPECT_EQ(evaluations, 1);
+}
+
+TEST_F(LoggerTest, ComponentsAreIsolated) {
+    Logger::Instance().SetComponentLevel("LoggerTest", Logger::DEBUG);
+    Logger::Instance().SetComponentLevel("LoggerTestOther", Logger::ERROR_LEVEL);
+    
+    EXPECT_TRUE(Logger::Instance().IsEnabled("LoggerTest", Logger::DEBUG));
+    EXPECT_FALSE(Logger::Instance().IsEnabled("LoggerTestOther", Logger::WARNING));
+    EXPECT_TRUE(Logger::Instance().IsEnabled("LoggerTestOther", Logger::ERROR_LEVEL));
+}
+
+TEST_F(LoggerTest, RegistryListsComponents) {
+    Logger::Instance().SetComponentMask("LoggerTestMask", 0x5u);
+    
+    auto masks = Logger::Instance().GetComponentMasks();
+    auto it = std::find_if(masks.begin(), masks.end(),
+                           [](const auto& entry) { return entry.first == "LoggerTestMask"; });
+    ASSERT_NE(it, masks.end());
+    EXPECT_EQ(it->second, 0x5u);
+    
+    // Lookups return the same entry every time
+    EXPECT_EQ(&Logger::Instance().GetComponent("LoggerTestMask"),
+              &Logger::Instance().GetComponent("LoggerTestMask"));
+}
+
+TEST_F(LoggerTest, PlainMessagesAreNotParsedAsFormats) {
+    Logger::Instance().SetComponentLevel("LoggerTest", Logger::DEBUG);
+    std::string message = "braces {} stay literal";
+    LOG_DEBUG("LoggerTest", message);
+    LOG_DEBUG("LoggerTest", "literal without arguments {}");
+    SUCCEED();
+}
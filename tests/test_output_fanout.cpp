@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "core/InputSampleQueue.h"
+#include "core/OutputFanout.h"
+#include "core/RecordingControllerSink.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+using namespace Mouse2VR;
+
+namespace {
+
+// Sink whose Update() takes a fixed time, as a stalled socket or disk would
+class SlowSink : public IControllerSink {
+public:
+    explicit SlowSink(std::chrono::milliseconds updateTime) : m_updateTime(updateTime) {}
+
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    bool IsConnected() const override { return true; }
+    const char* GetName() const override { return "slow"; }
+    void SetLeftStick(float, float y) override { m_y = y; }
+    void Update() override {
+        std::this_thread::sleep_for(m_updateTime);
+        m_lastY.store(m_y);
+        m_updates++;
+    }
+
+    float GetLastY() const { return m_lastY.load(); }
+    int GetUpdates() const { return m_updates.load(); }
+
+private:
+    std::chrono::milliseconds m_updateTime;
+    float m_y = 0.0f;
+    std::atomic<float> m_lastY{0.0f};
+    std::atomic<int> m_updates{0};
+};
+
+class FailingSink : public SlowSink {
+public:
+    FailingSink() : SlowSink(std::chrono::milliseconds(0)) {}
+    bool Initialize() override { return false; }
+};
+
+template <typename Predicate>
+bool WaitUntil(Predicate done, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!done()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(OutputFanoutTest, FollowingSinkGetsEveryPublishWhenKeepingUp) {
+    OutputFanout fanout;
+    auto sink = std::make_unique<RecordingControllerSink>(256);
+    RecordingControllerSink* recording = sink.get();
+    ASSERT_TRUE(fanout.AddSink(std::move(sink), 0));
+    fanout.Start();
+
+    for (int i = 1; i <= 20; ++i) {
+        fanout.Publish(0.0f, i * 0.05f, 1.0f);
+        ASSERT_TRUE(WaitUntil([&] { return recording->GetUpdateCount() == static_cast<uint64_t>(i); })) << i;
+    }
+    fanout.Stop();
+
+    EXPECT_FLOAT_EQ(recording->GetLastY(), 1.0f);
+    std::vector<OutputSinkStats> stats = fanout.GetStats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].name, "recording");
+    EXPECT_EQ(stats[0].delivered, 20u);
+    EXPECT_EQ(stats[0].skipped, 0u);
+    EXPECT_EQ(stats[0].repeated, 0u);
+    EXPECT_EQ(stats[0].age.count, 20u);
+}
+
+TEST(OutputFanoutTest, ResultsPublishedWhileStoppedAreNotSkipped) {
+    OutputFanout fanout;
+    auto sink = std::make_unique<RecordingControllerSink>(256);
+    RecordingControllerSink* recording = sink.get();
+    ASSERT_TRUE(fanout.AddSink(std::move(sink), 0));
+
+    uint64_t expected = 0;
+    auto publishAndWait = [&](int count) {
+        for (int i = 0; i < count; ++i) {
+            fanout.Publish(0.0f, 0.5f, 1.0f);
+            ++expected;
+            ASSERT_TRUE(WaitUntil([&] { return recording->GetUpdateCount() == expected; })) << expected;
+        }
+    };
+    fanout.Start();
+    publishAndWait(5);
+    fanout.Stop();
+    for (int i = 0; i < 10; ++i) {
+        fanout.Publish(0.0f, 0.0f, 0.0f);
+    }
+    fanout.Start();
+    publishAndWait(5);
+    fanout.Stop();
+
+    std::vector<OutputSinkStats> stats = fanout.GetStats();
+    ASSERT_EQ(stats.size(), 1u);
+    EXPECT_EQ(stats[0].delivered, 10u);
+    EXPECT_EQ(stats[0].skipped, 0u);
+}
+
+TEST(OutputFanoutTest, SlowSinkNeverDelaysPublisherOrOtherSinks) {
+    OutputFanout fanout;
+    auto slow = std::make_unique<SlowSink>(std::chrono::milliseconds(50));
+    SlowSink* slowSink = slow.get();
+    auto fast = std::make_unique<RecordingControllerSink>(4096);
+    RecordingControllerSink* fastSink = fast.get();
+    ASSERT_TRUE(fanout.AddSink(std::move(slow), 0));
+    ASSERT_TRUE(fanout.AddSink(std::move(fast), 0));
+    fanout.Start();
+
+    // 200 results at 1 kHz while the slow sink manages ~4
+    int64_t worstPublishNs = 0;
+    for (int i = 1; i <= 200; ++i) {
+        int64_t start = InputSampleQueue::NowNs();
+        fanout.Publish(0.0f, i / 200.0f, 0.0f);
+        worstPublishNs = std::max(worstPublishNs, InputSampleQueue::NowNs() - start);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_TRUE(WaitUntil([&] { return fastSink->GetLastY() == 1.0f && slowSink->GetLastY() == 1.0f; }));
+    fanout.Stop();
+
+    EXPECT_LT(worstPublishNs, 5000000);  // Never waits out a 50 ms Update()
+    std::vector<OutputSinkStats> stats = fanout.GetStats();
+    EXPECT_LT(stats[0].delivered, 20u);
+    EXPECT_GT(stats[0].skipped, 150u);
+    EXPECT_EQ(stats[0].delivered + stats[0].skipped, 200u);
+    EXPECT_GT(stats[1].delivered, stats[0].delivered * 5);
+    EXPECT_EQ(stats[1].delivered + stats[1].skipped, 200u);
+}
+
+TEST(OutputFanoutTest, PacedSinkRunsAtItsOwnRate) {
+    OutputFanout fanout;
+    auto sink = std::make_unique<RecordingControllerSink>(1024);
+    RecordingControllerSink* recording = sink.get();
+    ASSERT_TRUE(fanout.AddSink(std::move(sink), 100));
+    fanout.Start();
+
+    fanout.Publish(0.0f, 0.5f, 0.0f);  // One result, then nothing new
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    fanout.Stop();
+
+    // ~30 deliveries of the same result; allow for a loaded machine
+    std::vector<OutputSinkStats> stats = fanout.GetStats();
+    EXPECT_GE(stats[0].delivered, 10u);
+    EXPECT_LE(stats[0].delivered, 35u);
+    EXPECT_EQ(stats[0].repeated, stats[0].delivered - 1);
+    EXPECT_FLOAT_EQ(recording->GetLastY(), 0.5f);
+}
+
+TEST(OutputFanoutTest, RejectsSinksThatFailOrArriveWhileRunning) {
+    OutputFanout fanout;
+    EXPECT_FALSE(fanout.AddSink(std::make_unique<FailingSink>(), 0));
+    EXPECT_FALSE(fanout.AddSink(nullptr, 0));
+    fanout.Start();
+    EXPECT_FALSE(fanout.AddSink(std::make_unique<RecordingControllerSink>(), 0));
+    fanout.Stop();
+    EXPECT_EQ(fanout.GetSinkCount(), 0u);
+    EXPECT_EQ(fanout.ReadLatest().sequence, 0u);
+}
@@ -0,0 +1,389 @@
+#include <gtest/gtest.h>
+#include "core/Mouse2VRCore.h"
+#include "core/ConfigManager.h"
+#include "core/FrameClock.h"
+#include "core/IControllerSink.h"
+#include "core/IInputSource.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+using namespace Mouse2VR;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Input source fed directly by the test thread
+class SyntheticInputSource : public IInputSource {
+public:
+    bool Start() override { return true; }
+    void Stop() override {}
+    
+    MouseDelta GetAndResetDeltas() override {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        return m_samples.DrainAggregate();
+    }
+    
+    size_t DrainSamples(InputSample* out, size_t maxCount) override {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        return m_samples.Drain(out, maxCount);
+    }
+    
+    void SetWakeEvent(WakeEvent* wake) override { m_samples.SetWakeEvent(wake); }
+    uint64_t GetSampleCount() const override { return m_samples.GetPushedCount(); }
+    uint64_t GetMergedSampleCount() const override { return m_samples.GetMergedCount(); }
+    const char* GetName() const override { return "synthetic"; }
+    
+    void Push(int32_t dx, int32_t dy) { m_samples.Push(dx, dy); }
+
+private:
+    InputSampleQueue m_samples;
+    std::mutex m_drainMutex;
+};
+
+// Controller sink that only counts reports
+class MockControllerSink : public IControllerSink {
+public:
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    void SetLeftStick(float, float y) override { m_lastY = y; }
+    void Update() override { m_updates.fetch_add(1, std::memory_order_relaxed); }
+    bool IsConnected() const override { return true; }
+    const char* GetName() const override { return "mock"; }
+    
+    uint64_t GetUpdateCount() const { return m_updates.load(); }
+    float GetLastY() const { return m_lastY.load(); }
+
+private:
+    std::atomic<uint64_t> m_updates{0};
+    std::atomic<float> m_lastY{0.0f};
+};
+
+} // namespace
+
+class PipelineLatencyTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto source = std::make_unique<SyntheticInputSource>();
+        auto sink = std::make_unique<MockControllerSink>();
+        input = source.get();
+        controller = sink.get();
+        core = std::make_unique<Mouse2VRCore>();
+        ASSERT_TRUE(core->Initialize(std::move(source), std::move(sink)));
+    }
+    
+    void TearDown() override {
+        core->Shutdown();
+    }
+    
+    void Configure(int updateIntervalMs, bool eventDriven) {
+        AppConfig config;
+        config.updateIntervalMs = updateIntervalMs;
+        config.eventDriven = eventDriven;
+        config.coalesceWindowUs = 0;
+        config.maxOutputRateHz = 1000;
+        core->UpdateSettings(config);
+    }
+    
+    void ConfigureAdaptive(int updateIntervalMs, bool eventDriven, int idleUpdateIntervalMs, int idleTimeoutMs) {
+        AppConfig config;
+        config.updateIntervalMs = updateIntervalMs;
+        config.eventDriven = eventDriven;
+        config.coalesceWindowUs = 0;
+        config.maxOutputRateHz = 1000;
+        config.adaptiveMode = true;
+        config.idleUpdateIntervalMs = idleUpdateIntervalMs;
+        config.idleTimeoutMs = idleTimeoutMs;
+        core->UpdateSettings(config);
+    }
+    
+    // Updates published over the given duration
+    uint64_t CountUpdates(std::chrono::milliseconds duration) {
+        uint64_t before = controller->GetUpdateCount();
+        std::this_thread::sleep_for(duration);
+        return controller->GetUpdateCount() - before;
+    }
+    
+    // Push one sample and return how long the first update took to follow it
+    std::chrono::nanoseconds TimeToFirstUpdate() {
+        uint64_t before = controller->GetUpdateCount();
+        auto start = std::chrono::steady_clock::now();
+        input->Push(0, 20);
+        while (controller->GetUpdateCount() == before &&
+               std::chrono::steady_clock::now() - start < 1s) {
+            std::this_thread::yield();
+        }
+        return std::chrono::steady_clock::now() - start;
+    }
+    
+    // Walk at ~1 kHz input rate for the given duration; returns samples pushed
+    int Walk(std::chrono::milliseconds duration) {
+        int pushed = 0;
+        auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+            input->Push(0, 2);
+            pushed++;
+            std::this_thread::sleep_for(1ms);
+        }
+        return pushed;
+    }
+    
+    // Let the processing thread publish whatever is still queued
+    void Settle() {
+        std::this_thread::sleep_for(150ms);
+    }
+    
+    std::unique_ptr<Mouse2VRCore> core;
+    SyntheticInputSource* input = nullptr;
+    MockControllerSink* controller = nullptr;
+};
+
+TEST_F(PipelineLatencyTest, EverySampleIsMeasured) {
+    Configure(10, false);  // 100 Hz fixed rate
+    core->Start();
+    int pushed = Walk(200ms);
+    Settle();
+    core->Stop();
+    
+    LatencyStats stats = core->GetLatencyStats();
+    EXPECT_EQ(stats.count, static_cast<uint64_t>(pushed));
+    EXPECT_GT(controller->GetUpdateCount(), 0u);
+    EXPECT_LE(stats.minNs, stats.p50Ns);
+    EXPECT_LE(stats.p50Ns, stats.p99Ns);
+    EXPECT_LE(stats.p99Ns, stats.p999Ns);
+    EXPECT_LE(stats.p999Ns, stats.maxNs);
+    
+    // A sample waits at most one tick (plus scheduling noise) at 100 Hz
+    EXPECT_LT(stats.p50Ns, 20000000);
+}
+
+TEST_F(PipelineLatencyTest, ResetClearsStats) {
+    Configure(10, false);
+    core->Start();
+    Walk(50ms);
+    Settle();
+    EXPECT_GT(core->GetLatencyStats().count, 0u);
+    
+    core->ResetLatencyStats();
+    EXPECT_EQ(core->GetLatencyStats().count, 0u);
+    
+    Walk(50ms);
+    Settle();
+    core->Stop();
+    EXPECT_GT(core->GetLatencyStats().count, 0u);
+}
+
+TEST_F(PipelineLatencyTest, EventDrivenModeBeatsSlowFixedTick) {
+    // 10 Hz fixed: samples wait ~50 ms on average for the next tick
+    Configure(100, false);
+    core->Start();
+    Walk(300ms);
+    Settle();
+    LatencyStats fixedStats = core->GetLatencyStats();
+    
+    // Same idle rate, but input wakes the loop
+    core->ResetLatencyStats();
+    Configure(100, true);
+    std::this_thread::sleep_for(150ms);  // Let the loop switch schedulers
+    core->ResetLatencyStats();
+    Walk(300ms);
+    Settle();
+    core->Stop();
+    LatencyStats eventStats = core->GetLatencyStats();
+    
+    ASSERT_GT(fixedStats.count, 0u);
+    ASSERT_GT(eventStats.count, 0u);
+    EXPECT_GT(fixedStats.p50Ns, 10000000);
+    EXPECT_LT(eventStats.p50Ns, 5000000);
+    EXPECT_LT(eventStats.p50Ns * 4, fixedStats.p50Ns);
+    EXPECT_NE(controller->GetLastY(), 1.0f);
+}
+
+TEST_F(PipelineLatencyTest, AdaptiveModeDropsToIdleRate) {
+    ConfigureAdaptive(10, false, 50, 100);  // 100 Hz active, 20 Hz idle
+    core->Start();
+    uint64_t before = controller->GetUpdateCount();
+    Walk(200ms);
+    uint64_t active = controller->GetUpdateCount() - before;
+    std::this_thread::sleep_for(200ms);
+    uint64_t idle = CountUpdates(500ms);
+    
+    ActivityStats stats = core->GetActivityStats();
+    EXPECT_EQ(stats.state, ActivityState::Idle);
+    EXPECT_FALSE(stats.parked);
+    EXPECT_GE(stats.idleTransitions, 1u);
+    EXPECT_GT(stats.WallNs(ActivityState::Idle), 0);
+    EXPECT_GT(stats.Ticks(ActivityState::Idle), 0u);
+    EXPECT_GE(active, 15u);  // ~20 at 100 Hz
+    EXPECT_LE(idle, 15u);    // ~10 at 20 Hz
+    
+    // The first count restores the full rate without waiting out the idle tick
+    EXPECT_LT(TimeToFirstUpdate(), 20ms);
+    EXPECT_EQ(core->GetActivityStats().state, ActivityState::Active);
+    EXPECT_GE(CountUpdates(100ms), 7u);
+    core->Stop();
+}
+
+TEST_F(PipelineLatencyTest, ParkedSchedulerWaitsForInput) {
+    for (bool eventDriven : {false, true}) {
+        SCOPED_TRACE(eventDriven ? "event-driven" : "fixed rate");
+        ConfigureAdaptive(10, eventDriven, 0, 50);
+        core->Start();
+        Walk(50ms);
+        std::this_thread::sleep_for(200ms);
+        
+        ActivityStats stats = core->GetActivityStats();
+        EXPECT_TRUE(stats.parked);
+        EXPECT_EQ(stats.state, ActivityState::Idle);
+        EXPECT_EQ(controller->GetLastY(), 0.0f);  // Parked at center
+        EXPECT_EQ(CountUpdates(200ms), 0u);
+        
+        EXPECT_LT(TimeToFirstUpdate(), 20ms);
+        stats = core->GetActivityStats();
+        EXPECT_EQ(stats.state, ActivityState::Active);
+        EXPECT_GE(stats.wakeTransitions, 1u);
+        EXPECT_GT(controller->GetLastY(), 0.0f);
+        core->Stop();
+    }
+}
+
+TEST_F(PipelineLatencyTest, SettingsChangeUnparksScheduler) {
+    ConfigureAdaptive(10, false, 0, 50);
+    core->Start();
+    std::this_thread::sleep_for(150ms);
+    ASSERT_TRUE(core->GetActivityStats().parked);
+    
+    Configure(10, false);  // Adaptive off
+    std::this_thread::sleep_for(20ms);
+    EXPECT_FALSE(core->GetActivityStats().parked);
+    EXPECT_GE(CountUpdates(100ms), 7u);
+    core->Stop();
+}
+
+TEST_F(PipelineLatencyTest, ActivityStatsSplitCpuByState) {
+    ConfigureAdaptive(5, false, 0, 100);  // 200 Hz active, parked when idle
+    core->Start();
+    Walk(300ms);
+    std::this_thread::sleep_for(500ms);
+    core->Stop();
+    
+    // The fixed-rate scheduler spins the tail of every active tick; parked
+    // it costs nothing
+    ActivityStats stats = core->GetActivityStats();
+    EXPECT_GT(stats.WallNs(ActivityState::Active), 300000000);
+    EXPECT_GT(stats.WallNs(ActivityState::Idle), 300000000);
+    EXPECT_GT(stats.CpuNs(ActivityState::Active), 0);
+    EXPECT_LT(stats.CpuLoad(ActivityState::Idle), stats.CpuLoad(ActivityState::Active));
+    
+    core->ResetActivityStats();
+    stats = core->GetActivityStats();
+    EXPECT_EQ(stats.WallNs(ActivityState::Active), 0);
+    EXPECT_EQ(stats.Ticks(ActivityState::Active), 0u);
+}
+
+TEST_F(PipelineLatencyTest, SchedulerStatsRecordEveryTick) {
+    Configure(5, false);  // 200 Hz
+    core->Start();
+    Walk(300ms);
+    core->Stop();
+    
+    SchedulerStats stats = core->GetSchedulerStats();
+    EXPECT_EQ(stats.targetHz, 200);
+    EXPECT_GE(stats.ticks, 40u);
+    EXPECT_EQ(stats.tickTime.count, stats.ticks);
+    // Every tick after the first waits for (or misses) a deadline
+    EXPECT_GE(stats.lateness.count + 1, stats.ticks);
+    EXPECT_LE(stats.missedFrames, stats.lateness.count);
+    EXPECT_LE(stats.lateness.p50Ns, stats.lateness.p99Ns);
+    EXPECT_LE(stats.lateness.p99Ns, stats.lateness.maxNs);
+    EXPECT_LE(stats.tickTime.p50Ns, stats.tickTime.p99Ns);
+    EXPECT_GT(stats.tickTime.maxNs, 0);
+    
+    // A tick releases well within one interval of its deadline
+    EXPECT_LT(stats.lateness.p50Ns, 5000000);
+    
+    core->ResetSchedulerStats();
+    stats = core->GetSchedulerStats();
+    EXPECT_EQ(stats.ticks, 0u);
+    EXPECT_EQ(stats.lateness.count, 0u);
+    EXPECT_EQ(stats.tickTime.count, 0u);
+    EXPECT_EQ(stats.missedFrames, 0u);
+}
+
+TEST_F(PipelineLatencyTest, SchedulerStatsReadableWhileRunning) {
+    Configure(5, true);  // Event-driven
+    core->Start();
+    std::atomic<bool> done{false};
+    std::thread walker([&] {
+        Walk(200ms);
+        done = true;
+    });
+    
+    // Snapshots taken concurrently with the scheduler stay self-consistent
+    uint64_t lastTicks = 0;
+    while (!done) {
+        SchedulerStats stats = core->GetSchedulerStats();
+        EXPECT_GE(stats.ticks, lastTicks);
+        lastTicks = stats.ticks;
+        EXPECT_LE(stats.tickTime.p50Ns, stats.tickTime.maxNs);
+        std::this_thread::sleep_for(1ms);
+    }
+    walker.join();
+    core->Stop();
+    EXPECT_GT(core->GetSchedulerStats().ticks, 0u);
+}
+
+TEST_F(PipelineLatencyTest, FrameClockLocksUpdatePhase) {
+    // 90 Hz compositor; the 11 ms update rate rounds to one update per frame
+    ASSERT_TRUE(core->SetFrameClock(std::make_unique<SyntheticFrameClock>(11111111, 3000000)));
+    Configure(11, false);
+    core->SetFrameLead(2000);
+    
+    core->Start();
+    Walk(400ms);
+    core->Stop();
+    
+    PhaseStats stats = core->GetPhaseStats();
+    EXPECT_TRUE(stats.locked);
+    EXPECT_EQ(stats.framePeriodNs, 11111111);
+    EXPECT_EQ(stats.stepNs, 11111111);
+    EXPECT_EQ(stats.leadNs, 2000000);
+    EXPECT_GE(stats.lockedTicks, 25u);
+    EXPECT_LE(stats.unlockedTicks, 1u);
+    EXPECT_EQ(stats.absError.count + 1, stats.lockedTicks + stats.unlockedTicks);
+    // Updates land within a fraction of a millisecond of vsync - lead
+    EXPECT_LT(stats.absError.p50Ns, 500000);
+}
+
+TEST_F(PipelineLatencyTest, FrameClockLossFallsBackToFreeRunning) {
+    auto clock = std::make_unique<SyntheticFrameClock>(11111111);
+    SyntheticFrameClock* clockView = clock.get();
+    ASSERT_TRUE(core->SetFrameClock(std::move(clock)));
+    Configure(5, false);  // 200 Hz: two updates per 90 Hz frame while locked
+    core->Start();
+    EXPECT_FALSE(core->SetFrameClock(nullptr));  // Only while stopped
+    
+    Walk(100ms);
+    PhaseStats locked = core->GetPhaseStats();
+    EXPECT_TRUE(locked.locked);
+    EXPECT_EQ(locked.stepNs, 11111111 / 2);
+    
+    // A stalled feed leaves the scheduler at its own rate
+    clockView->SetAvailable(false);
+    std::this_thread::sleep_for(20ms);
+    core->ResetPhaseStats();
+    uint64_t updates = CountUpdates(200ms);
+    PhaseStats unlocked = core->GetPhaseStats();
+    EXPECT_FALSE(unlocked.locked);
+    EXPECT_EQ(unlocked.lockedTicks, 0u);
+    EXPECT_GE(unlocked.unlockedTicks, 20u);
+    EXPECT_GE(updates, 20u);
+    
+    // And it relocks as soon as timing returns
+    clockView->SetAvailable(true);
+    std::this_thread::sleep_for(50ms);
+    EXPECT_TRUE(core->GetPhaseStats().locked);
+    core->Stop();
+}
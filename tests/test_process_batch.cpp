@@ -0,0 +1,168 @@
+#include <gtest/gtest.h>
+#include "core/InputProcessor.h"
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+uint32_t Bits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+struct Inputs {
+    std::vector<MouseDelta> deltas;
+    std::vector<float> deltaTimes;
+};
+
+// Mix of idle ticks, walking, sprint bursts that hit the clamp, reversed
+// motion and degenerate tick lengths
+Inputs MakeInputs(size_t count, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> small(-40, 40);
+    std::uniform_int_distribution<int> large(-5000, 5000);
+    std::uniform_int_distribution<int> pick(0, 19);
+    std::uniform_real_distribution<float> dt(0.001f, 0.03f);
+
+    Inputs inputs;
+    for (size_t i = 0; i < count; ++i) {
+        int kind = pick(rng);
+        MouseDelta delta;
+        if (kind < 3) {
+            // Idle
+        } else if (kind < 16) {
+            delta = {small(rng), small(rng)};
+        } else {
+            delta = {large(rng), large(rng)};
+        }
+        float t = dt(rng);
+        if (kind == 18) t = 0.0f;
+        if (kind == 19 && i % 3 == 0) t = -0.005f;
+        inputs.deltas.push_back(delta);
+        inputs.deltaTimes.push_back(t);
+    }
+    return inputs;
+}
+
+void ExpectBitIdentical(const ProcessingConfig& config, SimdLevel level, const Inputs& inputs, size_t chunk) {
+    InputProcessor scalar;
+    scalar.SetConfig(config);
+    InputProcessor batch;
+    batch.SetConfig(config);
+    batch.SetSimdLevel(level);
+
+    const size_t count = inputs.deltas.size();
+    std::vector<float> x(count), y(count), speed(count);
+    for (size_t begin = 0; begin < count; begin += chunk) {
+        size_t n = std::min(chunk, count - begin);
+        batch.ProcessBatch(std::span(inputs.deltas).subspan(begin, n),
+                           std::span(inputs.deltaTimes).subspan(begin, n),
+                           std::span(x).subspan(begin, n), std::span(y).subspan(begin, n),
+                           std::span(speed).subspan(begin, n));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        float sx, sy;
+        scalar.ProcessDelta(inputs.deltas[i], inputs.deltaTimes[i], sx, sy);
+        ASSERT_EQ(Bits(x[i]), Bits(sx)) << SimdLevelToString(level) << " x at " << i;
+        ASSERT_EQ(Bits(y[i]), Bits(sy)) << SimdLevelToString(level) << " y at " << i;
+        ASSERT_EQ(Bits(speed[i]), Bits(scalar.GetSpeedMetersPerSecond())) << "speed at " << i;
+    }
+    EXPECT_EQ(batch.GetStickDeflectionPercent(), scalar.GetStickDeflectionPercent());
+    EXPECT_EQ(batch.GetRealWorldSpeed(), scalar.GetRealWorldSpeed());
+}
+
+std::vector<SimdLevel> SupportedLevels() {
+    std::vector<SimdLevel> levels = {SimdLevel::Scalar};
+    if (DetectSimdLevel() >= SimdLevel::Sse2) levels.push_back(SimdLevel::Sse2);
+    if (DetectSimdLevel() >= SimdLevel::Avx2) levels.push_back(SimdLevel::Avx2);
+    return levels;
+}
+
+} // namespace
+
+TEST(ProcessBatchTest, MatchesProcessDeltaForDefaultConfig) {
+    Inputs inputs = MakeInputs(1003, 1);
+    for (SimdLevel level : SupportedLevels()) {
+        ExpectBitIdentical(ProcessingConfig{}, level, inputs, inputs.deltas.size());
+    }
+}
+
+TEST(ProcessBatchTest, MatchesProcessDeltaAcrossConfigs) {
+    Inputs inputs = MakeInputs(517, 2);
+    for (int variant = 0; variant < 64; ++variant) {
+        ProcessingConfig config;
+        config.invertX = (variant & 1) != 0;
+        config.invertY = (variant & 2) != 0;
+        config.lockX = (variant & 4) != 0;
+        config.deadzone = (variant & 8) ? 0.07f : 0.0f;
+        config.maxSpeed = (variant & 16) ? 0.6f : 1.0f;
+        config.sensitivity = (variant & 32) ? 2.5f : 1.0f;
+        config.countsPerMeter = 800 * 39.3701f;
+        for (SimdLevel level : SupportedLevels()) {
+            ExpectBitIdentical(config, level, inputs, inputs.deltas.size());
+        }
+    }
+}
+
+TEST(ProcessBatchTest, MatchesWithFiltersPredictionAndChunking) {
+    Inputs inputs = MakeInputs(2000, 3);
+    ProcessingConfig config;
+    config.velocity.filter = VelocityFilter::OneEuro;
+    config.prediction.enabled = true;
+    config.deadzone = 0.02f;
+    config.lockY = true;
+    for (SimdLevel level : SupportedLevels()) {
+        for (size_t chunk : {1u, 7u, 64u, 333u}) {
+            ExpectBitIdentical(config, level, inputs, chunk);
+        }
+    }
+}
+
+TEST(ProcessBatchTest, MatchesWithResponseCurves) {
+    Inputs inputs = MakeInputs(1500, 5);
+    for (ResponseCurveType type : {ResponseCurveType::Piecewise, ResponseCurveType::Spline,
+                                   ResponseCurveType::Gamma}) {
+        ProcessingConfig config;
+        config.curve.type = type;
+        config.curve.gamma = 0.7f;
+        config.curve.inputMax = 0.8f;
+        config.curve.points = {{0.1f, 0.3f}, {0.4f, 0.8f}, {0.7f, 1.0f}};
+        config.deadzone = 0.03f;
+        for (SimdLevel level : SupportedLevels()) {
+            ExpectBitIdentical(config, level, inputs, inputs.deltas.size());
+        }
+    }
+}
+
+TEST(ProcessBatchTest, ZeroDpiOutputsZero) {
+    ProcessingConfig config;
+    config.countsPerMeter = 0.0f;
+    Inputs inputs = MakeInputs(64, 4);
+    for (SimdLevel level : SupportedLevels()) {
+        ExpectBitIdentical(config, level, inputs, inputs.deltas.size());
+    }
+}
+
+TEST(ProcessBatchTest, UsesShortestSpan) {
+    InputProcessor processor;
+    std::vector<MouseDelta> deltas(10, MouseDelta{0, 50});
+    std::vector<float> dts(10, 0.01f);
+    std::vector<float> x(4, -1.0f), y(10, -1.0f), speed(10, -1.0f);
+    processor.ProcessBatch(deltas, dts, x, y, speed);
+    EXPECT_NE(y[3], -1.0f);
+    EXPECT_EQ(y[4], -1.0f);
+}
+
+TEST(ProcessBatchTest, SimdLevelIsCappedBySupport) {
+    InputProcessor processor;
+    processor.SetSimdLevel(SimdLevel::Avx2);
+    EXPECT_LE(processor.GetSimdLevel(), DetectSimdLevel());
+    processor.SetSimdLevel(SimdLevel::Scalar);
+    EXPECT_EQ(processor.GetSimdLevel(), SimdLevel::Scalar);
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "core/ActivityTracker.h"
+#include "core/InputProcessor.h"
+#include "core/ResponseCurve.h"
+#include <cmath>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+ResponseCurveConfig WalkRunPoints(ResponseCurveType type) {
+    // Slow walking gets a boost, running saturates early
+    ResponseCurveConfig config;
+    config.type = type;
+    config.points = {{0.05f, 0.2f}, {0.2f, 0.5f}, {0.35f, 0.9f}, {0.5f, 1.0f}};
+    return config;
+}
+
+// Largest |table - exact| over a dense sweep of the input range
+float MaxLutError(const ResponseCurve& curve, float inputMax) {
+    float worst = 0.0f;
+    for (int i = 0; i <= 100000; ++i) {
+        float input = inputMax * static_cast<float>(i) / 100000.0f;
+        worst = std::max(worst, std::abs(curve.Evaluate(input) - curve.EvaluateExact(input)));
+    }
+    return worst;
+}
+
+} // namespace
+
+TEST(ResponseCurveTest, LinearIsIdentity) {
+    ResponseCurve curve;
+    curve.Compile(ResponseCurveConfig{});
+    EXPECT_TRUE(curve.IsIdentity());
+    EXPECT_EQ(curve.EvaluateExact(0.37f), 0.37f);
+}
+
+TEST(ResponseCurveTest, PiecewiseHitsControlPointsAndHoldsPastEnd) {
+    ResponseCurve curve;
+    curve.Compile(WalkRunPoints(ResponseCurveType::Piecewise));
+    EXPECT_FALSE(curve.IsIdentity());
+    EXPECT_NEAR(curve.EvaluateExact(0.2f), 0.5f, 1e-6f);
+    EXPECT_NEAR(curve.EvaluateExact(0.125f), 0.35f, 1e-6f);  // Midway between points
+    EXPECT_NEAR(curve.EvaluateExact(0.025f), 0.1f, 1e-6f);   // Implied origin
+    EXPECT_EQ(curve.EvaluateExact(0.8f), 1.0f);
+    EXPECT_EQ(curve.Evaluate(5.0f), 1.0f);
+}
+
+TEST(ResponseCurveTest, SplineIsMonotoneAndPassesThroughPoints) {
+    ResponseCurve curve;
+    ResponseCurveConfig config = WalkRunPoints(ResponseCurveType::Spline);
+    curve.Compile(config);
+    for (const CurvePoint& p : config.points) {
+        EXPECT_NEAR(curve.EvaluateExact(p.input), p.output, 1e-5f);
+    }
+    float previous = 0.0f;
+    for (int i = 0; i <= 1000; ++i) {
+        float value = curve.EvaluateExact(static_cast<float>(i) / 1000.0f);
+        EXPECT_GE(value, previous - 1e-6f) << "at " << i;
+        EXPECT_LE(value, 1.0f + 1e-6f);
+        previous = value;
+    }
+}
+
+TEST(ResponseCurveTest, GammaMatchesPowerLaw) {
+    ResponseCurveConfig config;
+    config.type = ResponseCurveType::Gamma;
+    config.gamma = 0.5f;
+    ResponseCurve curve;
+    curve.Compile(config);
+    EXPECT_NEAR(curve.EvaluateExact(0.25f), 0.5f, 1e-6f);
+    EXPECT_NEAR(curve.Evaluate(0.25f), 0.5f, 2e-3f);
+}
+
+TEST(ResponseCurveTest, TableIsAccurateForEveryCurveType) {
+    for (ResponseCurveType type : {ResponseCurveType::Piecewise, ResponseCurveType::Spline}) {
+        ResponseCurve curve;
+        curve.Compile(WalkRunPoints(type));
+        EXPECT_LT(MaxLutError(curve, 1.2f), 2e-3f) << ResponseCurveTypeToString(type);
+    }
+    // Gamma > 1 is smooth at the origin and interpolates tightly
+    ResponseCurveConfig config;
+    config.type = ResponseCurveType::Gamma;
+    config.gamma = 2.2f;
+    config.inputMax = 0.6f;
+    ResponseCurve curve;
+    curve.Compile(config);
+    EXPECT_LT(MaxLutError(curve, 0.7f), 1e-4f);
+}
+
+TEST(ResponseCurveTest, DegeneratePointsFallBackToLinear) {
+    ResponseCurveConfig config;
+    config.type = ResponseCurveType::Spline;
+    config.points = {{NAN, 0.5f}, {-1.0f, 0.5f}};
+    ResponseCurve curve;
+    curve.Compile(config);
+    EXPECT_TRUE(curve.IsIdentity());
+}
+
+TEST(ResponseCurveTest, ProcessorAppliesCurveToDeflection) {
+    ProcessingConfig config;
+    config.curve = WalkRunPoints(ResponseCurveType::Piecewise);
+    InputProcessor processor;
+    processor.SetConfig(config);
+
+    // 0.2 linear deflection = 0.2 * 6.1 m/s = 1.22 m/s belt speed
+    const float dt = 0.01f;
+    long counts = std::lround(1.22 * config.countsPerMeter * dt);
+    float x, y;
+    processor.ProcessDelta(MouseDelta{0, counts}, dt, x, y);
+    EXPECT_NEAR(y, 0.5f, 2e-3f);
+
+    // Negative direction keeps its sign
+    processor.ProcessDelta(MouseDelta{0, -counts}, dt, x, y);
+    EXPECT_NEAR(y, -0.5f, 2e-3f);
+}
+
+TEST(ResponseCurveTest, TableLookupCostDoesNotDependOnCurve) {
+    // The per-tick cost must not grow with curve complexity: a 64-point
+    // spline evaluates as fast as a 2-point piecewise curve
+    ResponseCurveConfig simple;
+    simple.type = ResponseCurveType::Piecewise;
+    simple.points = {{0.0f, 0.0f}, {1.0f, 1.0f}};
+    ResponseCurveConfig complex;
+    complex.type = ResponseCurveType::Spline;
+    for (int i = 1; i <= 64; ++i) {
+        float input = static_cast<float>(i) / 64.0f;
+        complex.points.push_back({input, std::sqrt(input)});
+    }
+
+    ResponseCurve simpleCurve;
+    simpleCurve.Compile(simple);
+    ResponseCurve complexCurve;
+    complexCurve.Compile(complex);
+    auto timeCurve = [](const ResponseCurve& curve) {
+        // Thread CPU time, so rounds preempted by other processes are not
+        // charged for the time they were off the CPU
+        volatile float sink = 0.0f;
+        int64_t start = ThreadCpuTimeNs();
+        float acc = 0.0f;
+        for (int i = 0; i < 200000; ++i) {
+            acc += curve.Evaluate(static_cast<float>(i & 1023) / 1000.0f);
+        }
+        sink = acc;
+        (void)sink;
+        return (ThreadCpuTimeNs() - start) / 1e9;
+    };
+    
+    // Alternate the two so cache and frequency effects hit both alike, and
+    // keep the best round of each
+    double simpleSeconds = 1e9;
+    double complexSeconds = 1e9;
+    for (int round = 0; round < 15; ++round) {
+        simpleSeconds = std::min(simpleSeconds, timeCurve(simpleCurve));
+        complexSeconds = std::min(complexSeconds, timeCurve(complexCurve));
+    }
+    EXPECT_LT(complexSeconds, simpleSeconds * 3.0 + 1e-3);
+}
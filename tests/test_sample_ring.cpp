@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+#include "common/SpscRing.h"
+#include "core/InputSampleQueue.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace Mouse2VR;
+
+TEST(SpscRingTest, StartsEmpty) {
+    SpscRing<int, 8> ring;
+    int value = 0;
+    EXPECT_TRUE(ring.Empty());
+    EXPECT_FALSE(ring.Pop(value));
+}
+
+TEST(SpscRingTest, PushPopPreservesOrder) {
+    SpscRing<int, 8> ring;
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(ring.TryPush(i));
+    }
+    EXPECT_EQ(ring.SizeApprox(), 5u);
+    
+    for (int i = 0; i < 5; ++i) {
+        int value = -1;
+        EXPECT_TRUE(ring.Pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_TRUE(ring.Empty());
+}
+
+TEST(SpscRingTest, PushFailsWhenFull) {
+    SpscRing<int, 4> ring;
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.TryPush(i));
+    }
+    EXPECT_FALSE(ring.TryPush(99));
+    
+    int value = 0;
+    EXPECT_TRUE(ring.Pop(value));
+    EXPECT_TRUE(ring.TryPush(4));  // Space freed by the pop
+}
+
+TEST(SpscRingTest, PopBatchWrapsAround) {
+    SpscRing<int, 4> ring;
+    int out[4] = {};
+    
+    // Advance indices past the end of the buffer several times
+    for (int round = 0; round < 10; ++round) {
+        for (int i = 0; i < 3; ++i) {
+            ASSERT_TRUE(ring.TryPush(round * 10 + i));
+        }
+        ASSERT_EQ(ring.PopBatch(out, 4), 3u);
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_EQ(out[i], round * 10 + i);
+        }
+    }
+}
+
+TEST(SpscRingTest, PeekDoesNotConsume) {
+    SpscRing<int, 8> ring;
+    ring.TryPush(1);
+    ring.TryPush(2);
+    
+    int sum = 0;
+    EXPECT_EQ(ring.Peek([&](int v) { sum += v; }), 2u);
+    EXPECT_EQ(sum, 3);
+    EXPECT_EQ(ring.SizeApprox(), 2u);
+}
+
+TEST(SpscRingTest, ConcurrentProducerConsumerLosesNothing) {
+    constexpr int kItems = 200000;
+    auto ring = std::make_unique<SpscRing<int, 256>>();
+    
+    std::thread producer([&]() {
+        for (int i = 0; i < kItems; ++i) {
+            while (!ring->TryPush(i)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    
+    int expected = 0;
+    int batch[64];
+    while (expected < kItems) {
+        size_t n = ring->PopBatch(batch, 64);
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(batch[i], expected);
+            ++expected;
+        }
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_TRUE(ring->Empty());
+}
+
+TEST(InputSampleQueueTest, DrainReturnsTimestampedSamples) {
+    auto queue = std::make_unique<InputSampleQueue>();
+    queue->Push(100, 1, 10);
+    queue->Push(200, 2, 20);
+    
+    InputSample out[8];
+    ASSERT_EQ(queue->Drain(out, 8), 2u);
+    EXPECT_EQ(out[0].timestampNs, 100);
+    EXPECT_EQ(out[0].dy, 10);
+    EXPECT_EQ(out[1].timestampNs, 200);
+    EXPECT_EQ(out[1].dx, 2);
+    EXPECT_EQ(queue->GetPushedCount(), 2u);
+}
+
+TEST(InputSampleQueueTest, AggregateSumsAndResets) {
+    auto queue = std::make_unique<InputSampleQueue>();
+    queue->Push(1, 5);
+    queue->Push(-2, 7);
+    
+    MouseDelta peek = queue->PeekAggregate();
+    EXPECT_EQ(peek.x, -1);
+    EXPECT_EQ(peek.y, 12);
+    
+    MouseDelta drained = queue->DrainAggregate();
+    EXPECT_EQ(drained.x, -1);
+    EXPECT_EQ(drained.y, 12);
+    
+    MouseDelta empty = queue->DrainAggregate();
+    EXPECT_EQ(empty.x, 0);
+    EXPECT_EQ(empty.y, 0);
+}
+
+TEST(InputSampleQueueTest, OverflowMergesInsteadOfDropping) {
+    auto queue = std::make_unique<InputSampleQueue>();
+    const size_t total = InputSampleQueue::kCapacity + 100;
+    for (size_t i = 0; i < total; ++i) {
+        queue->Push(static_cast<int64_t>(i), 0, 1);
+    }
+    
+    EXPECT_EQ(queue->GetPushedCount(), InputSampleQueue::kCapacity);
+    EXPECT_EQ(queue->GetMergedCount(), 100u);
+    
+    // Batch drain returns the ring contents followed by one merged sample
+    std::vector<InputSample> out(total);
+    size_t n = queue->Drain(out.data(), out.size());
+    ASSERT_EQ(n, InputSampleQueue::kCapacity + 1);
+    EXPECT_EQ(out[n - 1].dy, 100);
+    EXPECT_EQ(out[n - 1].timestampNs, static_cast<int64_t>(total - 1));
+    
+    long sum = 0;
+    for (size_t i = 0; i < n; ++i) {
+        sum += out[i].dy;
+    }
+    EXPECT_EQ(sum, static_cast<long>(total));
+}
+
+TEST(InputSampleQueueTest, SmallDrainsKeepTimestampOrderAcrossOverflow) {
+    auto queue = std::make_unique<InputSampleQueue>();
+    int64_t timestamp = 0;
+    for (size_t i = 0; i < InputSampleQueue::kCapacity + 10; ++i) {
+        queue->Push(++timestamp, 0, 1);
+    }
+    
+    // Drain in small batches while the producer keeps pushing; the pending
+    // merged sample must not be overtaken by newer ring samples
+    std::vector<InputSample> drained;
+    InputSample out[16];
+    size_t n;
+    while ((n = queue->Drain(out, std::size(out))) > 0) {
+        drained.insert(drained.end(), out, out + n);
+        queue->Push(++timestamp, 0, 1);
+        if (timestamp > 2 * static_cast<int64_t>(InputSampleQueue::kCapacity)) {
+            break;
+        }
+    }
+    drained.insert(drained.end(), out, out + queue->Drain(out, std::size(out)));
+    
+    long sum = 0;
+    for (size_t i = 0; i < drained.size(); ++i) {
+        sum += drained[i].dy;
+        if (i > 0) {
+            ASSERT_GT(drained[i].timestampNs, drained[i - 1].timestampNs) << i;
+        }
+    }
+    EXPECT_EQ(sum + queue->DrainAggregate().y, timestamp);
+}
+
+TEST(InputSampleQueueTest, ConcurrentAggregateConservesCounts) {
+    constexpr int kEvents = 100000;
+    auto queue = std::make_unique<InputSampleQueue>();
+    std::atomic<bool> done{false};
+    
+    std::thread producer([&]() {
+        for (int i = 0; i < kEvents; ++i) {
+            queue->Push(1, 2);
+        }
+        done = true;
+    });
+    
+    long totalX = 0;
+    long totalY = 0;
+    while (!done) {
+        MouseDelta d = queue->DrainAggregate();
+        totalX += d.x;
+        totalY += d.y;
+        std::this_thread::yield();
+    }
+    producer.join();
+    MouseDelta rest = queue->DrainAggregate();
+    totalX += rest.x;
+    totalY += rest.y;
+    
+    EXPECT_EQ(totalX, kEvents);
+    EXPECT_EQ(totalY, 2L * kEvents);
+}
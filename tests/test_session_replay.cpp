@@ -0,0 +1,216 @@
+#include <gtest/gtest.h>
+#include "core/SessionRecorder.h"
+#include "core/SessionReplay.h"
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+std::string TempSessionPath(const std::string& name) {
+    return (std::filesystem::temp_directory_path() /
+            ("m2vr_" + name + "_" + std::to_string(
+                std::chrono::steady_clock::now().time_since_epoch().count()) + ".m2vr")).string();
+}
+
+// Collects every tick for exact comparison
+class TraceSink : public IReplaySink {
+public:
+    void OnTick(int64_t, float stickX, float stickY, float speed) override {
+        x.push_back(stickX);
+        y.push_back(stickY);
+        speeds.push_back(speed);
+    }
+    std::vector<float> x, y, speeds;
+};
+
+} // namespace
+
+class SessionReplayTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        if (!path.empty()) {
+            std::filesystem::remove(path);
+        }
+    }
+
+    std::string path;
+};
+
+TEST_F(SessionReplayTest, HeaderRoundTripsProcessingConfig) {
+    ProcessingConfig config;
+    config.sensitivity = 1.75f;
+    config.deadzone = 0.05f;
+    config.invertY = true;
+    config.lockX = true;
+    config.countsPerMeter = 800 * 39.3701f;
+    config.velocity.filter = VelocityFilter::OneEuro;
+    config.velocity.oneEuroBeta = 0.02f;
+    config.prediction.enabled = true;
+    config.prediction.horizonMs = 12.5f;
+
+    SessionHeader header = SessionHeader::Create(config, 90, 1234);
+    EXPECT_TRUE(header.IsValid());
+    EXPECT_EQ(header.updateRateHz, 90u);
+
+    ProcessingConfig restored = header.ToProcessingConfig();
+    EXPECT_EQ(restored.sensitivity, config.sensitivity);
+    EXPECT_EQ(restored.deadzone, config.deadzone);
+    EXPECT_EQ(restored.countsPerMeter, config.countsPerMeter);
+    EXPECT_TRUE(restored.invertY);
+    EXPECT_TRUE(restored.lockX);
+    EXPECT_FALSE(restored.lockY);
+    EXPECT_EQ(restored.velocity, config.velocity);
+    EXPECT_EQ(restored.prediction, config.prediction);
+}
+
+TEST_F(SessionReplayTest, RecorderWritesMappableFile) {
+    path = TempSessionPath("write");
+    SessionRecorder recorder;
+    ASSERT_TRUE(recorder.Start(path, ProcessingConfig{}, 60));
+    EXPECT_TRUE(recorder.IsRecording());
+
+    InputSample samples[3] = {{100, 1, 10}, {200, 0, 20}, {300, -1, 30}};
+    recorder.RecordSamples(samples, 3, 7);
+    recorder.RecordTick(400, MouseDelta{0, 60}, 0.016f);
+    recorder.Stop();
+    EXPECT_FALSE(recorder.IsRecording());
+    EXPECT_EQ(recorder.GetWrittenCount(), 4u);
+    EXPECT_EQ(recorder.GetDroppedCount(), 0u);
+
+    MappedSession session;
+    ASSERT_TRUE(session.Open(path));
+    EXPECT_EQ(session.GetHeader().recordCount, 4u);
+    ASSERT_EQ(session.GetRecordCount(), 4u);
+
+    const SessionRecord* r = session.GetRecords();
+    EXPECT_EQ(r[0].timestampNs, 100);
+    EXPECT_EQ(r[0].dy, 10);
+    EXPECT_EQ(r[0].deviceId, 7);
+    EXPECT_EQ(r[0].kind, SessionRecordKind::Sample);
+    EXPECT_EQ(r[3].kind, SessionRecordKind::Tick);
+    EXPECT_EQ(r[3].dy, 60);
+    EXPECT_FLOAT_EQ(r[3].tickSeconds, 0.016f);
+}
+
+TEST_F(SessionReplayTest, ReplayReproducesLiveProcessingExactly) {
+    path = TempSessionPath("exact");
+    ProcessingConfig config;
+    config.sensitivity = 1.5f;
+    config.deadzone = 0.02f;
+
+    InputProcessor live;
+    live.SetConfig(config);
+    TraceSink liveTrace;
+
+    SessionRecorder recorder;
+    ASSERT_TRUE(recorder.Start(path, config, 50));
+
+    // Uneven tick lengths and bursty input, as the real scheduler produces
+    int64_t t = 0;
+    for (int tick = 0; tick < 500; ++tick) {
+        MouseDelta delta;
+        InputSample samples[8];
+        size_t n = static_cast<size_t>(tick % 8);
+        for (size_t i = 0; i < n; ++i) {
+            t += 1000000;
+            samples[i] = {t, 0, static_cast<int32_t>((tick * 7 + static_cast<int>(i)) % 40)};
+            delta.y += samples[i].dy;
+        }
+        recorder.RecordSamples(samples, n, 0);
+
+        float dt = 0.02f + 0.001f * static_cast<float>(tick % 3);
+        float x, y;
+        live.ProcessDelta(delta, dt, x, y);
+        recorder.RecordTick(t, delta, dt);
+        liveTrace.OnTick(t, x, y, live.GetSpeedMetersPerSecond());
+    }
+    recorder.Stop();
+
+    MappedSession session;
+    ASSERT_TRUE(session.Open(path));
+
+    TraceSink replayTrace;
+    ReplayResult result = ReplayEngine::Run(session, replayTrace);
+    EXPECT_EQ(result.ticks, 500u);
+
+    ASSERT_EQ(replayTrace.y.size(), liveTrace.y.size());
+    for (size_t i = 0; i < liveTrace.y.size(); ++i) {
+        ASSERT_EQ(replayTrace.y[i], liveTrace.y[i]) << "tick " << i;
+        ASSERT_EQ(replayTrace.speeds[i], liveTrace.speeds[i]) << "tick " << i;
+    }
+}
+
+TEST_F(SessionReplayTest, ResamplingConservesCounts) {
+    path = TempSessionPath("resample");
+    SessionRecorder recorder;
+    ASSERT_TRUE(recorder.Start(path, ProcessingConfig{}, 60));
+
+    // 1 second of 1 kHz samples, no tick records
+    std::vector<InputSample> samples;
+    for (int i = 0; i < 1000; ++i) {
+        samples.push_back({static_cast<int64_t>(i) * 1000000, 0, 3});
+    }
+    recorder.RecordSamples(samples.data(), samples.size(), 0);
+    recorder.Stop();
+
+    MappedSession session;
+    ASSERT_TRUE(session.Open(path));
+
+    // 3 counts/ms stays far below maxSpeed, so the output is linear in
+    // counts and summing stick values recovers the total
+    ReplayOptions options;
+    options.tickRateHz = 100;
+    ReplayStatsSink sink;
+    ReplayResult result = ReplayEngine::Run(session, sink, options);
+
+    EXPECT_EQ(result.samples, 1000u);
+    EXPECT_NEAR(static_cast<double>(result.ticks), 100.0, 1.0);
+    EXPECT_NEAR(result.sessionSeconds, 0.999, 1e-6);
+
+    // Deflection per tick = counts / dt / dpi * 0.0254 / 6.1 at sensitivity 1
+    const double dpi = 39370.1 / 39.3701;
+    const double countsFromStick = sink.stickYSum * 0.01 * dpi / 0.0254 * 6.1;
+    EXPECT_NEAR(countsFromStick, 3000.0, 1.0);
+}
+
+TEST_F(SessionReplayTest, UnfinalizedFileUsesFileSize) {
+    path = TempSessionPath("crash");
+    SessionHeader header = SessionHeader::Create(ProcessingConfig{}, 60, 0);
+    header.recordCount = 0;  // As left by a crash before Stop()
+
+    std::vector<SessionRecord> records(10);
+    for (size_t i = 0; i < records.size(); ++i) {
+        records[i].timestampNs = static_cast<int64_t>(i);
+        records[i].dy = 1;
+    }
+
+    FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    std::fwrite(&header, sizeof(header), 1, f);
+    std::fwrite(records.data(), sizeof(SessionRecord), records.size(), f);
+    std::fputc(0x55, f);  // Torn trailing record
+    std::fclose(f);
+
+    MappedSession session;
+    ASSERT_TRUE(session.Open(path));
+    EXPECT_EQ(session.GetRecordCount(), 10u);
+}
+
+TEST_F(SessionReplayTest, RejectsForeignFiles) {
+    path = TempSessionPath("foreign");
+    FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    std::vector<char> junk(512, 'x');
+    std::fwrite(junk.data(), 1, junk.size(), f);
+    std::fclose(f);
+
+    MappedSession session;
+    EXPECT_FALSE(session.Open(path));
+    EXPECT_FALSE(session.IsOpen());
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "core/SharedStatePublisher.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+// Unique per test process so parallel test runs do not share segments
+std::string ChannelName(const char* test) {
+    return std::string("mouse2vr-test-") + test + "-" + std::to_string(getpid());
+}
+
+// Every field derived from i, so a torn read shows as a mismatch
+SharedStateSnapshot StateFor(uint64_t i) {
+    SharedStateSnapshot state;
+    state.monotonicNs = static_cast<int64_t>(i) * 1000;
+    state.unixTimeNs = static_cast<int64_t>(i) * 3;
+    state.speed = static_cast<double>(i) * 0.5;
+    state.beltSpeed = static_cast<double>(i) * 0.125;
+    state.stickX = -static_cast<double>(i);
+    state.stickY = static_cast<double>(i) * 0.25;
+    state.updateRate = static_cast<int32_t>(i & 0x7FFFFFFF);
+    state.running = (i & 1) != 0;
+    return state;
+}
+
+bool IsConsistent(const SharedStateSnapshot& s) {
+    uint64_t i = s.tick;
+    SharedStateSnapshot expected = StateFor(i);
+    return s.monotonicNs == expected.monotonicNs && s.unixTimeNs == expected.unixTimeNs &&
+           s.speed == expected.speed && s.beltSpeed == expected.beltSpeed && s.stickX == expected.stickX && s.stickY == expected.stickY &&
+           s.updateRate == expected.updateRate && s.running == expected.running;
+}
+
+class SharedStateTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        name = ChannelName(::testing::UnitTest::GetInstance()->current_test_info()->name());
+        SharedStatePublisher::Remove(name);
+    }
+
+    void TearDown() override { SharedStatePublisher::Remove(name); }
+
+    std::string name;
+};
+
+} // namespace
+
+TEST_F(SharedStateTest, ReaderWaitsForPublisher) {
+    SharedStateReader reader(name);
+    EXPECT_FALSE(reader.IsOpen());
+    SharedStateSnapshot snapshot;
+    EXPECT_FALSE(reader.TryRead(snapshot));
+
+    SharedStatePublisher publisher(name);
+    ASSERT_TRUE(publisher.IsOpen());
+    ASSERT_TRUE(reader.Open());
+    ASSERT_TRUE(reader.TryRead(snapshot));
+    EXPECT_EQ(snapshot.tick, 0u);  // Set up, nothing published yet
+    EXPECT_FALSE(snapshot.running);
+
+    publisher.Publish(StateFor(1));
+    ASSERT_TRUE(reader.TryRead(snapshot));
+    EXPECT_EQ(snapshot.tick, 1u);
+    EXPECT_TRUE(IsConsistent(snapshot));
+}
+
+TEST_F(SharedStateTest, ReadersSurvivePublisherRestart) {
+    SharedStateSnapshot snapshot;
+    auto publisher = std::make_unique<SharedStatePublisher>(name);
+    SharedStateReader reader(name);
+    publisher->Publish(StateFor(1));
+    publisher->Publish(StateFor(2));
+    publisher.reset();
+
+    ASSERT_TRUE(reader.TryRead(snapshot));  // Last state outlives the publisher
+    EXPECT_EQ(snapshot.tick, 2u);
+
+    publisher = std::make_unique<SharedStatePublisher>(name);
+    publisher->Publish(StateFor(1));
+    ASSERT_TRUE(reader.TryRead(snapshot));
+    EXPECT_EQ(snapshot.tick, 1u);
+    EXPECT_TRUE(IsConsistent(snapshot));
+}
+
+TEST_F(SharedStateTest, ManyReadersNeverSeeTornState) {
+    constexpr int kReaders = 4;
+    constexpr uint64_t kPublishes = 2000000;
+
+    SharedStatePublisher publisher(name);
+    ASSERT_TRUE(publisher.IsOpen());
+    std::atomic<bool> done{false};
+    std::atomic<int> readersReady{0};
+    std::atomic<uint64_t> torn{0};
+    std::atomic<uint64_t> backwards{0};
+    std::vector<uint64_t> reads(kReaders, 0);
+    std::vector<uint64_t> failed(kReaders, 0);
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < kReaders; ++r) {
+        readers.emplace_back([&, r] {
+            SharedStateReader reader(name);  // Own mapping, as another process would have
+            readersReady++;
+            uint64_t lastTick = 0;
+            SharedStateSnapshot snapshot;
+            while (!done.load(std::memory_order_relaxed)) {
+                if (!reader.TryRead(snapshot)) {
+                    failed[r]++;
+                    continue;
+                }
+                reads[r]++;
+                if (!IsConsistent(snapshot)) {
+                    torn++;
+                }
+                if (snapshot.tick < lastTick) {
+                    backwards++;
+                }
+                lastTick = snapshot.tick;
+            }
+        });
+    }
+    while (readersReady.load() < kReaders) {
+        std::this_thread::yield();
+    }
+
+    for (uint64_t i = 1; i <= kPublishes; ++i) {
+        publisher.Publish(StateFor(i));
+    }
+    done = true;
+    for (std::thread& t : readers) {
+        t.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_EQ(backwards.load(), 0u);
+    EXPECT_EQ(publisher.GetPublishCount(), kPublishes);
+    for (int r = 0; r < kReaders; ++r) {
+        EXPECT_GT(reads[r], 0u) << "reader " << r;
+    }
+
+    SharedStateReader reader(name);
+    SharedStateSnapshot last;
+    ASSERT_TRUE(reader.TryRead(last));
+    EXPECT_EQ(last.tick, kPublishes);
+    EXPECT_TRUE(IsConsistent(last));
+}
@@ -0,0 +1,420 @@
+#include <gtest/gtest.h>
+#include "common/Clock.h"
+#include "common/DeadlineTimer.h"
+#include "common/WakeEvent.h"
+#include "core/ConfigManager.h"
+#include "core/FrameClock.h"
+#include "core/IControllerSink.h"
+#include "core/IInputSource.h"
+#include "core/InputSampleQueue.h"
+#include "core/Mouse2VRCore.h"
+#include "core/RecordingControllerSink.h"
+#include "core/OutputFanout.h"
+#include "core/SharedStatePublisher.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+constexpr int64_t kMs = 1000000;
+constexpr int64_t kSecond = 1000 * kMs;
+
+// Input source fed from clock events, stamped with virtual time
+class SimulatedInputSource : public IInputSource {
+public:
+    explicit SimulatedInputSource(SimulatedClock& clock) : m_clock(clock) {}
+
+    bool Start() override { return true; }
+    void Stop() override {}
+
+    MouseDelta GetAndResetDeltas() override {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        return m_samples.DrainAggregate();
+    }
+
+    size_t DrainSamples(InputSample* out, size_t maxCount) override {
+        std::lock_guard<std::mutex> lock(m_drainMutex);
+        return m_samples.Drain(out, maxCount);
+    }
+
+    void SetWakeEvent(WakeEvent* wake) override { m_samples.SetWakeEvent(wake); }
+    int64_t NowNs() const override { return m_steadyStamps ? InputSampleQueue::NowNs() : m_clock.NowNs(); }
+    uint64_t GetSampleCount() const override { return m_samples.GetPushedCount(); }
+    uint64_t GetMergedSampleCount() const override { return m_samples.GetMergedCount(); }
+    const char* GetName() const override { return "simulated"; }
+
+    // Stamp samples on the steady clock, as a device does, instead of in
+    // virtual time
+    void SetSteadyTimestamps(bool steady) { m_steadyStamps = steady; }
+
+    // A treadmill report of dy counts every periodNs over [startNs, endNs)
+    void Walk(int64_t startNs, int64_t endNs, int64_t periodNs, int32_t dy) {
+        if (startNs >= endNs) {
+            return;
+        }
+        m_clock.Schedule(startNs, [this, startNs, endNs, periodNs, dy] {
+            m_samples.Push(m_steadyStamps ? InputSampleQueue::NowNs() : m_clock.NowNs(), 0, dy);
+            Walk(startNs + periodNs, endNs, periodNs, dy);
+        });
+    }
+
+private:
+    SimulatedClock& m_clock;
+    bool m_steadyStamps = false;
+    InputSampleQueue m_samples;
+    std::mutex m_drainMutex;
+};
+
+} // namespace
+
+TEST(SimulatedClockTest, EventsRunInTimeOrderWithoutWaiter) {
+    SimulatedClock clock(100);
+    std::vector<int> order;
+    std::vector<int64_t> times;
+    clock.Schedule(130, [&] { order.push_back(3); times.push_back(clock.NowNs()); });
+    clock.Schedule(110, [&] { order.push_back(1); times.push_back(clock.NowNs()); });
+    clock.Schedule(110, [&] { order.push_back(2); times.push_back(clock.NowNs()); });
+
+    clock.AdvanceTo(120);
+    EXPECT_EQ(order, (std::vector<int>{1, 2}));
+    EXPECT_EQ(clock.NowNs(), 120);
+
+    clock.AdvanceBy(20);
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(times, (std::vector<int64_t>{110, 110, 130}));
+    EXPECT_EQ(clock.NowNs(), 140);
+}
+
+TEST(SimulatedClockTest, WaitsCompleteExactlyAtDeadlineUpToHorizon) {
+    SimulatedClock clock;
+    std::vector<int64_t> wokeAt;
+    std::atomic<bool> stop{false};
+    clock.SetInterrupted(false);
+    std::thread waiter([&] {
+        DeadlineTimer timer;
+        for (int64_t deadline = kMs; !stop; deadline += kMs) {
+            EXPECT_EQ(clock.WaitUntil(deadline, timer), 0);
+            if (!stop) {
+                wokeAt.push_back(clock.NowNs());
+            }
+        }
+    });
+
+    clock.AdvanceTo(50 * kMs);
+    ASSERT_EQ(wokeAt.size(), 50u);
+    for (size_t i = 0; i < wokeAt.size(); ++i) {
+        EXPECT_EQ(wokeAt[i], static_cast<int64_t>(i + 1) * kMs);
+    }
+    EXPECT_EQ(clock.NowNs(), 50 * kMs);
+
+    stop = true;
+    clock.SetInterrupted(true);
+    waiter.join();
+}
+
+TEST(SimulatedClockTest, EventSignalWakesWaiterAtEventTime) {
+    SimulatedClock clock;
+    WakeEvent wake;
+    clock.Schedule(5 * kMs, [&] { wake.Signal(); });
+    bool signaled = false;
+    int64_t wokeAt = 0;
+    bool timedOut = true;
+    clock.SetInterrupted(false);
+    std::thread waiter([&] {
+        signaled = clock.WaitForWake(wake, 10 * kMs);
+        wokeAt = clock.NowNs();
+        timedOut = !clock.WaitForWake(wake, 20 * kMs);
+        clock.WaitForWake(wake, IClock::kNoDeadline);  // Until interrupted
+    });
+
+    clock.AdvanceTo(100 * kMs);
+    clock.SetInterrupted(true);
+    waiter.join();
+    EXPECT_TRUE(signaled);
+    EXPECT_EQ(wokeAt, 5 * kMs);
+    EXPECT_TRUE(timedOut);
+}
+
+class SimulatedWalkTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        clock = std::make_shared<SimulatedClock>();
+        auto source = std::make_unique<SimulatedInputSource>(*clock);
+        auto sink = std::make_unique<RecordingControllerSink>(1 << 16, clock);
+        input = source.get();
+        controller = sink.get();
+        core = std::make_unique<Mouse2VRCore>();
+        ASSERT_TRUE(core->Initialize(std::move(source), std::move(sink)));
+        ASSERT_TRUE(core->SetClock(clock));
+    }
+
+    void TearDown() override {
+        core->Shutdown();
+    }
+
+    std::shared_ptr<SimulatedClock> clock;
+    std::unique_ptr<Mouse2VRCore> core;
+    SimulatedInputSource* input = nullptr;
+    RecordingControllerSink* controller = nullptr;
+};
+
+TEST_F(SimulatedWalkTest, FiveMinuteWalkAtExactTickTimes) {
+    AppConfig config;
+    config.updateIntervalMs = 10;  // 100 Hz
+    core->UpdateSettings(config);
+    // 1000 Hz treadmill at 40 counts per report: 40000 counts/s
+    input->Walk(0, 300 * kSecond, kMs, 40);
+
+    core->Start();
+    clock->AdvanceTo(300 * kSecond);
+    ControllerState state = core->GetCurrentState();
+    SchedulerStats stats = core->GetSchedulerStats();
+    core->Stop();
+
+    // One tick every 10 ms from t=0; the t=0 tick has no elapsed time
+    std::vector<RecordedReport> reports = controller->GetReports();
+    ASSERT_EQ(reports.size(), 30000u);
+    for (size_t i = 0; i < reports.size(); ++i) {
+        ASSERT_EQ(reports[i].timestampNs, static_cast<int64_t>(i + 1) * 10 * kMs);
+    }
+    EXPECT_EQ(stats.missedFrames, 0u);
+    EXPECT_EQ(stats.lateness.maxNs, 0);
+    EXPECT_EQ(input->GetSampleCount(), 300000u);
+
+    // A constant belt speed at exact tick spacing settles to a constant
+    // stick; the last tick only sees the walk's final 9 reports
+    EXPECT_GT(state.speed, 0.0);
+    float settled = reports[reports.size() - 2].stickY;
+    EXPECT_GT(settled, 0.0f);
+    for (size_t i = reports.size() - 6000; i < reports.size() - 1; ++i) {
+        ASSERT_EQ(reports[i].stickY, settled) << i;
+    }
+    EXPECT_LT(reports.back().stickY, settled);
+}
+
+TEST_F(SimulatedWalkTest, RepeatedRunsAreIdentical) {
+    AppConfig config;
+    config.updateIntervalMs = 11;
+    core->UpdateSettings(config);
+    // Bursty walk: speed changes every few seconds, reports at 1 kHz
+    for (int segment = 0; segment < 12; ++segment) {
+        input->Walk(segment * 5 * kSecond, (segment + 1) * 5 * kSecond, kMs, (segment * 7) % 50);
+    }
+    core->Start();
+    clock->AdvanceTo(60 * kSecond);
+    core->Stop();
+    std::vector<RecordedReport> first = controller->GetReports();
+
+    // Same walk on a fresh core and clock
+    TearDown();
+    SetUp();
+    core->UpdateSettings(config);
+    for (int segment = 0; segment < 12; ++segment) {
+        input->Walk(segment * 5 * kSecond, (segment + 1) * 5 * kSecond, kMs, (segment * 7) % 50);
+    }
+    core->Start();
+    clock->AdvanceTo(60 * kSecond);
+    core->Stop();
+
+    ASSERT_FALSE(first.empty());
+    EXPECT_EQ(controller->GetReports(), first);
+}
+
+TEST_F(SimulatedWalkTest, AdaptiveParksAfterWalkAndWakesOnInput) {
+    AppConfig config;
+    config.updateIntervalMs = 10;
+    config.adaptiveMode = true;
+    config.idleUpdateIntervalMs = 0;  // Park until input
+    config.idleTimeoutMs = 500;
+    core->UpdateSettings(config);
+    input->Walk(0, 60 * kSecond, kMs, 20);
+    input->Walk(180 * kSecond, 181 * kSecond, kMs, 20);
+
+    core->Start();
+    clock->AdvanceTo(120 * kSecond);
+    uint64_t afterWalk = controller->GetUpdateCount();
+    EXPECT_TRUE(core->GetActivityStats().parked);
+    EXPECT_FLOAT_EQ(controller->GetReports().back().stickY, 0.0f);
+
+    clock->AdvanceTo(179 * kSecond);
+    EXPECT_EQ(controller->GetUpdateCount(), afterWalk);
+
+    clock->AdvanceTo(180 * kSecond);
+    EXPECT_GT(controller->GetUpdateCount(), afterWalk);
+    EXPECT_EQ(controller->GetReports()[afterWalk].timestampNs, 180 * kSecond);
+    ActivityStats activity = core->GetActivityStats();
+    core->Stop();
+
+    EXPECT_EQ(activity.idleTransitions, 1u);
+    EXPECT_EQ(activity.wakeTransitions, 1u);
+    EXPECT_GT(activity.WallNs(ActivityState::Idle), 119 * kSecond);
+}
+
+TEST_F(SimulatedWalkTest, EventDrivenOutputFollowsEveryReport) {
+    AppConfig config;
+    config.updateIntervalMs = 20;
+    config.eventDriven = true;
+    config.coalesceWindowUs = 0;
+    config.maxOutputRateHz = 1000;
+    core->UpdateSettings(config);
+    input->Walk(kMs, 10 * kSecond, 2 * kMs, 30);
+
+    core->Start();
+    clock->AdvanceTo(10 * kSecond - 1);
+    LatencyStats latency = core->GetLatencyStats();
+    core->Stop();
+
+    // Each report goes out at its own arrival time, with no added latency
+    EXPECT_EQ(controller->GetUpdateCount(), 5000u);
+    EXPECT_EQ(latency.maxNs, 0);
+}
+
+TEST_F(SimulatedWalkTest, LatencyUsesTheSampleTimeBase) {
+    AppConfig config;
+    config.updateIntervalMs = 20;
+    config.eventDriven = true;
+    config.coalesceWindowUs = 0;
+    config.maxOutputRateHz = 1000;
+    core->UpdateSettings(config);
+    input->SetSteadyTimestamps(true);
+    input->Walk(kMs, kSecond, 2 * kMs, 30);
+
+    core->Start();
+    clock->AdvanceTo(kSecond);
+    LatencyStats latency = core->GetLatencyStats();
+    core->Stop();
+
+    // Device stamps are on the steady clock while the schedulers run in
+    // virtual time; the latency is the real time from push to submit
+    ASSERT_EQ(latency.count, 500u);
+    EXPECT_GT(latency.p50Ns, 0);
+    EXPECT_LT(latency.maxNs, kSecond);
+}
+
+TEST_F(SimulatedWalkTest, PhaseLocksToSimulatedFrameClock) {
+    AppConfig config;
+    config.updateIntervalMs = 11;  // ~90 Hz
+    config.frameClock.leadUs = 2000;
+    core->UpdateSettings(config);
+    const int64_t periodNs = kSecond / 90;
+    ASSERT_TRUE(core->SetFrameClock(std::make_unique<SyntheticFrameClock>(periodNs, 0, clock)));
+
+    core->Start();
+    clock->AdvanceTo(60 * kSecond);
+    PhaseStats phase = core->GetPhaseStats();
+    core->Stop();
+
+    EXPECT_TRUE(phase.locked);
+    EXPECT_EQ(phase.absError.maxNs, 0);
+    for (const RecordedReport& report : controller->GetReports()) {
+        ASSERT_EQ((report.timestampNs + 2 * kMs) % periodNs, 0) << report.timestampNs;
+    }
+}
+
+TEST_F(SimulatedWalkTest, PublishesEveryTickToSharedMemory) {
+    const std::string channel = "mouse2vr-test-walk";
+    SharedStatePublisher::Remove(channel);
+    auto publisher = std::make_unique<SharedStatePublisher>(channel);
+    ASSERT_TRUE(publisher->IsOpen());
+    ASSERT_TRUE(core->SetStatePublisher(std::move(publisher)));
+    SharedStateReader reader(channel);
+    ASSERT_TRUE(reader.IsOpen());
+
+    AppConfig config;
+    config.updateIntervalMs = 10;
+    config.sensitivity = 2.0f;
+    core->UpdateSettings(config);
+    input->Walk(kMs, 10 * kSecond, kMs, 20);
+
+    core->Start();
+    clock->AdvanceTo(5 * kSecond + 5 * kMs);
+    SharedStateSnapshot live;
+    ASSERT_TRUE(reader.TryRead(live));
+    std::vector<RecordedReport> reports = controller->GetReports();
+    core->Stop();
+
+    ASSERT_FALSE(reports.empty());
+    EXPECT_TRUE(live.running);
+    EXPECT_EQ(live.tick, reports.size());
+    EXPECT_EQ(live.monotonicNs, reports.back().timestampNs);
+    EXPECT_FLOAT_EQ(static_cast<float>(live.stickY), reports.back().stickY);
+    EXPECT_GT(live.beltSpeed, 0.0);
+    EXPECT_NEAR(live.speed, 2.0 * live.beltSpeed, 1e-5 * live.speed);  // Game speed
+    EXPECT_EQ(live.updateRate, 100);
+
+    SharedStateSnapshot stopped;
+    ASSERT_TRUE(reader.TryRead(stopped));
+    EXPECT_FALSE(stopped.running);
+    EXPECT_EQ(stopped.tick, live.tick + 1);
+    EXPECT_EQ(stopped.stickY, live.stickY);
+    SharedStatePublisher::Remove(channel);
+}
+
+TEST_F(SimulatedWalkTest, BatchesEveryTickForTheUi) {
+    AppConfig config;
+    config.updateIntervalMs = 10;
+    core->UpdateSettings(config);
+    input->Walk(kMs, 10 * kSecond, kMs, 20);
+    core->SetTelemetryEnabled(true);
+
+    // A 60 Hz UI taking a batch per frame sees each tick exactly once
+    core->Start();
+    TelemetryBatch batch;
+    std::vector<TelemetrySample> taken;
+    for (int frame = 1; frame <= 120; ++frame) {
+        clock->AdvanceTo(frame * kSecond / 60);
+        core->TakeTelemetry(batch);
+        EXPECT_EQ(batch.dropped, 0u);
+        taken.insert(taken.end(), batch.samples.begin(), batch.samples.end());
+    }
+    core->Stop();
+
+    std::vector<RecordedReport> reports = controller->GetReports();
+    ASSERT_EQ(taken.size(), reports.size());
+    for (size_t i = 0; i < taken.size(); ++i) {
+        ASSERT_EQ(taken[i].timestampNs, reports[i].timestampNs) << i;
+        ASSERT_EQ(taken[i].stickY, reports[i].stickY) << i;
+    }
+    EXPECT_EQ(batch.actualHz, 100);
+
+    // The final stopped state is not a tick
+    EXPECT_EQ(core->TakeTelemetry(batch), 0u);
+}
+
+TEST_F(SimulatedWalkTest, SlowSecondarySinkDoesNotHoldBackPrimary) {
+    // Secondary sink taking 20 ms per report, in real time
+    class SlowSink : public RecordingControllerSink {
+    public:
+        void Update() override {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            RecordingControllerSink::Update();
+        }
+    };
+    ASSERT_TRUE(core->AddOutputSink(std::make_unique<SlowSink>(), 0));
+
+    AppConfig config;
+    config.updateIntervalMs = 10;
+    core->UpdateSettings(config);
+    input->Walk(kMs, 10 * kSecond, kMs, 20);
+
+    // 1000 ticks of virtual time; were the processing thread waiting on the
+    // slow sink this would take 20 s
+    auto start = std::chrono::steady_clock::now();
+    core->Start();
+    clock->AdvanceTo(10 * kSecond + 5 * kMs);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    core->Stop();
+
+    EXPECT_EQ(controller->GetUpdateCount(), 1000u);
+    EXPECT_LT(elapsed, std::chrono::seconds(5));
+    std::vector<OutputSinkStats> outputs = core->GetOutputSinkStats();
+    ASSERT_EQ(outputs.size(), 1u);
+    EXPECT_GT(outputs[0].delivered, 0u);
+    EXPECT_LT(outputs[0].delivered, 1000u);
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+#include "core/Telemetry.h"
+#include <string>
+
+using namespace Mouse2VR;
+
+namespace {
+
+TelemetrySample Sample(int64_t timestampNs, float speed, float stickY) {
+    return TelemetrySample{timestampNs, speed, stickY};
+}
+
+} // namespace
+
+TEST(TelemetryBufferTest, DrainsInRecordOrder) {
+    TelemetryBuffer buffer;
+    for (int i = 0; i < 10; ++i) {
+        buffer.Record(Sample(i * 1000, static_cast<float>(i), 0.0f));
+    }
+    TelemetryBatch batch;
+    EXPECT_EQ(buffer.Drain(batch), 10u);
+    ASSERT_EQ(batch.samples.size(), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(batch.samples[i].timestampNs, i * 1000);
+    }
+    EXPECT_EQ(batch.dropped, 0u);
+
+    // Nothing new: an empty drain
+    batch.Clear();
+    EXPECT_EQ(buffer.Drain(batch), 0u);
+    EXPECT_TRUE(batch.samples.empty());
+}
+
+TEST(TelemetryBufferTest, CountsDropsOncePerBatch) {
+    TelemetryBuffer buffer;
+    const size_t total = TelemetryBuffer::kCapacity + 100;
+    for (size_t i = 0; i < total; ++i) {
+        buffer.Record(Sample(static_cast<int64_t>(i), 1.0f, 0.5f));
+    }
+    EXPECT_EQ(buffer.GetDroppedCount(), 100u);
+
+    // The oldest samples are kept, the overflow is reported in the next batch
+    TelemetryBatch batch;
+    EXPECT_EQ(buffer.Drain(batch), TelemetryBuffer::kCapacity);
+    EXPECT_EQ(batch.samples.front().timestampNs, 0);
+    EXPECT_EQ(batch.samples.back().timestampNs, static_cast<int64_t>(TelemetryBuffer::kCapacity - 1));
+    EXPECT_EQ(batch.dropped, 100u);
+
+    batch.Clear();
+    buffer.Record(Sample(1, 1.0f, 0.5f));
+    EXPECT_EQ(buffer.Drain(batch), 1u);
+    EXPECT_EQ(batch.dropped, 0u);
+    EXPECT_EQ(buffer.GetDroppedCount(), 100u);
+}
+
+TEST(TelemetryBufferTest, ClearKeepsCapacity) {
+    TelemetryBuffer buffer;
+    TelemetryBatch batch;
+    for (int i = 0; i < 200; ++i) {
+        buffer.Record(Sample(i, 0.0f, 0.0f));
+    }
+    buffer.Drain(batch);
+    size_t capacity = batch.samples.capacity();
+    const TelemetrySample* data = batch.samples.data();
+
+    batch.Clear();
+    for (int i = 0; i < 150; ++i) {
+        buffer.Record(Sample(i, 0.0f, 0.0f));
+    }
+    buffer.Drain(batch);
+    EXPECT_EQ(batch.samples.size(), 150u);
+    EXPECT_EQ(batch.samples.capacity(), capacity);
+    EXPECT_EQ(batch.samples.data(), data);
+}
+
+TEST(TelemetryBatchTest, SerializesColumns) {
+    TelemetryBatch batch;
+    batch.actualHz = 100;
+    batch.dropped = 3;
+    batch.samples.push_back(Sample(12345000000, 1.25f, 0.5f));
+    batch.samples.push_back(Sample(12355000000, 1.5f, -0.25f));
+    batch.samples.push_back(Sample(12365000500, 0.0f, 0.0f));
+
+    std::string json;
+    batch.AppendJson(json);
+    EXPECT_EQ(json,
+              "{\"type\":\"telemetry\",\"t0\":12345,\"hz\":100,\"dropped\":3,"
+              "\"t\":[0,10000,20000],\"speed\":[1.25,1.5,0],\"stickY\":[0.5,-0.25,0]}");
+}
+
+TEST(TelemetryBatchTest, TrimsNumbers) {
+    TelemetryBatch batch;
+    batch.samples.push_back(Sample(1500000, 0.1f, -0.00001f));
+    batch.samples.push_back(Sample(1500000, 2.0f, 1.0f / 3.0f));
+
+    std::string json;
+    batch.AppendJson(json);
+    // Four decimals at most; tiny negatives print as 0
+    EXPECT_EQ(json,
+              "{\"type\":\"telemetry\",\"t0\":1.5,\"hz\":0,\"dropped\":0,"
+              "\"t\":[0,0],\"speed\":[0.1,2],\"stickY\":[0,0.3333]}");
+}
+
+TEST(TelemetryBatchTest, EmptyBatchAppends) {
+    TelemetryBatch batch;
+    std::string json = "x";
+    batch.AppendJson(json);
+    EXPECT_EQ(json, "x{\"type\":\"telemetry\",\"t0\":0,\"hz\":0,\"dropped\":0,\"t\":[],\"speed\":[],\"stickY\":[]}");
+}
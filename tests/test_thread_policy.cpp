@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include "common/ThreadPolicy.h"
+#include "core/ConfigManager.h"
+#include "core/IControllerSink.h"
+#include "core/IInputSource.h"
+#include "core/Mouse2VRCore.h"
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#ifdef __linux__
+#include "core/EvdevInputSource.h"
+#include <unistd.h>
+#endif
+
+using namespace Mouse2VR;
+using namespace std::chrono_literals;
+
+namespace {
+
+// Apply a policy on a scratch thread so the test thread keeps its own
+AppliedThreadPolicy ApplyOnThread(const ThreadPolicyConfig& policy) {
+    AppliedThreadPolicy result;
+    std::thread([&] { result = ApplyThreadPolicy(policy); }).join();
+    return result;
+}
+
+uint64_t FirstAllowedCpu() {
+    uint64_t mask = QueryThreadPolicy().affinityMask;
+    return mask & (~mask + 1);
+}
+
+class NullInputSource : public IInputSource {
+public:
+    bool Start() override { return true; }
+    void Stop() override {}
+    MouseDelta GetAndResetDeltas() override { return {}; }
+    size_t DrainSamples(InputSample*, size_t) override { return 0; }
+    void SetWakeEvent(WakeEvent*) override {}
+    uint64_t GetSampleCount() const override { return 0; }
+    uint64_t GetMergedSampleCount() const override { return 0; }
+    const char* GetName() const override { return "null"; }
+};
+
+class NullControllerSink : public IControllerSink {
+public:
+    bool Initialize() override { return true; }
+    void Shutdown() override {}
+    void SetLeftStick(float, float) override {}
+    void Update() override {}
+    bool IsConnected() const override { return true; }
+    const char* GetName() const override { return "null"; }
+};
+
+} // namespace
+
+TEST(ThreadPolicyTest, NamesRoundTrip) {
+    for (ThreadPriority priority : {ThreadPriority::Normal, ThreadPriority::AboveNormal,
+                                    ThreadPriority::High, ThreadPriority::TimeCritical}) {
+        EXPECT_EQ(ThreadPriorityFromString(ThreadPriorityToString(priority)), priority);
+    }
+    for (ThreadScheduler scheduler : {ThreadScheduler::Normal, ThreadScheduler::Fifo, ThreadScheduler::RoundRobin}) {
+        EXPECT_EQ(ThreadSchedulerFromString(ThreadSchedulerToString(scheduler)), scheduler);
+    }
+    EXPECT_EQ(ThreadPriorityFromString("bogus"), ThreadPriority::Normal);
+    EXPECT_EQ(ThreadSchedulerFromString("bogus"), ThreadScheduler::Normal);
+}
+
+TEST(ThreadPolicyTest, QueryReportsCurrentThread) {
+    AppliedThreadPolicy current = QueryThreadPolicy();
+    EXPECT_FALSE(current.applied);
+    EXPECT_EQ(current.scheduler, ThreadScheduler::Normal);
+    EXPECT_NE(current.affinityMask, 0u);
+}
+
+TEST(ThreadPolicyTest, AffinityIsAppliedAndReadBack) {
+    ThreadPolicyConfig policy;
+    policy.affinityMask = FirstAllowedCpu();
+    AppliedThreadPolicy result = ApplyOnThread(policy);
+    EXPECT_TRUE(result.Succeeded()) << result.failures;
+    EXPECT_EQ(result.affinityMask, policy.affinityMask);
+}
+
+TEST(ThreadPolicyTest, UnavailableCpuIsReportedNotApplied) {
+    ThreadPolicyConfig policy;
+    policy.affinityMask = uint64_t{1} << 63;
+    AppliedThreadPolicy before = QueryThreadPolicy();
+    AppliedThreadPolicy result = ApplyOnThread(policy);
+    if (before.affinityMask & policy.affinityMask) {
+        GTEST_SKIP() << "Host has a 64th CPU";
+    }
+    EXPECT_TRUE(result.applied);
+    EXPECT_FALSE(result.failures.empty());
+    EXPECT_EQ(result.affinityMask, before.affinityMask);
+}
+
+TEST(ThreadPolicyTest, ReportMatchesRequestOrNamesFailure) {
+    // Real-time and raised priorities depend on the process's rights, so
+    // either the OS reports the requested policy or the failure says why
+    ThreadPolicyConfig fifo;
+    fifo.scheduler = ThreadScheduler::Fifo;
+    fifo.realtimePriority = 5;
+    AppliedThreadPolicy result = ApplyOnThread(fifo);
+    if (result.failures.empty()) {
+        EXPECT_EQ(result.scheduler, ThreadScheduler::Fifo);
+        EXPECT_EQ(result.realtimePriority, 5);
+    } else {
+        EXPECT_EQ(result.scheduler, ThreadScheduler::Normal);
+    }
+
+    ThreadPolicyConfig high;
+    high.priority = ThreadPriority::High;
+    result = ApplyOnThread(high);
+    if (result.failures.empty()) {
+        EXPECT_EQ(result.priority, ThreadPriority::High);
+    } else {
+        EXPECT_NE(result.failures.find("priority"), std::string::npos);
+    }
+}
+
+TEST(ThreadPolicyTest, CoreAppliesPolicyToProcessingThread) {
+    Mouse2VRCore core;
+    ASSERT_TRUE(core.Initialize(std::make_unique<NullInputSource>(), std::make_unique<NullControllerSink>()));
+    AppConfig config;
+    config.updateIntervalMs = 5;
+    config.processingThread.affinityMask = FirstAllowedCpu();
+    core.UpdateSettings(config);
+
+    EXPECT_FALSE(core.GetThreadPolicyReport().processing.applied);
+    core.Start();
+    std::this_thread::sleep_for(50ms);
+    ThreadPolicyReport report = core.GetThreadPolicyReport();
+    core.Shutdown();
+
+    EXPECT_TRUE(report.processing.Succeeded()) << report.processing.failures;
+    EXPECT_EQ(report.processing.affinityMask, config.processingThread.affinityMask);
+    EXPECT_FALSE(report.input.applied);  // NullInputSource has no capture thread
+    EXPECT_FALSE(report.memoryLocked);
+}
+
+#ifdef __linux__
+TEST(ThreadPolicyTest, EvdevReaderThreadAppliesPolicy) {
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    EvdevInputSource source(fds[0], "policy");
+    ThreadPolicyConfig policy;
+    policy.affinityMask = FirstAllowedCpu();
+    source.SetThreadPolicy(policy);
+    ASSERT_TRUE(source.Start());
+
+    AppliedThreadPolicy applied;
+    for (int i = 0; i < 100 && !applied.applied; ++i) {
+        std::this_thread::sleep_for(1ms);
+        applied = source.GetAppliedThreadPolicy();
+    }
+    close(fds[1]);
+    source.Stop();
+
+    EXPECT_TRUE(applied.Succeeded()) << applied.failures;
+    EXPECT_EQ(applied.affinityMask, policy.affinityMask);
+}
+#endif
@@ -0,0 +1,41 @@
+#include <gtest/gtest.h>
+#include "common/TimedMutex.h"
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+using namespace Mouse2VR;
+using namespace std::chrono_literals;
+
+TEST(TimedMutexTest, UncontendedLockRecordsNothing) {
+    TimedMutex mutex;
+    for (int i = 0; i < 100; ++i) {
+        std::lock_guard<TimedMutex> lock(mutex);
+    }
+    EXPECT_EQ(mutex.GetContendedCount(), 0u);
+    EXPECT_EQ(mutex.GetWaitNs(), 0);
+}
+
+TEST(TimedMutexTest, ContendedLockRecordsWait) {
+    TimedMutex mutex;
+    mutex.lock();
+    
+    std::thread waiter([&] {
+        std::lock_guard<TimedMutex> lock(mutex);
+    });
+    std::this_thread::sleep_for(20ms);
+    mutex.unlock();
+    waiter.join();
+    
+    EXPECT_EQ(mutex.GetContendedCount(), 1u);
+    EXPECT_GE(mutex.GetWaitNs(), 10000000);
+}
+
+TEST(TimedMutexTest, TryLockFailsWhileHeld) {
+    TimedMutex mutex;
+    std::unique_lock<TimedMutex> lock(mutex);
+    std::thread other([&] {
+        EXPECT_FALSE(mutex.try_lock());
+    });
+    other.join();
+}
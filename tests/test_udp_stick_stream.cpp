@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "common/Clock.h"
+#include "common/UdpSocket.h"
+#include "core/UdpStickStream.h"
+#include <cstring>
+#include <memory>
+
+using namespace Mouse2VR;
+
+namespace {
+
+// Encoded packet with the given sequence number
+struct Datagram {
+    explicit Datagram(uint32_t sequence, float stickY = 0.0f) {
+        StickStatePacket packet;
+        packet.sequence = sequence;
+        packet.timestampNs = 1000;
+        packet.stickY = stickY;
+        packet.Encode(bytes);
+    }
+    uint8_t bytes[StickStatePacket::kSize];
+};
+
+bool Deliver(StickStateReceiver& receiver, uint32_t sequence, float stickY = 0.0f) {
+    Datagram datagram(sequence, stickY);
+    return receiver.OnPacket(datagram.bytes, sizeof(datagram.bytes), 2000);
+}
+
+// Wait until the receiver has counted at least count packets
+void Receive(StickStateReceiver& receiver, uint64_t count) {
+    for (int i = 0; i < 100 && receiver.GetStats().received < count; ++i) {
+        receiver.Wait(10);
+    }
+}
+
+} // namespace
+
+TEST(StickStatePacketTest, EncodesLittleEndianAndRoundTrips) {
+    StickStatePacket packet;
+    packet.sequence = 0x01020304;
+    packet.timestampNs = -2;
+    packet.stickX = -0.25f;
+    packet.stickY = 0.75f;
+    packet.speed = 1.5f;
+    uint8_t bytes[StickStatePacket::kSize];
+    packet.Encode(bytes);
+
+    EXPECT_EQ(std::memcmp(bytes, "M2SS", 4), 0);
+    EXPECT_EQ(bytes[4], 1);
+    EXPECT_EQ(bytes[8], 0x04);
+    EXPECT_EQ(bytes[11], 0x01);
+    EXPECT_EQ(bytes[12], 0xFE);
+    EXPECT_EQ(bytes[19], 0xFF);
+
+    StickStatePacket decoded;
+    ASSERT_TRUE(StickStatePacket::Decode(bytes, sizeof(bytes), decoded));
+    EXPECT_EQ(decoded.sequence, packet.sequence);
+    EXPECT_EQ(decoded.timestampNs, packet.timestampNs);
+    EXPECT_EQ(decoded.stickX, packet.stickX);
+    EXPECT_EQ(decoded.stickY, packet.stickY);
+    EXPECT_EQ(decoded.speed, packet.speed);
+
+    EXPECT_FALSE(StickStatePacket::Decode(bytes, sizeof(bytes) - 1, decoded));
+    bytes[0] ^= 1;
+    EXPECT_FALSE(StickStatePacket::Decode(bytes, sizeof(bytes), decoded));
+}
+
+TEST(StickStateReceiverTest, CountsLossAndReordering) {
+    StickStateReceiver receiver(0, "127.0.0.1");
+    EXPECT_TRUE(Deliver(receiver, 10, 0.1f));
+    EXPECT_TRUE(Deliver(receiver, 11, 0.2f));
+    EXPECT_TRUE(Deliver(receiver, 15, 0.5f));  // 12-14 missing
+    EXPECT_EQ(receiver.GetStats().lost, 3u);
+
+    EXPECT_FALSE(Deliver(receiver, 13, 0.3f));  // Late: counted, state kept
+    EXPECT_FALSE(Deliver(receiver, 13));        // And again
+    EXPECT_FALSE(Deliver(receiver, 15));
+
+    const StickStreamStats& stats = receiver.GetStats();
+    EXPECT_EQ(stats.received, 6u);
+    EXPECT_EQ(stats.lost, 2u);
+    EXPECT_EQ(stats.reordered, 1u);
+    EXPECT_EQ(stats.duplicates, 2u);
+    EXPECT_EQ(receiver.GetState().sequence, 15u);
+    EXPECT_FLOAT_EQ(receiver.GetState().stickY, 0.5f);
+    EXPECT_EQ(receiver.GetTransitStats().count, 6u);
+}
+
+TEST(StickStateReceiverTest, OldPacketsAreStale) {
+    StickStateReceiver receiver(0, "127.0.0.1");
+    Deliver(receiver, 100);
+    EXPECT_FALSE(Deliver(receiver, 99));  // Before the first packet: never expected
+    Deliver(receiver, 300);
+    EXPECT_FALSE(Deliver(receiver, 200));  // Behind the window
+
+    const StickStreamStats& stats = receiver.GetStats();
+    EXPECT_EQ(stats.stale, 2u);
+    EXPECT_EQ(stats.reordered, 0u);
+    EXPECT_EQ(stats.lost, 199u);
+}
+
+TEST(StickStateReceiverTest, SequenceWrapsAround) {
+    StickStateReceiver receiver(0, "127.0.0.1");
+    Deliver(receiver, 0xFFFFFFFE);
+    EXPECT_TRUE(Deliver(receiver, 1));  // 0xFFFFFFFF and 0 missing
+    EXPECT_FALSE(Deliver(receiver, 0xFFFFFFFF));
+    EXPECT_EQ(receiver.GetStats().lost, 1u);
+    EXPECT_EQ(receiver.GetStats().reordered, 1u);
+    EXPECT_EQ(receiver.GetState().sequence, 1u);
+}
+
+TEST(StickStateReceiverTest, ResyncsAfterSenderRestart) {
+    StickStateReceiver receiver(0, "127.0.0.1");
+    for (uint32_t s = 5000; s < 5010; ++s) {
+        Deliver(receiver, s);
+    }
+    EXPECT_FALSE(Deliver(receiver, 0));
+    EXPECT_FALSE(Deliver(receiver, 1));
+    EXPECT_TRUE(Deliver(receiver, 2, 0.75f));  // Third in a row far behind: restart
+
+    EXPECT_EQ(receiver.GetStats().resyncs, 1u);
+    EXPECT_EQ(receiver.GetState().sequence, 2u);
+    EXPECT_FLOAT_EQ(receiver.GetState().stickY, 0.75f);
+    EXPECT_TRUE(Deliver(receiver, 3));
+}
+
+TEST(StickStateReceiverTest, RejectsForeignDatagrams) {
+    StickStateReceiver receiver(0, "127.0.0.1");
+    Datagram datagram(1);
+    EXPECT_FALSE(receiver.OnPacket(datagram.bytes, 16, 0));
+    datagram.bytes[4] = 9;  // Unknown version
+    EXPECT_FALSE(receiver.OnPacket(datagram.bytes, sizeof(datagram.bytes), 0));
+    EXPECT_EQ(receiver.GetStats().rejected, 2u);
+    EXPECT_EQ(receiver.GetStats().received, 0u);
+    EXPECT_FALSE(receiver.GetState().valid);
+}
+
+TEST(UdpStickStreamTest, StreamsReportsOverLoopback) {
+    StickStateReceiver receiver(0, "127.0.0.1");
+    ASSERT_TRUE(receiver.IsOpen());
+    ASSERT_NE(receiver.GetPort(), 0);
+
+    auto clock = std::make_shared<SimulatedClock>(5000);
+    UdpStickSink sink("127.0.0.1", receiver.GetPort(), clock);
+    ASSERT_TRUE(sink.Initialize());
+    for (int i = 1; i <= 50; ++i) {
+        clock->AdvanceBy(1000);
+        sink.SetSpeed(i * 0.01f);
+        sink.SetLeftStick(0.0f, i * 0.02f);
+        sink.Update();
+    }
+    EXPECT_EQ(sink.GetSentCount(), 50u);
+
+    Receive(receiver, 50);
+    const StickStreamStats& stats = receiver.GetStats();
+    EXPECT_EQ(stats.received, 50u);
+    EXPECT_EQ(stats.lost, 0u);
+    EXPECT_EQ(stats.rejected, 0u);
+
+    const StickStreamState& state = receiver.GetState();
+    ASSERT_TRUE(state.valid);
+    EXPECT_EQ(state.sequence, 49u);
+    EXPECT_EQ(state.timestampNs, 55000);
+    EXPECT_FLOAT_EQ(state.stickY, 1.0f);
+    EXPECT_FLOAT_EQ(state.speed, 0.5f);
+}
+
+TEST(UdpStickStreamTest, ReceiverRejectsOversizedDatagrams) {
+    StickStateReceiver receiver(0, "127.0.0.1");
+    ASSERT_TRUE(receiver.IsOpen());
+    UdpSocket sender;
+    ASSERT_TRUE(sender.Connect("127.0.0.1", receiver.GetPort()));
+
+    uint8_t oversized[256] = {};
+    Datagram datagram(7);
+    std::memcpy(oversized, datagram.bytes, sizeof(datagram.bytes));
+    ASSERT_TRUE(sender.Send(oversized, sizeof(oversized)));
+    ASSERT_TRUE(sender.Send(datagram.bytes, sizeof(datagram.bytes)));
+
+    Receive(receiver, 1);
+    EXPECT_EQ(receiver.GetStats().rejected, 1u);
+    EXPECT_EQ(receiver.GetStats().received, 1u);
+    EXPECT_EQ(receiver.GetState().sequence, 7u);
+}
+
+TEST(UdpStickStreamTest, SinkRejectsBadDestination) {
+    UdpStickSink sink("not-an-address", 1234);
+    EXPECT_FALSE(sink.Initialize());
+    EXPECT_FALSE(sink.IsConnected());
+    sink.Update();
+    EXPECT_EQ(sink.GetSentCount(), 0u);
+}
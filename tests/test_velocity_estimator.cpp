@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+#include "core/InputProcessor.h"
+#include "core/VelocityEstimator.h"
+#include <cmath>
+#include <vector>
+
+using namespace Mouse2VR;
+
+namespace {
+
+VelocityEstimator Make(VelocityFilter filter) {
+    VelocityEstimatorConfig config;
+    config.filter = filter;
+    VelocityEstimator estimator;
+    estimator.Configure(config);
+    return estimator;
+}
+
+// Standard deviation of the estimator's output for a constant belt speed
+// measured with count quantization and tick-time jitter
+double SteadyStateNoise(VelocityEstimator& estimator) {
+    const double trueSpeed = 1000.0;  // counts/s
+    double position = 0.0;
+    long reported = 0;
+    std::vector<double> outputs;
+    for (int tick = 0; tick < 2000; ++tick) {
+        float dt = 0.005f + 0.001f * static_cast<float>((tick * 7) % 5 - 2) / 2.0f;
+        position += trueSpeed * dt;
+        long counts = static_cast<long>(position) - reported;
+        reported += counts;
+        float out = estimator.Update(counts / dt, dt);
+        if (tick >= 500) {
+            outputs.push_back(out);
+        }
+    }
+    double mean = 0.0;
+    for (double v : outputs) mean += v;
+    mean /= outputs.size();
+    double var = 0.0;
+    for (double v : outputs) var += (v - mean) * (v - mean);
+    return std::sqrt(var / outputs.size());
+}
+
+} // namespace
+
+TEST(VelocityEstimatorTest, FilterNamesRoundTrip) {
+    for (VelocityFilter f : {VelocityFilter::None, VelocityFilter::Ema, VelocityFilter::OneEuro,
+                             VelocityFilter::AlphaBeta, VelocityFilter::Median}) {
+        EXPECT_EQ(VelocityFilterFromString(VelocityFilterToString(f)), f);
+    }
+    EXPECT_EQ(VelocityFilterFromString("bogus"), VelocityFilter::None);
+}
+
+TEST(VelocityEstimatorTest, NonePassesThrough) {
+    VelocityEstimator estimator = Make(VelocityFilter::None);
+    EXPECT_EQ(estimator.Update(123.0f, 0.01f), 123.0f);
+    EXPECT_EQ(estimator.Update(-5.0f, 0.01f), -5.0f);
+}
+
+TEST(VelocityEstimatorTest, AllFiltersConvergeOnConstantInput) {
+    for (VelocityFilter f : {VelocityFilter::Ema, VelocityFilter::OneEuro,
+                             VelocityFilter::AlphaBeta, VelocityFilter::Median}) {
+        VelocityEstimator estimator = Make(f);
+        estimator.Update(0.0f, 0.01f);
+        float out = 0.0f;
+        for (int i = 0; i < 2000; ++i) {
+            out = estimator.Update(500.0f, 0.01f);
+        }
+        EXPECT_NEAR(out, 500.0f, 1.0f) << VelocityFilterToString(f);
+    }
+}
+
+TEST(VelocityEstimatorTest, FiltersReduceQuantizationJitter) {
+    VelocityEstimator raw = Make(VelocityFilter::None);
+    double rawNoise = SteadyStateNoise(raw);
+    ASSERT_GT(rawNoise, 0.0);
+    
+    for (VelocityFilter f : {VelocityFilter::Ema, VelocityFilter::OneEuro, VelocityFilter::AlphaBeta}) {
+        VelocityEstimator estimator = Make(f);
+        EXPECT_LT(SteadyStateNoise(estimator), rawNoise * 0.6) << VelocityFilterToString(f);
+    }
+}
+
+TEST(VelocityEstimatorTest, MedianRejectsSingleSpike) {
+    VelocityEstimator estimator = Make(VelocityFilter::Median);
+    for (int i = 0; i < 5; ++i) {
+        estimator.Update(100.0f, 0.01f);
+    }
+    EXPECT_EQ(estimator.Update(10000.0f, 0.01f), 100.0f);
+    EXPECT_EQ(estimator.Update(100.0f, 0.01f), 100.0f);
+}
+
+TEST(VelocityEstimatorTest, MedianOfFillingWindow) {
+    VelocityEstimatorConfig config;
+    config.filter = VelocityFilter::Median;
+    config.medianWindow = 3;
+    VelocityEstimator estimator;
+    estimator.Configure(config);
+    
+    EXPECT_EQ(estimator.Update(30.0f, 0.01f), 30.0f);
+    EXPECT_EQ(estimator.Update(10.0f, 0.01f), 20.0f);
+    EXPECT_EQ(estimator.Update(20.0f, 0.01f), 20.0f);
+    EXPECT_EQ(estimator.Update(40.0f, 0.01f), 20.0f);  // {10, 20, 40}
+    EXPECT_EQ(estimator.Update(50.0f, 0.01f), 40.0f);  // {20, 40, 50}
+}
+
+TEST(VelocityEstimatorTest, AlphaBetaTracksRamp) {
+    VelocityEstimator estimator = Make(VelocityFilter::AlphaBeta);
+    float v = 0.0f;
+    for (int i = 0; i < 500; ++i) {
+        v = 10.0f * i;  // 1000 counts/s^2 at 100 Hz
+        estimator.Update(v, 0.01f);
+    }
+    // No steady-state lag on a ramp, and acceleration is estimated
+    EXPECT_NEAR(estimator.GetVelocity(), v, 1.0f);
+    EXPECT_NEAR(estimator.GetAcceleration(), 1000.0f, 10.0f);
+}
+
+TEST(VelocityEstimatorTest, OneEuroIsResponsiveToSteps) {
+    VelocityEstimator euro = Make(VelocityFilter::OneEuro);
+    VelocityEstimatorConfig slowConfig;
+    slowConfig.filter = VelocityFilter::Ema;
+    slowConfig.emaTimeConstant = 0.5f;
+    VelocityEstimator slow;
+    slow.Configure(slowConfig);
+    
+    euro.Update(0.0f, 0.01f);
+    slow.Update(0.0f, 0.01f);
+    for (int i = 0; i < 10; ++i) {
+        euro.Update(2000.0f, 0.01f);
+        slow.Update(2000.0f, 0.01f);
+    }
+    // After 100 ms the adaptive filter is much closer to the new speed
+    EXPECT_GT(euro.GetVelocity(), slow.GetVelocity());
+    EXPECT_GT(euro.GetVelocity(), 1500.0f);
+}
+
+TEST(VelocityEstimatorTest, IgnoresInvalidTicks) {
+    VelocityEstimator estimator = Make(VelocityFilter::Median);
+    estimator.Update(100.0f, 0.01f);
+    EXPECT_EQ(estimator.Update(NAN, 0.01f), 100.0f);
+    EXPECT_EQ(estimator.Update(500.0f, 0.0f), 100.0f);
+}
+
+TEST(VelocityEstimatorTest, SwitchingFilterResetsState) {
+    VelocityEstimator estimator = Make(VelocityFilter::Ema);
+    for (int i = 0; i < 10; ++i) {
+        estimator.Update(1000.0f, 0.01f);
+    }
+    VelocityEstimatorConfig config;
+    config.filter = VelocityFilter::Median;
+    estimator.Configure(config);
+    EXPECT_EQ(estimator.Update(7.0f, 0.01f), 7.0f);
+}
+
+TEST(VelocityEstimatorTest, ProcessorUsesConfiguredFilter) {
+    InputProcessor processor;
+    ProcessingConfig config;
+    config.velocity.filter = VelocityFilter::Median;
+    config.velocity.medianWindow = 3;
+    processor.SetConfig(config);
+    
+    float x, y;
+    processor.ProcessDelta(MouseDelta{0, 10}, 0.01f, x, y);
+    processor.ProcessDelta(MouseDelta{0, 10}, 0.01f, x, y);
+    float steady = processor.GetSpeedMetersPerSecond();
+    
+    // A one-tick spike (e.g. a late tick that caught a burst) is ignored
+    processor.ProcessDelta(MouseDelta{0, 500}, 0.01f, x, y);
+    EXPECT_FLOAT_EQ(processor.GetSpeedMetersPerSecond(), steady);
+}
@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include "core/InputProcessor.h"
+#include "core/VelocityPredictor.h"
+#include <cmath>
+
+using namespace Mouse2VR;
+
+namespace {
+
+PredictionConfig Enabled(float horizonMs = 20.0f) {
+    PredictionConfig config;
+    config.enabled = true;
+    config.horizonMs = horizonMs;
+    return config;
+}
+
+} // namespace
+
+TEST(VelocityPredictorTest, DisabledIsPassThrough) {
+    VelocityPredictor predictor;
+    predictor.Configure(PredictionConfig{});
+    for (int i = 0; i < 10; ++i) {
+        float v = 100.0f * i;
+        EXPECT_EQ(predictor.Update(v, v, 0.005f), v);
+    }
+}
+
+TEST(VelocityPredictorTest, ConstantSpeedIsUnchanged) {
+    VelocityPredictor predictor;
+    predictor.Configure(Enabled());
+    float out = 0.0f;
+    for (int i = 0; i < 200; ++i) {
+        out = predictor.Update(1000.0f, 1000.0f, 0.005f);
+    }
+    EXPECT_NEAR(out, 1000.0f, 1e-3f);
+}
+
+TEST(VelocityPredictorTest, LeadsARampCloserToTheFuture) {
+    // Belt accelerating at 2000 counts/s^2; prediction should land near
+    // the speed one horizon ahead instead of the current speed
+    VelocityPredictor predictor;
+    predictor.Configure(Enabled(20.0f));
+    const float dt = 0.005f;
+    const float accel = 2000.0f;
+    float v = 500.0f;
+    float out = 0.0f;
+    for (int i = 0; i < 100; ++i) {
+        v += accel * dt;
+        out = predictor.Update(v, v, dt);
+    }
+    float future = v + accel * 0.020f;
+    EXPECT_LT(std::abs(out - future), std::abs(v - future) * 0.25f);
+    EXPECT_NEAR(predictor.GetAcceleration(), accel, accel * 0.05f);
+}
+
+TEST(VelocityPredictorTest, LeadIsClampedToFractionOfEstimate) {
+    PredictionConfig config = Enabled(200.0f);
+    config.maxLeadFraction = 0.25f;
+    config.accelerationTimeConstant = 0.0f;
+    VelocityPredictor predictor;
+    predictor.Configure(config);
+    predictor.Update(100.0f, 100.0f, 0.005f);
+    // Huge jump in one tick: raw acceleration 180000 counts/s^2
+    float out = predictor.Update(1000.0f, 1000.0f, 0.005f);
+    EXPECT_FLOAT_EQ(out, 1250.0f);
+}
+
+TEST(VelocityPredictorTest, DecelerationNeverCrossesZero) {
+    PredictionConfig config = Enabled(100.0f);
+    config.maxLeadFraction = 1.0f;
+    config.accelerationTimeConstant = 0.0f;
+    config.fastStopRatio = 0.0f;
+    VelocityPredictor predictor;
+    predictor.Configure(config);
+    float v = 1000.0f;
+    for (int i = 0; i < 50; ++i) {
+        v = std::max(0.0f, v - 100.0f);
+        float out = predictor.Update(v, v, 0.005f);
+        EXPECT_GE(out, 0.0f);
+        EXPECT_LE(out, v);
+    }
+}
+
+TEST(VelocityPredictorTest, FastStopPublishesRawMeasurement) {
+    VelocityPredictor predictor;
+    predictor.Configure(Enabled());
+    for (int i = 0; i < 50; ++i) {
+        predictor.Update(1000.0f + 10.0f * i, 1000.0f + 10.0f * i, 0.005f);
+    }
+    // Belt stops dead while a smoothing filter still reports high speed
+    float out = predictor.Update(800.0f, 0.0f, 0.005f);
+    EXPECT_TRUE(predictor.IsFastStopping());
+    EXPECT_EQ(out, 0.0f);
+    EXPECT_EQ(predictor.GetAcceleration(), 0.0f);
+}
+
+TEST(VelocityPredictorTest, ReversalIsTreatedAsStop) {
+    VelocityPredictor predictor;
+    predictor.Configure(Enabled());
+    predictor.Update(1000.0f, 1000.0f, 0.005f);
+    predictor.Update(1000.0f, 1000.0f, 0.005f);
+    EXPECT_EQ(predictor.Update(600.0f, -200.0f, 0.005f), -200.0f);
+}
+
+TEST(VelocityPredictorTest, ProcessorStopsWithoutOvershoot) {
+    // EMA filter lags the stop; prediction must not keep the stick moving
+    ProcessingConfig config;
+    config.velocity.filter = VelocityFilter::Ema;
+    config.prediction = Enabled(30.0f);
+    InputProcessor processor;
+    processor.SetConfig(config);
+
+    float x, y;
+    for (int i = 0; i < 200; ++i) {
+        processor.ProcessDelta(MouseDelta{0, 5 + i / 10}, 0.005f, x, y);
+    }
+    EXPECT_GT(y, 0.0f);
+    processor.ProcessDelta(MouseDelta{0, 0}, 0.005f, x, y);
+    EXPECT_EQ(y, 0.0f);
+    EXPECT_EQ(processor.GetSpeedMetersPerSecond(), 0.0f);
+    // Real-world speed still reports the filtered estimate
+    EXPECT_GT(processor.GetRealWorldSpeed(), 0.0f);
+}